@@ -0,0 +1,64 @@
+// benchUtil.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/**
+ * Small helpers shared by the benchmark drivers in bench/. Every driver takes
+ * its problem sizes as optional positional arguments so that the defaults can
+ * stay small enough for a quick run.
+ */
+
+using BenchClock = std::chrono::steady_clock;
+
+/**
+ * Returns the time elapsed since start in microseconds.
+ */
+inline double elapsedUs(BenchClock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(BenchClock::now() - start).count();
+}
+
+/**
+ * Returns the p-th percentile (0 <= p <= 100) of samples. The samples are
+ * sorted in place.
+ */
+inline double percentile(std::vector<double>& samples, double p)
+{
+    if (samples.empty()) {
+        return 0.0;
+    }
+    std::sort(samples.begin(), samples.end());
+    size_t rank = static_cast<size_t>(p / 100.0 * static_cast<double>(samples.size() - 1) + 0.5);
+    return samples[std::min(rank, samples.size() - 1)];
+}
+
+/**
+ * Returns the index-th command line argument as an unsigned number, or
+ * fallback if it was not given.
+ */
+inline uint64_t argOr(int argc, char** argv, int index, uint64_t fallback)
+{
+    return argc > index ? std::strtoull(argv[index], nullptr, 10) : fallback;
+}
+
+/**
+ * Prevents the optimizer from discarding a computed value.
+ */
+template <typename T> inline void keep(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+#endif // BENCH_UTIL_H
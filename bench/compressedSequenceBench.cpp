@@ -0,0 +1,112 @@
+// compressedSequenceBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Bytes per element and iteration time of CompressedSequence<int64_t>
+// against LinkedList<int64_t> on three data sets: sorted IDs with random
+// gaps, millisecond timestamps of irregular events, and unsorted random
+// values (the worst case). LinkedList memory is the malloc_usable_size of
+// every block obtained through the global operator new, which is replaced
+// here; malloc's own chunk headers are not included.
+//
+// usage: compressedSequenceBench [elements=1000000]
+#include "CompressedSequence.h"
+#include "LinkedList.h"
+#include "benchUtil.h"
+#include <malloc.h>
+#include <new>
+#include <random>
+
+namespace {
+
+size_t gHeapBytes = 0;
+
+void report(const char* name, const std::vector<int64_t>& values)
+{
+    size_t before = gHeapBytes;
+    LinkedList<int64_t> list;
+    for (int64_t value : values) {
+        list.add(value);
+    }
+    double listBytes = static_cast<double>(gHeapBytes - before + sizeof(list));
+
+    CompressedSequence<int64_t> sequence;
+    for (int64_t value : values) {
+        sequence.add(value);
+    }
+    double sequenceBytes = static_cast<double>(sequence.memoryUsage());
+
+    BenchClock::time_point start = BenchClock::now();
+    int64_t sum = 0;
+    for (int64_t value : static_cast<const LinkedList<int64_t>&>(list)) {
+        sum += value;
+    }
+    double listUs = elapsedUs(start);
+    start = BenchClock::now();
+    for (int64_t value : sequence) {
+        sum -= value;
+    }
+    double sequenceUs = elapsedUs(start);
+    keep(sum);
+
+    double count = static_cast<double>(values.size());
+    std::printf("  %-11s list %6.2f B/elem %8.0f us   compressed %5.2f B/elem %8.0f us\n", name,
+        listBytes / count, listUs, sequenceBytes / count, sequenceUs);
+}
+}
+
+void* operator new(size_t bytes)
+{
+    if (void* p = std::malloc(bytes == 0 ? 1 : bytes)) {
+        gHeapBytes += malloc_usable_size(p);
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    gHeapBytes -= malloc_usable_size(p);
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    gHeapBytes -= malloc_usable_size(p);
+    std::free(p);
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t elements = argOr(argc, argv, 1, 1000000);
+    std::mt19937_64 rng(11);
+
+    std::vector<int64_t> ids;
+    int64_t id = 1000000;
+    for (uint64_t i = 0; i < elements; ++i) {
+        id += 1 + static_cast<int64_t>(rng() % 64);
+        ids.push_back(id);
+    }
+
+    std::vector<int64_t> timestamps;
+    int64_t timestamp = 1700000000000;
+    std::exponential_distribution<double> gaps(1.0 / 250.0);
+    for (uint64_t i = 0; i < elements; ++i) {
+        timestamp += static_cast<int64_t>(gaps(rng));
+        timestamps.push_back(timestamp);
+    }
+
+    std::vector<int64_t> randoms;
+    for (uint64_t i = 0; i < elements; ++i) {
+        randoms.push_back(static_cast<int64_t>(rng()));
+    }
+
+    std::printf("%llu int64_t elements\n", static_cast<unsigned long long>(elements));
+    report("ids", ids);
+    report("timestamps", timestamps);
+    report("random", randoms);
+    return 0;
+}
@@ -0,0 +1,108 @@
+// copyPathBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Copy construction, copy assignment onto a list of the same size, and
+// clear() for int and a POD struct, each next to a wrapper around the same
+// data whose copies may throw and whose destructor is user-provided, which
+// keeps LinkedList on its general code paths.
+//
+// usage: copyPathBench [elements=100000] [rounds=20]
+#include "LinkedList.h"
+#include "benchUtil.h"
+
+namespace {
+
+struct Pod {
+    int32_t mA;
+    int32_t mB;
+    double mC;
+};
+
+// Same layout as T, but LinkedList must assume its copies throw.
+template <typename T> struct Opaque {
+    Opaque() = default;
+    Opaque(const T& value)
+        : mValue(value)
+    {
+    }
+    Opaque(const Opaque& other)
+        : mValue(other.mValue)
+    {
+    }
+    Opaque& operator=(const Opaque& other)
+    {
+        mValue = other.mValue;
+        return *this;
+    }
+    ~Opaque()
+    {
+    }
+
+    T mValue;
+};
+
+struct Times {
+    double mCopyUs = 0;
+    double mAssignUs = 0;
+    double mClearUs = 0;
+};
+
+template <typename T, typename Make> Times measure(uint64_t elements, uint64_t rounds, Make make)
+{
+    Times times;
+    LinkedList<T> source;
+    for (uint64_t i = 0; i < elements; ++i) {
+        source.add(make(i));
+    }
+    for (uint64_t round = 0; round < rounds; ++round) {
+        BenchClock::time_point start = BenchClock::now();
+        LinkedList<T> copy(source);
+        times.mCopyUs += elapsedUs(start);
+
+        LinkedList<T> target;
+        for (uint64_t i = 0; i < elements; ++i) {
+            target.add(make(i + 1));
+        }
+        start = BenchClock::now();
+        target = source;
+        times.mAssignUs += elapsedUs(start);
+        keep(target.size());
+
+        start = BenchClock::now();
+        copy.clear();
+        times.mClearUs += elapsedUs(start);
+    }
+    times.mCopyUs /= rounds;
+    times.mAssignUs /= rounds;
+    times.mClearUs /= rounds;
+    return times;
+}
+
+void report(const char* name, const Times& times)
+{
+    std::printf("  %-14s copy %10.1f us   assign %10.1f us   clear %10.1f us\n", name,
+        times.mCopyUs, times.mAssignUs, times.mClearUs);
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t elements = argOr(argc, argv, 1, 100000);
+    uint64_t rounds = argOr(argc, argv, 2, 20);
+    auto makeInt = [](uint64_t i) { return static_cast<int>(i); };
+    auto makePod = [](uint64_t i) {
+        return Pod { static_cast<int32_t>(i), static_cast<int32_t>(i * 3), i * 0.5 };
+    };
+
+    std::printf("%llu elements, mean of %llu rounds\n", static_cast<unsigned long long>(elements),
+        static_cast<unsigned long long>(rounds));
+    report("int", measure<int>(elements, rounds, makeInt));
+    report("Opaque<int>", measure<Opaque<int>>(elements, rounds, makeInt));
+    report("Pod", measure<Pod>(elements, rounds, makePod));
+    report("Opaque<Pod>", measure<Opaque<Pod>>(elements, rounds, makePod));
+    return 0;
+}
@@ -0,0 +1,102 @@
+// editBatchBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// k positional edits on an n-element list: one call at a time versus one
+// LinkedListEditBatch applied in a single pass.
+//
+// usage: editBatchBench [elements=100000] [edits=1000] [rounds=5]
+#include "LinkedList.h"
+#include "benchUtil.h"
+
+namespace {
+
+struct Op {
+    int mKind;
+    uint32_t mIndex;
+    uint64_t mValue;
+};
+
+std::vector<Op> makeOps(uint32_t size, uint64_t count, uint32_t seed)
+{
+    std::vector<Op> ops;
+    for (uint64_t i = 0; i < count; ++i) {
+        seed = seed * 1103515245U + 12345U;
+        int kind = static_cast<int>((seed >> 8) % 3);
+        seed = seed * 1103515245U + 12345U;
+        uint32_t bound = kind == 0 ? size + 1 : size;
+        Op op { kind, (seed >> 4) % bound, i };
+        size += kind == 0 ? 1 : kind == 1 ? -1 : 0;
+        ops.push_back(op);
+    }
+    return ops;
+}
+
+void fill(LinkedList<uint64_t>& list, uint64_t count)
+{
+    for (uint64_t i = 0; i < count; ++i) {
+        list.add(i);
+    }
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t elements = argOr(argc, argv, 1, 100000);
+    uint64_t edits = argOr(argc, argv, 2, 1000);
+    uint64_t rounds = argOr(argc, argv, 3, 5);
+    std::vector<Op> ops = makeOps(static_cast<uint32_t>(elements), edits, 42);
+
+    double directUs = 0;
+    double batchUs = 0;
+    double applyUs = 0;
+    for (uint64_t round = 0; round < rounds; ++round) {
+        LinkedList<uint64_t> direct;
+        LinkedList<uint64_t> batched;
+        fill(direct, elements);
+        fill(batched, elements);
+
+        BenchClock::time_point start = BenchClock::now();
+        for (const Op& op : ops) {
+            if (op.mKind == 0) {
+                direct.add(op.mIndex, op.mValue);
+            } else if (op.mKind == 1) {
+                direct.remove(op.mIndex);
+            } else {
+                direct.set(op.mIndex, op.mValue);
+            }
+        }
+        directUs += elapsedUs(start);
+
+        start = BenchClock::now();
+        LinkedListEditBatch<uint64_t> batch(batched);
+        for (const Op& op : ops) {
+            if (op.mKind == 0) {
+                batch.add(op.mIndex, op.mValue);
+            } else if (op.mKind == 1) {
+                batch.remove(op.mIndex);
+            } else {
+                batch.set(op.mIndex, op.mValue);
+            }
+        }
+        BenchClock::time_point applyStart = BenchClock::now();
+        batched.apply(batch);
+        applyUs += elapsedUs(applyStart);
+        batchUs += elapsedUs(start);
+
+        if (direct != batched) {
+            std::printf("mismatch between batched and direct results\n");
+            return 1;
+        }
+    }
+    std::printf("%llu edits on %llu elements, mean of %llu rounds\n",
+        static_cast<unsigned long long>(edits), static_cast<unsigned long long>(elements),
+        static_cast<unsigned long long>(rounds));
+    std::printf("  one call at a time   %12.1f us\n", directUs / rounds);
+    std::printf("  edit batch           %12.1f us (apply %.1f us)\n", batchUs / rounds,
+        applyUs / rounds);
+    return 0;
+}
@@ -0,0 +1,157 @@
+// flatCombiningBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// 2..maxThreads threads each alternately append to the back of one shared
+// queue and remove from its front: a LinkedList behind a std::mutex, a
+// FlatCombiningList, and a bounded lock-free MPMC ring buffer for reference.
+// The total number of operations is split between the threads.
+//
+// usage: flatCombiningBench [operations=400000] [maxThreads=64]
+#include "FlatCombiningList.h"
+#include "LinkedList.h"
+#include "benchUtil.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+struct LockedList {
+    LinkedList<uint64_t> mList;
+    std::mutex mLock;
+
+    void add(uint64_t value)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mList.add(value);
+    }
+
+    bool removeFront(uint64_t& value)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        if (mList.isEmpty()) {
+            return false;
+        }
+        value = mList.get(0);
+        mList.remove(0);
+        return true;
+    }
+};
+
+// Bounded multi-producer/multi-consumer queue: every cell carries a sequence
+// number that tells producers and consumers whose turn it is.
+class LockFreeQueue {
+public:
+    LockFreeQueue()
+        : mCells(new Cell[kCapacity])
+        , mEnqueue(0)
+        , mDequeue(0)
+    {
+        for (uint64_t i = 0; i < kCapacity; ++i) {
+            mCells[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    void add(uint64_t value)
+    {
+        uint64_t position = mEnqueue.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = mCells[position & (kCapacity - 1)];
+            uint64_t sequence = cell.mSequence.load(std::memory_order_acquire);
+            if (sequence == position) {
+                if (mEnqueue.compare_exchange_weak(position, position + 1)) {
+                    cell.mValue = value;
+                    cell.mSequence.store(position + 1, std::memory_order_release);
+                    return;
+                }
+            } else if (sequence < position) {
+                // Full; cannot happen with this workload
+                std::this_thread::yield();
+                position = mEnqueue.load(std::memory_order_relaxed);
+            } else {
+                position = mEnqueue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool removeFront(uint64_t& value)
+    {
+        uint64_t position = mDequeue.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = mCells[position & (kCapacity - 1)];
+            uint64_t sequence = cell.mSequence.load(std::memory_order_acquire);
+            if (sequence == position + 1) {
+                if (mDequeue.compare_exchange_weak(position, position + 1)) {
+                    value = cell.mValue;
+                    cell.mSequence.store(position + kCapacity, std::memory_order_release);
+                    return true;
+                }
+            } else if (sequence < position + 1) {
+                return false;
+            } else {
+                position = mDequeue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    static constexpr uint64_t kCapacity = 1 << 16;
+
+    struct Cell {
+        std::atomic<uint64_t> mSequence;
+        uint64_t mValue;
+    };
+
+    std::unique_ptr<Cell[]> mCells;
+    alignas(64) std::atomic<uint64_t> mEnqueue;
+    alignas(64) std::atomic<uint64_t> mDequeue;
+};
+
+// Returns operations per second
+template <typename Queue> double run(uint64_t operations, uint64_t threads)
+{
+    Queue queue;
+    uint64_t perThread = operations / threads / 2;
+    std::vector<std::thread> workers;
+    BenchClock::time_point start = BenchClock::now();
+    for (uint64_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&queue, perThread, t]() {
+            uint64_t sum = 0;
+            uint64_t value = 0;
+            for (uint64_t i = 0; i < perThread; ++i) {
+                queue.add(t * perThread + i);
+                if (queue.removeFront(value)) {
+                    sum += value;
+                }
+            }
+            keep(sum);
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    return 2 * perThread * threads / elapsedUs(start) * 1e6;
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t operations = argOr(argc, argv, 1, 400000);
+    uint64_t maxThreads = argOr(argc, argv, 2, 64);
+    std::printf("%llu operations, %u hardware threads\n",
+        static_cast<unsigned long long>(operations), std::thread::hardware_concurrency());
+    std::printf("  threads         mutex ops/s    combining ops/s    lock-free ops/s\n");
+    for (uint64_t threads = 2; threads <= maxThreads; threads *= 2) {
+        double locked = run<LockedList>(operations, threads);
+        double combining = run<FlatCombiningList<uint64_t>>(operations, threads);
+        double lockFree = run<LockFreeQueue>(operations, threads);
+        std::printf("  %7llu  %18.0f  %17.0f  %17.0f\n", static_cast<unsigned long long>(threads),
+            locked, combining, lockFree);
+    }
+    return 0;
+}
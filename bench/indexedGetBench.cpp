@@ -0,0 +1,71 @@
+// indexedGetBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Random get(index) reads on a LinkedList of ints with and without an index
+// (see LinkedList::setIndexed), in three phases: reads only, reads
+// interleaved with appends (which patch the index) and reads interleaved
+// with insertions at the front (which discard it). Also reports the memory
+// held by the index.
+//
+// usage: indexedGetBench [elements=10000] [reads=200000] [readsPerWrite=100]
+#include "LinkedList.h"
+#include "benchUtil.h"
+#include <random>
+
+namespace {
+
+enum class Write { None, Append, Insert };
+
+double measure(uint64_t elements, uint64_t reads, uint64_t readsPerWrite, bool indexed,
+    Write write, size_t& memory)
+{
+    LinkedList<int> list;
+    for (uint64_t i = 0; i < elements; ++i) {
+        list.add(static_cast<int>(i));
+    }
+    list.setIndexed(indexed);
+    std::mt19937 rng(7);
+    int64_t sum = 0;
+    BenchClock::time_point start = BenchClock::now();
+    for (uint64_t i = 0; i < reads; ++i) {
+        if (write != Write::None && i % readsPerWrite == 0) {
+            if (write == Write::Append) {
+                list.add(static_cast<int>(i));
+            } else {
+                list.add(0, static_cast<int>(i));
+            }
+        }
+        sum += list.get(static_cast<uint32_t>(rng() % list.size()));
+    }
+    double us = elapsedUs(start);
+    keep(sum);
+    memory = list.indexMemory();
+    return us / static_cast<double>(reads);
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t elements = argOr(argc, argv, 1, 10000);
+    uint64_t reads = argOr(argc, argv, 2, 200000);
+    uint64_t readsPerWrite = argOr(argc, argv, 3, 100);
+
+    std::printf("%llu elements, %llu random reads, one write every %llu reads\n",
+        static_cast<unsigned long long>(elements), static_cast<unsigned long long>(reads),
+        static_cast<unsigned long long>(readsPerWrite));
+    const Write writes[] = { Write::None, Write::Append, Write::Insert };
+    const char* names[] = { "reads only", "with appends", "with inserts" };
+    for (size_t i = 0; i < 3; ++i) {
+        size_t plainMemory = 0;
+        size_t indexMemory = 0;
+        double plain = measure(elements, reads, readsPerWrite, false, writes[i], plainMemory);
+        double indexed = measure(elements, reads, readsPerWrite, true, writes[i], indexMemory);
+        std::printf("  %-13s plain %8.3f us/read   indexed %8.3f us/read (%zu index bytes)\n",
+            names[i], plain, indexed, indexMemory);
+    }
+    return 0;
+}
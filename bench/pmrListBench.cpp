@@ -0,0 +1,98 @@
+// pmrListBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Request-scoped lists: every request builds a few lists, walks them and
+// throws them away. Compares LinkedList on the global heap with
+// pmr::LinkedList on a std::pmr::monotonic_buffer_resource that is reset
+// after each request. Reports the mean and p99 time per request.
+//
+// usage: pmrListBench [requests=20000] [elements=256] [lists=4]
+#include "LinkedList.h"
+#include "benchUtil.h"
+#include <memory_resource>
+
+namespace {
+
+struct Record {
+    uint64_t mId;
+    uint64_t mValue;
+};
+
+template <typename List> uint64_t serve(List* lists, uint64_t count, uint64_t elements)
+{
+    uint64_t sum = 0;
+    for (uint64_t l = 0; l < count; ++l) {
+        for (uint64_t i = 0; i < elements; ++i) {
+            lists[l].add(Record { i, i * l });
+        }
+        for (const Record& record : lists[l]) {
+            sum += record.mValue;
+        }
+        lists[l].remove(0);
+    }
+    return sum;
+}
+
+void report(const char* name, std::vector<double>& samples)
+{
+    double total = 0;
+    for (double sample : samples) {
+        total += sample;
+    }
+    std::printf("  %-28s mean %8.2f us   p99 %8.2f us\n", name, total / samples.size(),
+        percentile(samples, 99));
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t requests = argOr(argc, argv, 1, 20000);
+    uint64_t elements = argOr(argc, argv, 2, 256);
+    uint64_t lists = argOr(argc, argv, 3, 4);
+
+    std::vector<double> heapUs;
+    std::vector<double> arenaUs;
+    heapUs.reserve(requests);
+    arenaUs.reserve(requests);
+    // Room for every node of a request, so the arena never goes upstream
+    std::vector<unsigned char> buffer((elements + 1) * lists * 64);
+    uint64_t heapSum = 0;
+    uint64_t arenaSum = 0;
+    for (uint64_t request = 0; request < requests; ++request) {
+        BenchClock::time_point start = BenchClock::now();
+        {
+            std::vector<LinkedList<Record>> scoped(lists);
+            heapSum += serve(scoped.data(), lists, elements);
+        }
+        heapUs.push_back(elapsedUs(start));
+
+        start = BenchClock::now();
+        {
+            std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+            std::pmr::polymorphic_allocator<Record> allocator(&arena);
+            std::vector<pmr::LinkedList<Record>> scoped;
+            scoped.reserve(lists);
+            for (uint64_t l = 0; l < lists; ++l) {
+                scoped.emplace_back(allocator);
+            }
+            arenaSum += serve(scoped.data(), lists, elements);
+        }
+        arenaUs.push_back(elapsedUs(start));
+    }
+    keep(heapSum);
+    keep(arenaSum);
+    if (heapSum != arenaSum) {
+        std::printf("mismatch between heap and arena results\n");
+        return 1;
+    }
+    std::printf("%llu requests of %llu lists x %llu elements\n",
+        static_cast<unsigned long long>(requests), static_cast<unsigned long long>(lists),
+        static_cast<unsigned long long>(elements));
+    report("LinkedList (global heap)", heapUs);
+    report("pmr::LinkedList (monotonic)", arenaUs);
+    return 0;
+}
@@ -0,0 +1,123 @@
+// rcuReadBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Read scaling with one writer: full traversals per second by 1..maxReaders
+// reader threads, for a LinkedList behind a std::shared_mutex and for an
+// RcuLinkedList. The writer keeps removing, appending and replacing elements
+// for the whole run.
+//
+// usage: rcuReadBench [elements=1000] [maxReaders=64] [millis=200]
+#include "LinkedList.h"
+#include "RcuLinkedList.h"
+#include "benchUtil.h"
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+namespace {
+
+struct LockedList {
+    LinkedList<uint64_t> mList;
+    mutable std::shared_mutex mLock;
+
+    uint64_t traverse() const
+    {
+        std::shared_lock<std::shared_mutex> lock(mLock);
+        uint64_t sum = 0;
+        for (uint64_t value : mList) {
+            sum += value;
+        }
+        return sum;
+    }
+
+    void update(uint32_t index, uint64_t value)
+    {
+        std::unique_lock<std::shared_mutex> lock(mLock);
+        mList.remove(index);
+        mList.add(value);
+        mList.set(index, value);
+    }
+};
+
+struct RcuList {
+    RcuLinkedList<uint64_t> mList;
+
+    uint64_t traverse() const
+    {
+        RcuLinkedList<uint64_t>::ReadGuard guard = mList.read();
+        uint64_t sum = 0;
+        for (uint64_t value : guard) {
+            sum += value;
+        }
+        return sum;
+    }
+
+    void update(uint32_t index, uint64_t value)
+    {
+        mList.remove(index);
+        mList.add(value);
+        mList.set(index, value);
+    }
+};
+
+// Returns the number of traversals per second completed by readers threads
+template <typename List> double run(uint64_t elements, uint64_t readers, uint64_t millis)
+{
+    List list;
+    for (uint64_t i = 0; i < elements; ++i) {
+        list.mList.add(i);
+    }
+    std::atomic<bool> done(false);
+    std::atomic<uint64_t> traversals(0);
+    std::thread writer([&list, &done, elements]() {
+        uint32_t seed = 42;
+        uint64_t value = 0;
+        while (!done.load(std::memory_order_relaxed)) {
+            seed = seed * 1103515245U + 12345U;
+            list.update(static_cast<uint32_t>((seed >> 4) % elements), ++value);
+        }
+    });
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0; i < readers; ++i) {
+        threads.emplace_back([&list, &done, &traversals]() {
+            uint64_t count = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                keep(list.traverse());
+                ++count;
+            }
+            traversals.fetch_add(count);
+        });
+    }
+    BenchClock::time_point start = BenchClock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(millis));
+    done.store(true);
+    double us = elapsedUs(start);
+    writer.join();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    return traversals.load() / us * 1e6;
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t elements = argOr(argc, argv, 1, 1000);
+    uint64_t maxReaders = argOr(argc, argv, 2, 64);
+    uint64_t millis = argOr(argc, argv, 3, 200);
+    std::printf("%llu elements, one writer, %u hardware threads\n",
+        static_cast<unsigned long long>(elements), std::thread::hardware_concurrency());
+    std::printf("  readers  shared_mutex traversals/s      RCU traversals/s\n");
+    for (uint64_t readers = 1; readers <= maxReaders; readers *= 2) {
+        double locked = run<LockedList>(elements, readers, millis);
+        double rcu = run<RcuList>(elements, readers, millis);
+        std::printf("  %7llu  %27.0f  %20.0f\n", static_cast<unsigned long long>(readers), locked,
+            rcu);
+    }
+    return 0;
+}
@@ -0,0 +1,94 @@
+// reclaimBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Caller-side latency of tearing down large lists.
+//
+// usage: reclaimBench [elements=5000000] [rounds=50] [roundElements=200000]
+#include "LinkedList.h"
+#include "benchUtil.h"
+
+namespace {
+
+void fill(LinkedList<uint64_t>& list, uint64_t count)
+{
+    for (uint64_t i = 0; i < count; ++i) {
+        list.add(i);
+    }
+}
+
+// The teardown the list used to perform: unlink and free one node at a time
+double nodeByNodeClearUs(uint64_t count)
+{
+    LinkedList<uint64_t> list;
+    fill(list, count);
+    BenchClock::time_point start = BenchClock::now();
+    while (!list.isEmpty()) {
+        list.remove(0);
+    }
+    return elapsedUs(start);
+}
+
+double bulkClearUs(uint64_t count, LinkedListReclaimer* reclaimer)
+{
+    LinkedList<uint64_t> list;
+    list.setReclaimer(reclaimer);
+    fill(list, count);
+    BenchClock::time_point start = BenchClock::now();
+    list.clear();
+    return elapsedUs(start);
+}
+
+void reportDestructorLatency(const char* label, uint64_t rounds, uint64_t count,
+    LinkedListReclaimer* reclaimer)
+{
+    std::vector<double> samples;
+    for (uint64_t round = 0; round < rounds; ++round) {
+        BenchClock::time_point start;
+        {
+            LinkedList<uint64_t> list;
+            list.setReclaimer(reclaimer);
+            fill(list, count);
+            start = BenchClock::now();
+        }
+        samples.push_back(elapsedUs(start));
+        if (reclaimer != nullptr) {
+            // Keep the comparison about the caller, not about memory pressure
+            reclaimer->flush();
+        }
+    }
+    double p50 = percentile(samples, 50);
+    double p99 = percentile(samples, 99);
+    std::printf("%-28s p50 %10.1f us  p99 %10.1f us  max %10.1f us\n", label, p50, p99,
+        samples.back());
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t elements = argOr(argc, argv, 1, 5000000);
+    uint64_t rounds = argOr(argc, argv, 2, 50);
+    uint64_t roundElements = argOr(argc, argv, 3, 200000);
+
+    std::printf("clear() of %llu elements\n", static_cast<unsigned long long>(elements));
+    std::printf("  node-by-node unlink        %12.1f us\n", nodeByNodeClearUs(elements));
+    std::printf("  bulk detach, synchronous   %12.1f us\n", bulkClearUs(elements, nullptr));
+    {
+        LinkedListReclaimer reclaimer;
+        double callerUs = bulkClearUs(elements, &reclaimer);
+        BenchClock::time_point start = BenchClock::now();
+        reclaimer.flush();
+        std::printf("  bulk detach, deferred      %12.1f us (background %.1f us)\n", callerUs,
+            elapsedUs(start));
+    }
+
+    std::printf("\ndestructor latency, %llu rounds of %llu elements\n",
+        static_cast<unsigned long long>(rounds), static_cast<unsigned long long>(roundElements));
+    reportDestructorLatency("  synchronous", rounds, roundElements, nullptr);
+    LinkedListReclaimer reclaimer;
+    reportDestructorLatency("  deferred", rounds, roundElements, &reclaimer);
+    return 0;
+}
@@ -0,0 +1,83 @@
+// roundRobinBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Cycles through a ready list of tasks (a 64-byte record each) the three ways
+// a round-robin scheduler can use LinkedList: taking the head with get(0),
+// remove(0) and add() per step, rotate(1) per step, and a RoundRobinCursor.
+// Reports nanoseconds per step.
+//
+// usage: roundRobinBench [tasks=1000] [steps=2000000]
+#include "RoundRobinCursor.h"
+#include "benchUtil.h"
+
+namespace {
+
+struct Task {
+    uint64_t mId = 0;
+    uint64_t mRuns = 0;
+    unsigned char mState[48] = {};
+};
+
+void fill(LinkedList<Task>& list, uint64_t tasks)
+{
+    for (uint64_t i = 0; i < tasks; ++i) {
+        Task task;
+        task.mId = i;
+        list.add(task);
+    }
+}
+
+void report(const char* name, uint64_t steps, double us, uint64_t check)
+{
+    std::printf("  %-14s %8.1f ns/step  (check %llu)\n", name,
+        us * 1e3 / static_cast<double>(steps), static_cast<unsigned long long>(check));
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t tasks = argOr(argc, argv, 1, 1000);
+    uint64_t steps = argOr(argc, argv, 2, 2000000);
+    std::printf("%llu tasks of %zu bytes, %llu steps\n", static_cast<unsigned long long>(tasks),
+        sizeof(Task), static_cast<unsigned long long>(steps));
+    {
+        LinkedList<Task> list;
+        fill(list, tasks);
+        BenchClock::time_point start = BenchClock::now();
+        for (uint64_t i = 0; i < steps; ++i) {
+            Task task = list.get(0);
+            ++task.mRuns;
+            list.remove(0);
+            list.add(task);
+        }
+        double us = elapsedUs(start);
+        report("remove+add", steps, us, list.get(0).mRuns);
+    }
+    {
+        LinkedList<Task> list;
+        fill(list, tasks);
+        BenchClock::time_point start = BenchClock::now();
+        for (uint64_t i = 0; i < steps; ++i) {
+            ++list.begin()->mRuns;
+            list.rotate(1);
+        }
+        double us = elapsedUs(start);
+        report("rotate(1)", steps, us, list.get(0).mRuns);
+    }
+    {
+        LinkedList<Task> list;
+        fill(list, tasks);
+        RoundRobinCursor<Task> cursor(list);
+        BenchClock::time_point start = BenchClock::now();
+        for (uint64_t i = 0; i < steps; ++i) {
+            ++cursor.next().mRuns;
+        }
+        double us = elapsedUs(start);
+        report("cursor", steps, us, list.get(0).mRuns);
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+// selfOrganizingBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// A symbol table of string keys held in a LinkedList in random order and
+// searched with find() under Zipf-distributed access (exponent s), once for
+// every SearchPolicy. Reports the mean time and the mean number of elements
+// compared per lookup.
+//
+// usage: selfOrganizingBench [symbols=1000] [lookups=200000] [s*100=100]
+#include "LinkedList.h"
+#include "benchUtil.h"
+#include <cmath>
+#include <random>
+#include <string>
+
+namespace {
+
+struct Result {
+    double mUs = 0;
+    double mCompares = 0;
+};
+
+Result measure(const std::vector<std::string>& order, const std::vector<std::string>& symbols,
+    const std::vector<uint32_t>& lookups, SearchPolicy policy)
+{
+    LinkedList<std::string> table;
+    for (const std::string& symbol : order) {
+        table.add(symbol);
+    }
+
+    uint64_t compares = 0;
+    for (uint32_t lookup : lookups) {
+        const std::string& key = symbols[lookup];
+        table.findIf(
+            [&key, &compares](const std::string& item) {
+                ++compares;
+                return item == key;
+            },
+            policy);
+    }
+
+    Result result;
+    result.mCompares = static_cast<double>(compares) / static_cast<double>(lookups.size());
+    BenchClock::time_point start = BenchClock::now();
+    for (uint32_t lookup : lookups) {
+        keep(table.find(symbols[lookup], policy)->size());
+    }
+    result.mUs = elapsedUs(start) / static_cast<double>(lookups.size());
+    return result;
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t count = argOr(argc, argv, 1, 1000);
+    uint64_t lookupCount = argOr(argc, argv, 2, 200000);
+    double exponent = static_cast<double>(argOr(argc, argv, 3, 100)) / 100.0;
+
+    // Symbol i has Zipf rank i; the table holds the symbols in random order
+    std::vector<std::string> symbols;
+    for (uint64_t i = 0; i < count; ++i) {
+        symbols.push_back("symbol_" + std::to_string(i));
+    }
+    std::mt19937 rng(42);
+    std::vector<std::string> shuffled(symbols);
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+
+    std::vector<double> cdf;
+    double total = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        total += 1.0 / std::pow(static_cast<double>(i + 1), exponent);
+        cdf.push_back(total);
+    }
+    std::uniform_real_distribution<double> uniform(0.0, total);
+    std::vector<uint32_t> lookups;
+    for (uint64_t i = 0; i < lookupCount; ++i) {
+        auto rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+        lookups.push_back(static_cast<uint32_t>(std::min<int64_t>(rank, count - 1)));
+    }
+
+    std::printf("%llu symbols, %llu lookups, zipf s = %.2f\n",
+        static_cast<unsigned long long>(count), static_cast<unsigned long long>(lookupCount),
+        exponent);
+    const SearchPolicy policies[] = { SearchPolicy::Static, SearchPolicy::MoveToFront,
+        SearchPolicy::Transpose };
+    const char* names[] = { "static", "move-to-front", "transpose" };
+    for (size_t i = 0; i < 3; ++i) {
+        Result result = measure(shuffled, symbols, lookups, policies[i]);
+        std::printf("  %-14s %8.3f us/lookup %9.1f compares/lookup\n", names[i], result.mUs,
+            result.mCompares);
+    }
+    return 0;
+}
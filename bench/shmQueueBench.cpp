@@ -0,0 +1,164 @@
+// shmQueueBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Passes 64-byte records from one process to a forked child through a
+// SharedMemoryQueue and through a Unix domain stream socket pair (one
+// write() and one read per record). Reports records per second one way,
+// and the p50/p99 round trip in microseconds of a ping-pong where the child
+// echoes each record back (a second queue for the reply).
+//
+// usage: shmQueueBench [records=200000] [roundTrips=20000] [capacity=256]
+#include "SharedMemoryQueue.h"
+#include "benchUtil.h"
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+struct Record {
+    uint64_t mSequence;
+    unsigned char mPayload[56];
+};
+
+void writeRecord(int fd, const Record& record)
+{
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&record);
+    for (size_t done = 0; done < sizeof(Record);) {
+        ssize_t written = write(fd, bytes + done, sizeof(Record) - done);
+        if (written <= 0) {
+            _exit(1);
+        }
+        done += static_cast<size_t>(written);
+    }
+}
+
+Record readRecord(int fd)
+{
+    Record record;
+    unsigned char* bytes = reinterpret_cast<unsigned char*>(&record);
+    for (size_t done = 0; done < sizeof(Record);) {
+        ssize_t got = read(fd, bytes + done, sizeof(Record) - done);
+        if (got <= 0) {
+            _exit(1);
+        }
+        done += static_cast<size_t>(got);
+    }
+    return record;
+}
+
+void join(pid_t child)
+{
+    int status = 0;
+    waitpid(child, &status, 0);
+}
+
+void report(const char* name, uint64_t records, double throughputUs, std::vector<double>& rtts)
+{
+    std::printf("  %-7s %10.0f records/s   round trip p50 %6.1f us  p99 %6.1f us\n", name,
+        static_cast<double>(records) * 1e6 / throughputUs, percentile(rtts, 50),
+        percentile(rtts, 99));
+}
+
+void benchQueue(uint64_t records, uint64_t roundTrips, uint32_t capacity)
+{
+    std::string requests = "/shmQueueBench.req." + std::to_string(getpid());
+    std::string replies = "/shmQueueBench.rep." + std::to_string(getpid());
+    SharedMemoryQueue<Record> out = SharedMemoryQueue<Record>::create(requests, capacity);
+    SharedMemoryQueue<Record> in = SharedMemoryQueue<Record>::create(replies, capacity);
+    SharedMemoryQueue<Record>::unlink(requests);
+    SharedMemoryQueue<Record>::unlink(replies);
+
+    Record record {};
+    pid_t child = fork();
+    if (child == 0) {
+        uint64_t sum = 0;
+        for (uint64_t i = 0; i < records; ++i) {
+            sum += out.pop().mSequence;
+        }
+        in.push(Record { sum, {} });
+        for (uint64_t i = 0; i < roundTrips; ++i) {
+            in.push(out.pop());
+        }
+        _exit(0);
+    }
+    BenchClock::time_point start = BenchClock::now();
+    for (uint64_t i = 0; i < records; ++i) {
+        record.mSequence = i;
+        out.push(record);
+    }
+    keep(in.pop().mSequence);
+    double throughputUs = elapsedUs(start);
+
+    std::vector<double> rtts;
+    for (uint64_t i = 0; i < roundTrips; ++i) {
+        record.mSequence = i;
+        start = BenchClock::now();
+        out.push(record);
+        keep(in.pop().mSequence);
+        rtts.push_back(elapsedUs(start));
+    }
+    join(child);
+    report("shm", records, throughputUs, rtts);
+}
+
+void benchSocket(uint64_t records, uint64_t roundTrips)
+{
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        std::perror("socketpair");
+        return;
+    }
+    Record record {};
+    pid_t child = fork();
+    if (child == 0) {
+        close(fds[0]);
+        uint64_t sum = 0;
+        for (uint64_t i = 0; i < records; ++i) {
+            sum += readRecord(fds[1]).mSequence;
+        }
+        writeRecord(fds[1], Record { sum, {} });
+        for (uint64_t i = 0; i < roundTrips; ++i) {
+            writeRecord(fds[1], readRecord(fds[1]));
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+    BenchClock::time_point start = BenchClock::now();
+    for (uint64_t i = 0; i < records; ++i) {
+        record.mSequence = i;
+        writeRecord(fds[0], record);
+    }
+    keep(readRecord(fds[0]).mSequence);
+    double throughputUs = elapsedUs(start);
+
+    std::vector<double> rtts;
+    for (uint64_t i = 0; i < roundTrips; ++i) {
+        record.mSequence = i;
+        start = BenchClock::now();
+        writeRecord(fds[0], record);
+        keep(readRecord(fds[0]).mSequence);
+        rtts.push_back(elapsedUs(start));
+    }
+    close(fds[0]);
+    join(child);
+    report("socket", records, throughputUs, rtts);
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t records = argOr(argc, argv, 1, 200000);
+    uint64_t roundTrips = argOr(argc, argv, 2, 20000);
+    uint32_t capacity = static_cast<uint32_t>(argOr(argc, argv, 3, 256));
+    std::printf("%llu records of %zu bytes, %llu round trips, queue capacity %u\n",
+        static_cast<unsigned long long>(records), sizeof(Record),
+        static_cast<unsigned long long>(roundTrips), capacity);
+    benchQueue(records, roundTrips, capacity);
+    benchSocket(records, roundTrips);
+    return 0;
+}
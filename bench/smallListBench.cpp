@@ -0,0 +1,89 @@
+// smallListBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Heap allocations and time needed to build a list of n ints, copy it and
+// destroy both, for LinkedList and SmallLinkedList<int, 8>. Allocations are
+// counted by replacing the global operator new.
+//
+// usage: smallListBench [rounds=20000]
+#include "SmallLinkedList.h"
+#include "benchUtil.h"
+#include <new>
+
+namespace {
+
+uint64_t gAllocations = 0;
+
+struct Result {
+    uint64_t mAllocations = 0;
+    double mUs = 0;
+};
+
+template <typename List> Result measure(uint32_t size, uint64_t rounds)
+{
+    Result result;
+    uint64_t before = gAllocations;
+    {
+        List list;
+        for (uint32_t i = 0; i < size; ++i) {
+            list.add(static_cast<int>(i));
+        }
+        List copy(list);
+        keep(copy.size());
+    }
+    result.mAllocations = gAllocations - before;
+
+    BenchClock::time_point start = BenchClock::now();
+    for (uint64_t round = 0; round < rounds; ++round) {
+        List list;
+        for (uint32_t i = 0; i < size; ++i) {
+            list.add(static_cast<int>(i));
+        }
+        List copy(list);
+        keep(copy.size());
+    }
+    result.mUs = elapsedUs(start) / static_cast<double>(rounds);
+    return result;
+}
+}
+
+void* operator new(size_t bytes)
+{
+    ++gAllocations;
+    if (void* p = std::malloc(bytes == 0 ? 1 : bytes)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t rounds = argOr(argc, argv, 1, 20000);
+    const uint32_t sizes[] = { 0, 1, 2, 4, 6, 8, 9, 12, 16, 32 };
+
+    std::printf("build + copy + destroy, mean of %llu rounds\n",
+        static_cast<unsigned long long>(rounds));
+    std::printf("  %5s %22s %22s\n", "size", "LinkedList", "SmallLinkedList<8>");
+    for (uint32_t size : sizes) {
+        Result heap = measure<LinkedList<int>>(size, rounds);
+        Result small = measure<SmallLinkedList<int, 8>>(size, rounds);
+        std::printf("  %5u %6llu allocs %7.3f us %6llu allocs %7.3f us\n", size,
+            static_cast<unsigned long long>(heap.mAllocations), heap.mUs,
+            static_cast<unsigned long long>(small.mAllocations), small.mUs);
+    }
+    return 0;
+}
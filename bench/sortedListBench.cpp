@@ -0,0 +1,124 @@
+// sortedListBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Throughput of a shared sorted set at 1..maxThreads threads: a sorted
+// LinkedList behind one mutex versus ConcurrentSortedList with hand-over-hand
+// locking. Each operation is an insert, erase or lookup (20/20/60) of a random
+// key; the total number of operations is split between the threads.
+//
+// usage: sortedListBench [keys=1024] [operations=200000] [maxThreads=64]
+#include "ConcurrentSortedList.h"
+#include "LinkedList.h"
+#include "benchUtil.h"
+#include <mutex>
+#include <thread>
+
+namespace {
+
+struct LockedSortedList {
+    LinkedList<uint32_t> mList;
+    std::mutex mLock;
+
+    // Returns the index of the first value not less than key
+    uint32_t lowerBound(uint32_t key, bool& found) const
+    {
+        uint32_t index = 0;
+        for (uint32_t value : mList) {
+            if (value >= key) {
+                found = value == key;
+                return index;
+            }
+            ++index;
+        }
+        found = false;
+        return index;
+    }
+
+    bool insert(uint32_t key)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        bool found = false;
+        uint32_t index = lowerBound(key, found);
+        if (!found) {
+            mList.add(index, key);
+        }
+        return !found;
+    }
+
+    bool erase(uint32_t key)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        bool found = false;
+        uint32_t index = lowerBound(key, found);
+        if (found) {
+            mList.remove(index);
+        }
+        return found;
+    }
+
+    bool contains(uint32_t key)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        bool found = false;
+        lowerBound(key, found);
+        return found;
+    }
+};
+
+// Returns operations per second
+template <typename List> double run(uint64_t keys, uint64_t operations, uint64_t threads)
+{
+    List list;
+    for (uint64_t key = 0; key < keys; key += 2) {
+        list.insert(static_cast<uint32_t>(key));
+    }
+    uint64_t perThread = operations / threads;
+    std::vector<std::thread> workers;
+    BenchClock::time_point start = BenchClock::now();
+    for (uint64_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&list, keys, perThread, t]() {
+            uint32_t seed = static_cast<uint32_t>(t) * 7919U + 1U;
+            uint64_t hits = 0;
+            for (uint64_t i = 0; i < perThread; ++i) {
+                seed = seed * 1103515245U + 12345U;
+                uint32_t key = static_cast<uint32_t>((seed >> 4) % keys);
+                uint32_t kind = (seed >> 24) % 10;
+                if (kind < 2) {
+                    hits += list.insert(key);
+                } else if (kind < 4) {
+                    hits += list.erase(key);
+                } else {
+                    hits += list.contains(key);
+                }
+            }
+            keep(hits);
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    return perThread * threads / elapsedUs(start) * 1e6;
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t keys = argOr(argc, argv, 1, 1024);
+    uint64_t operations = argOr(argc, argv, 2, 200000);
+    uint64_t maxThreads = argOr(argc, argv, 3, 64);
+    std::printf("%llu keys, %llu operations, %u hardware threads\n",
+        static_cast<unsigned long long>(keys), static_cast<unsigned long long>(operations),
+        std::thread::hardware_concurrency());
+    std::printf("  threads   global mutex ops/s   hand-over-hand ops/s\n");
+    for (uint64_t threads = 1; threads <= maxThreads; threads *= 2) {
+        double locked = run<LockedSortedList>(keys, operations, threads);
+        double coupled = run<ConcurrentSortedList<uint32_t>>(keys, operations, threads);
+        std::printf("  %7llu  %19.0f  %21.0f\n", static_cast<unsigned long long>(threads), locked,
+            coupled);
+    }
+    return 0;
+}
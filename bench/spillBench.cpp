@@ -0,0 +1,75 @@
+// spillBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Builds a SpillingLinkedList<int64_t> four times larger than its memory
+// budget, then scans it sequentially with and without readahead and reads it
+// at random positions, printing time and the hit, miss and spill I/O
+// counters of each phase.
+//
+// usage: spillBench [elements=2000000] [segmentSize=256] [randomReads=20000]
+#include "SpillingLinkedList.h"
+#include "benchUtil.h"
+#include <random>
+
+namespace {
+
+void report(const char* phase, double us, const SpillStats& before, const SpillStats& after)
+{
+    std::printf("  %-18s %9.0f us  hits %7llu  misses %6llu  read %6llu seg %8.1f MB"
+                "  written %6llu seg %8.1f MB\n",
+        phase, us, static_cast<unsigned long long>(after.mHits - before.mHits),
+        static_cast<unsigned long long>(after.mMisses - before.mMisses),
+        static_cast<unsigned long long>(after.mSegmentsRead - before.mSegmentsRead),
+        static_cast<double>(after.mBytesRead - before.mBytesRead) / 1e6,
+        static_cast<unsigned long long>(after.mSegmentsWritten - before.mSegmentsWritten),
+        static_cast<double>(after.mBytesWritten - before.mBytesWritten) / 1e6);
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t elements = argOr(argc, argv, 1, 2000000);
+    uint32_t segmentSize = static_cast<uint32_t>(argOr(argc, argv, 2, 256));
+    uint64_t randomReads = argOr(argc, argv, 3, 20000);
+    size_t budget = elements / 4 * sizeof(LinkedListNode<int64_t>);
+
+    SpillingLinkedList<int64_t> list(budget, segmentSize);
+    std::printf("%llu elements, %zu byte budget (1/4 of the nodes), segments of %u\n",
+        static_cast<unsigned long long>(elements), budget, segmentSize);
+
+    SpillStats before = list.stats();
+    BenchClock::time_point start = BenchClock::now();
+    for (uint64_t i = 0; i < elements; ++i) {
+        list.add(static_cast<int64_t>(i));
+    }
+    report("build", elapsedUs(start), before, list.stats());
+
+    const uint32_t readaheads[] = { 0, 8 };
+    for (uint32_t readahead : readaheads) {
+        list.setReadahead(readahead);
+        before = list.stats();
+        start = BenchClock::now();
+        int64_t sum = 0;
+        for (int64_t item : list) {
+            sum += item;
+        }
+        keep(sum);
+        report(readahead == 0 ? "scan, no readahead" : "scan, readahead 8", elapsedUs(start),
+            before, list.stats());
+    }
+
+    std::mt19937 rng(3);
+    before = list.stats();
+    start = BenchClock::now();
+    int64_t sum = 0;
+    for (uint64_t i = 0; i < randomReads; ++i) {
+        sum += list.get(static_cast<uint32_t>(rng() % list.size()));
+    }
+    keep(sum);
+    report("random get", elapsedUs(start), before, list.stats());
+    return 0;
+}
@@ -0,0 +1,81 @@
+// splitLayoutBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Random index seeks over LinkedList and SplitLinkedList holding 256-byte and
+// 1KB payloads. Every seek reads one byte of the element it lands on.
+//
+// usage: splitLayoutBench [elements=20000] [seeks=2000]
+#include "LinkedList.h"
+#include "SplitLinkedList.h"
+#include "benchUtil.h"
+
+namespace {
+
+template <size_t N> struct Payload {
+    unsigned char mBytes[N];
+
+    Payload(unsigned char fill = 0)
+    {
+        std::fill(mBytes, mBytes + N, fill);
+    }
+
+    bool operator!=(const Payload<N>& rhs) const
+    {
+        return !std::equal(mBytes, mBytes + N, rhs.mBytes);
+    }
+};
+
+std::vector<uint32_t> makeIndices(uint32_t size, uint64_t count)
+{
+    std::vector<uint32_t> indices;
+    uint32_t seed = 42;
+    for (uint64_t i = 0; i < count; ++i) {
+        seed = seed * 1103515245U + 12345U;
+        indices.push_back((seed >> 4) % size);
+    }
+    return indices;
+}
+
+template <typename List> double seekUs(const List& list, const std::vector<uint32_t>& indices)
+{
+    uint64_t sum = 0;
+    BenchClock::time_point start = BenchClock::now();
+    for (uint32_t index : indices) {
+        sum += list.get(index).mBytes[0];
+    }
+    double us = elapsedUs(start);
+    keep(sum);
+    return us;
+}
+
+template <size_t N> void run(uint64_t elements, uint64_t seeks)
+{
+    LinkedList<Payload<N>> nodes;
+    SplitLinkedList<Payload<N>> split;
+    for (uint64_t i = 0; i < elements; ++i) {
+        nodes.add(Payload<N>(static_cast<unsigned char>(i)));
+        split.add(Payload<N>(static_cast<unsigned char>(i)));
+    }
+    std::vector<uint32_t> indices = makeIndices(static_cast<uint32_t>(elements), seeks);
+    double nodeUs = seekUs(nodes, indices);
+    double splitUs = seekUs(split, indices);
+    std::printf("%zu-byte payload, %llu elements, %llu seeks\n", N,
+        static_cast<unsigned long long>(elements), static_cast<unsigned long long>(seeks));
+    std::printf("  LinkedList       %12.0f seeks/s\n", seeks / nodeUs * 1e6);
+    std::printf("  SplitLinkedList  %12.0f seeks/s (%.1fx)\n", seeks / splitUs * 1e6,
+        nodeUs / splitUs);
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t elements = argOr(argc, argv, 1, 20000);
+    uint64_t seeks = argOr(argc, argv, 2, 2000);
+    run<256>(elements, seeks);
+    run<1024>(elements, seeks);
+    return 0;
+}
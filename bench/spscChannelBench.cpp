@@ -0,0 +1,140 @@
+// spscChannelBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// One producer thread hands timestamped messages to one consumer thread:
+// LinkedList add()/remove(0) under a mutex, SpscChannel push/tryPop one at a
+// time, and SpscChannel pushBatch/popBatch. Reports messages per second and
+// the p50/p99 handoff latency (time from push to pop) in microseconds.
+//
+// usage: spscChannelBench [messages=1000000] [batch=64]
+#include "LinkedList.h"
+#include "SpscChannel.h"
+#include "benchUtil.h"
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+uint64_t nowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        BenchClock::now().time_since_epoch())
+                                     .count());
+}
+
+struct LockedList {
+    LinkedList<uint64_t> mList;
+    std::mutex mLock;
+
+    void send(const uint64_t* first, const uint64_t* last)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        for (; first != last; ++first) {
+            mList.add(*first);
+        }
+    }
+
+    size_t receive(std::vector<uint64_t>& out, size_t)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        if (mList.isEmpty()) {
+            return 0;
+        }
+        out.push_back(mList.get(0));
+        mList.remove(0);
+        return 1;
+    }
+};
+
+struct SingleChannel {
+    SpscChannel<uint64_t> mChannel;
+
+    void send(const uint64_t* first, const uint64_t* last)
+    {
+        for (; first != last; ++first) {
+            mChannel.push(*first);
+        }
+    }
+
+    size_t receive(std::vector<uint64_t>& out, size_t)
+    {
+        uint64_t value = 0;
+        if (!mChannel.tryPop(value)) {
+            return 0;
+        }
+        out.push_back(value);
+        return 1;
+    }
+};
+
+struct BatchChannel {
+    SpscChannel<uint64_t> mChannel;
+
+    void send(const uint64_t* first, const uint64_t* last)
+    {
+        mChannel.pushBatch(first, last);
+    }
+
+    size_t receive(std::vector<uint64_t>& out, size_t batch)
+    {
+        return mChannel.popBatch(std::back_inserter(out), batch);
+    }
+};
+
+// Every message carries its send time. The producer sends batch messages at a
+// time (the single-element variants simply loop over them).
+template <typename Channel> void run(const char* name, uint64_t messages, uint64_t batch)
+{
+    Channel channel;
+    BenchClock::time_point start = BenchClock::now();
+    std::thread producer([&channel, messages, batch]() {
+        std::vector<uint64_t> stamps(batch);
+        for (uint64_t sent = 0; sent < messages; sent += batch) {
+            size_t count = static_cast<size_t>(std::min(batch, messages - sent));
+            uint64_t stamp = nowNs();
+            std::fill(stamps.begin(), stamps.begin() + count, stamp);
+            channel.send(stamps.data(), stamps.data() + count);
+        }
+    });
+    std::vector<double> latencies;
+    latencies.reserve(static_cast<size_t>(messages));
+    std::vector<uint64_t> received;
+    uint64_t done = 0;
+    while (done < messages) {
+        received.clear();
+        if (channel.receive(received, static_cast<size_t>(batch)) == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        uint64_t now = nowNs();
+        for (uint64_t stamp : received) {
+            latencies.push_back(static_cast<double>(now - stamp) / 1000.0);
+        }
+        done += received.size();
+    }
+    double us = elapsedUs(start);
+    producer.join();
+    double p50 = percentile(latencies, 50);
+    double p99 = percentile(latencies, 99);
+    std::printf("  %-26s %12.0f msgs/s   p50 %9.1f us   p99 %9.1f us\n", name,
+        messages / us * 1e6, p50, p99);
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t messages = argOr(argc, argv, 1, 1000000);
+    uint64_t batch = argOr(argc, argv, 2, 64);
+    std::printf("%llu messages, producer batches of %llu, %u hardware threads\n",
+        static_cast<unsigned long long>(messages), static_cast<unsigned long long>(batch),
+        std::thread::hardware_concurrency());
+    run<LockedList>("mutex + LinkedList", messages, batch);
+    run<SingleChannel>("SpscChannel push/tryPop", messages, batch);
+    run<BatchChannel>("SpscChannel batch", messages, batch);
+    return 0;
+}
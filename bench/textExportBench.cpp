@@ -0,0 +1,97 @@
+// textExportBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Writes a LinkedList of random integers and one of random doubles to a file
+// as text and reads them back, once through iostreams (std::copy to an
+// std::ostream_iterator on an std::ofstream, operator>> from an
+// std::ifstream) and once with toText/fromText. Reports MB/s of text in
+// each direction and checks that the list read back equals the original.
+//
+// usage: textExportBench [elements=1000000] [path=/tmp/textExportBench.txt]
+#include "LinkedListText.h"
+#include "benchUtil.h"
+#include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <unistd.h>
+
+namespace {
+
+void report(
+    const char* name, const char* type, double bytes, double writeUs, double readUs, bool same)
+{
+    std::printf("  %-9s %-7s write %8.1f MB/s  read %8.1f MB/s%s\n", name, type, bytes / writeUs,
+        bytes / readUs, same ? "" : "  MISMATCH");
+}
+
+template <typename T>
+void benchStreams(const LinkedList<T>& list, const char* type, const char* path)
+{
+    BenchClock::time_point start = BenchClock::now();
+    {
+        std::ofstream out(path);
+        out.precision(std::numeric_limits<T>::max_digits10);
+        std::copy(list.begin(), list.end(), std::ostream_iterator<T>(out, "\n"));
+    }
+    double writeUs = elapsedUs(start);
+
+    LinkedList<T> read;
+    start = BenchClock::now();
+    {
+        std::ifstream in(path);
+        T value {};
+        while (in >> value) {
+            read.add(value);
+        }
+    }
+    double readUs = elapsedUs(start);
+    std::ifstream size(path, std::ios::ate | std::ios::binary);
+    report("iostream", type, static_cast<double>(size.tellg()), writeUs, readUs, read == list);
+}
+
+template <typename T>
+void benchText(const LinkedList<T>& list, const char* type, const char* path)
+{
+    BenchClock::time_point start = BenchClock::now();
+    int fd = open(path, O_CREAT | O_TRUNC | O_WRONLY, 0600);
+    toText(list, fd);
+    close(fd);
+    double writeUs = elapsedUs(start);
+
+    LinkedList<T> read;
+    start = BenchClock::now();
+    fd = open(path, O_RDONLY);
+    fromText(read, fd);
+    double bytes = static_cast<double>(lseek(fd, 0, SEEK_END));
+    close(fd);
+    double readUs = elapsedUs(start);
+    report("toText", type, bytes, writeUs, readUs, read == list);
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t elements = argOr(argc, argv, 1, 1000000);
+    const char* path = argc > 2 ? argv[2] : "/tmp/textExportBench.txt";
+    std::mt19937_64 random(1);
+    LinkedList<int64_t> integers;
+    LinkedList<double> reals;
+    std::uniform_real_distribution<double> real(-1e6, 1e6);
+    for (uint64_t i = 0; i < elements; ++i) {
+        integers.add(static_cast<int64_t>(random()) >> (random() % 64));
+        reals.add(real(random));
+    }
+    std::printf("%llu elements\n", static_cast<unsigned long long>(elements));
+    benchStreams(integers, "int64", path);
+    benchText(integers, "int64", path);
+    benchStreams(reals, "double", path);
+    benchText(reals, "double", path);
+    unlink(path);
+    return 0;
+}
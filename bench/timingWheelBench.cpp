@@ -0,0 +1,183 @@
+// timingWheelBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Schedules timers with random deadlines within horizon ticks, cancels one
+// in ten of them and then advances the clock past the horizon, expiring the
+// rest. Compares TimingWheel, an std::priority_queue (cancellation marks the
+// timer and the heap skips it when it surfaces) and a LinkedList kept sorted
+// by deadline (insertion and cancellation walk the list). Reports the mean
+// time per schedule, cancel and expiry in nanoseconds.
+//
+// The sorted list needs time proportional to the number of pending timers
+// for every operation, so it is run with sortedTimers timers only.
+//
+// usage: timingWheelBench [timers=1000000] [horizon=1048576] [sortedTimers=20000]
+#include "LinkedList.h"
+#include "TimingWheel.h"
+#include "benchUtil.h"
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+
+namespace {
+
+struct Workload {
+    std::vector<uint64_t> mDeadlines;
+    std::vector<uint32_t> mCancelled;
+    uint64_t mHorizon;
+};
+
+Workload makeWorkload(uint32_t timers, uint64_t horizon)
+{
+    std::mt19937_64 random(42);
+    Workload work { {}, {}, horizon };
+    for (uint32_t i = 0; i < timers; ++i) {
+        work.mDeadlines.push_back(1 + random() % horizon);
+    }
+    for (uint32_t i = 0; i < timers / 10; ++i) {
+        work.mCancelled.push_back(static_cast<uint32_t>(random() % timers));
+    }
+    // Each timer is cancelled at most once
+    std::sort(work.mCancelled.begin(), work.mCancelled.end());
+    work.mCancelled.erase(
+        std::unique(work.mCancelled.begin(), work.mCancelled.end()), work.mCancelled.end());
+    std::shuffle(work.mCancelled.begin(), work.mCancelled.end(), random);
+    return work;
+}
+
+void report(const char* name, const Workload& work, double scheduleUs, double cancelUs,
+    double expireUs, uint64_t expired)
+{
+    double timers = static_cast<double>(work.mDeadlines.size());
+    std::printf("  %-10s %9.0f timers  schedule %9.1f ns  cancel %9.1f ns  expire %9.1f ns\n",
+        name, timers, scheduleUs * 1e3 / timers,
+        cancelUs * 1e3 / static_cast<double>(work.mCancelled.size()),
+        expireUs * 1e3 / static_cast<double>(expired));
+    if (expired + work.mCancelled.size() != work.mDeadlines.size()) {
+        std::printf("  %s lost timers\n", name);
+    }
+}
+
+void benchWheel(const Workload& work)
+{
+    TimingWheel<uint32_t> wheel;
+    std::vector<TimingWheel<uint32_t>::Handle> handles;
+    handles.reserve(work.mDeadlines.size());
+    BenchClock::time_point start = BenchClock::now();
+    for (uint32_t i = 0; i < work.mDeadlines.size(); ++i) {
+        handles.push_back(wheel.schedule(work.mDeadlines[i], i));
+    }
+    double scheduleUs = elapsedUs(start);
+
+    start = BenchClock::now();
+    for (uint32_t id : work.mCancelled) {
+        wheel.cancel(handles[id]);
+    }
+    double cancelUs = elapsedUs(start);
+
+    uint64_t expired = 0;
+    uint64_t sum = 0;
+    start = BenchClock::now();
+    wheel.advance(work.mHorizon, [&expired, &sum](uint32_t& id) {
+        ++expired;
+        sum += id;
+    });
+    double expireUs = elapsedUs(start);
+    keep(sum);
+    report("wheel", work, scheduleUs, cancelUs, expireUs, expired);
+}
+
+void benchHeap(const Workload& work)
+{
+    using Entry = std::pair<uint64_t, uint32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    std::vector<bool> cancelled(work.mDeadlines.size(), false);
+    BenchClock::time_point start = BenchClock::now();
+    for (uint32_t i = 0; i < work.mDeadlines.size(); ++i) {
+        heap.emplace(work.mDeadlines[i], i);
+    }
+    double scheduleUs = elapsedUs(start);
+
+    start = BenchClock::now();
+    for (uint32_t id : work.mCancelled) {
+        cancelled[id] = true;
+    }
+    double cancelUs = elapsedUs(start);
+
+    uint64_t expired = 0;
+    uint64_t sum = 0;
+    start = BenchClock::now();
+    for (uint64_t now = 1; now <= work.mHorizon; ++now) {
+        while (!heap.empty() && heap.top().first <= now) {
+            uint32_t id = heap.top().second;
+            heap.pop();
+            if (!cancelled[id]) {
+                ++expired;
+                sum += id;
+            }
+        }
+    }
+    double expireUs = elapsedUs(start);
+    keep(sum);
+    report("heap", work, scheduleUs, cancelUs, expireUs, expired);
+}
+
+void benchSortedList(const Workload& work)
+{
+    using Entry = std::pair<uint64_t, uint32_t>;
+    LinkedList<Entry> list;
+    BenchClock::time_point start = BenchClock::now();
+    for (uint32_t i = 0; i < work.mDeadlines.size(); ++i) {
+        Entry entry(work.mDeadlines[i], i);
+        uint32_t index = 0;
+        for (const Entry& timer : static_cast<const LinkedList<Entry>&>(list)) {
+            if (timer.first > entry.first) {
+                break;
+            }
+            ++index;
+        }
+        list.add(index, entry);
+    }
+    double scheduleUs = elapsedUs(start);
+
+    start = BenchClock::now();
+    for (uint32_t id : work.mCancelled) {
+        list.erase(list.findIf([id](const Entry& timer) { return timer.second == id; }));
+    }
+    double cancelUs = elapsedUs(start);
+
+    uint64_t expired = 0;
+    uint64_t sum = 0;
+    start = BenchClock::now();
+    for (uint64_t now = 1; now <= work.mHorizon; ++now) {
+        while (!list.isEmpty() && list.get(0).first <= now) {
+            ++expired;
+            sum += list.get(0).second;
+            list.remove(0);
+        }
+    }
+    double expireUs = elapsedUs(start);
+    keep(sum);
+    report("sorted", work, scheduleUs, cancelUs, expireUs, expired);
+}
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t timers = static_cast<uint32_t>(argOr(argc, argv, 1, 1000000));
+    uint64_t horizon = argOr(argc, argv, 2, 1048576);
+    uint32_t sortedTimers = static_cast<uint32_t>(argOr(argc, argv, 3, 20000));
+    std::printf("deadlines within %llu ticks, one timer in ten cancelled\n",
+        static_cast<unsigned long long>(horizon));
+    Workload work = makeWorkload(timers, horizon);
+    benchWheel(work);
+    benchHeap(work);
+    benchSortedList(makeWorkload(sortedTimers, horizon));
+    return 0;
+}
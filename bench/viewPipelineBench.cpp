@@ -0,0 +1,139 @@
+// viewPipelineBench.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Runs a four-stage pipeline (filter, transform, filter, transform) over a
+// LinkedList<int64_t> and sums the result, once by copying every stage into
+// a new LinkedList and once through LinkedListView adaptors. Reports the
+// nanoseconds per input element and the number of heap allocations per run
+// (counted through the global operator new, which is replaced here).
+//
+// usage: viewPipelineBench [elements=1000000] [runs=10]
+#include "LinkedList.h"
+#include "LinkedListView.h"
+#include "benchUtil.h"
+#include <new>
+
+namespace {
+
+uint64_t gAllocations = 0;
+
+bool isOdd(int64_t value)
+{
+    return value % 2 != 0;
+}
+
+int64_t triple(int64_t value)
+{
+    return value * 3;
+}
+
+bool notFifth(int64_t value)
+{
+    return value % 5 != 0;
+}
+
+int64_t offset(int64_t value)
+{
+    return value + 7;
+}
+
+// Each stage builds a new list from the previous one
+int64_t copyPerStage(const LinkedList<int64_t>& list)
+{
+    LinkedList<int64_t> odd;
+    for (int64_t value : list) {
+        if (isOdd(value)) {
+            odd.add(value);
+        }
+    }
+    LinkedList<int64_t> tripled;
+    for (int64_t value : odd) {
+        tripled.add(triple(value));
+    }
+    LinkedList<int64_t> kept;
+    for (int64_t value : tripled) {
+        if (notFifth(value)) {
+            kept.add(value);
+        }
+    }
+    LinkedList<int64_t> shifted;
+    for (int64_t value : kept) {
+        shifted.add(offset(value));
+    }
+    int64_t sum = 0;
+    for (int64_t value : shifted) {
+        sum += value;
+    }
+    return sum;
+}
+
+int64_t viewed(const LinkedList<int64_t>& list)
+{
+    auto pipeline = sublist(list.begin(), list.end())
+                        .filtered(isOdd)
+                        .transformed(triple)
+                        .filtered(notFifth)
+                        .transformed(offset);
+    int64_t sum = 0;
+    for (int64_t value : pipeline) {
+        sum += value;
+    }
+    return sum;
+}
+
+template <typename Pipeline>
+void bench(const char* name, const LinkedList<int64_t>& list, uint64_t runs, Pipeline pipeline)
+{
+    int64_t sum = 0;
+    uint64_t allocations = gAllocations;
+    BenchClock::time_point start = BenchClock::now();
+    for (uint64_t run = 0; run < runs; ++run) {
+        sum += pipeline(list);
+    }
+    double us = elapsedUs(start);
+    allocations = gAllocations - allocations;
+    keep(sum);
+    std::printf("  %-14s %8.2f ns/element  %10.0f allocations/run  (sum %lld)\n", name,
+        us * 1e3 / static_cast<double>(runs * list.size()),
+        static_cast<double>(allocations) / static_cast<double>(runs),
+        static_cast<long long>(sum));
+}
+}
+
+void* operator new(size_t bytes)
+{
+    ++gAllocations;
+    if (void* p = std::malloc(bytes == 0 ? 1 : bytes)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t elements = argOr(argc, argv, 1, 1000000);
+    uint64_t runs = argOr(argc, argv, 2, 10);
+    LinkedList<int64_t> list;
+    for (uint64_t i = 0; i < elements; ++i) {
+        list.add(static_cast<int64_t>(i));
+    }
+    std::printf("%llu elements, %llu runs\n", static_cast<unsigned long long>(elements),
+        static_cast<unsigned long long>(runs));
+    bench("copy per stage", list, runs, copyPerStage);
+    bench("views", list, runs, viewed);
+    return 0;
+}
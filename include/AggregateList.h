@@ -0,0 +1,366 @@
+// AggregateList.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef AGGREGATE_LIST_H
+#define AGGREGATE_LIST_H
+
+#include "LinkedList.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+/**
+ * Monoids for use with AggregateList. A monoid provides an identity element
+ * and an associative combine operation; combine need not be commutative, the
+ * aggregate of a range always combines its elements in list order.
+ */
+template <typename T> struct SumMonoid {
+    static T identity()
+    {
+        return T();
+    }
+
+    static T combine(const T& lhs, const T& rhs)
+    {
+        return lhs + rhs;
+    }
+};
+
+template <typename T> struct MinMonoid {
+    static T identity()
+    {
+        return std::numeric_limits<T>::max();
+    }
+
+    static T combine(const T& lhs, const T& rhs)
+    {
+        return std::min(lhs, rhs);
+    }
+};
+
+template <typename T> struct MaxMonoid {
+    static T identity()
+    {
+        return std::numeric_limits<T>::lowest();
+    }
+
+    static T combine(const T& lhs, const T& rhs)
+    {
+        return std::max(lhs, rhs);
+    }
+};
+
+/**
+ * A list that keeps the aggregate of its elements under Monoid up to date as it
+ * is modified, so that the aggregate of the whole list and of any index range
+ * is available in expected logarithmic time.
+ *
+ * The elements live in the same circular, dummy-terminated chain of
+ * LinkedListNodes that LinkedList uses, which makes iteration identical to
+ * LinkedList's. Each node additionally acts as a vertex of a treap (a
+ * randomized balanced binary tree) ordered by position: every vertex caches
+ * the number of elements in its subtree and the aggregate of those elements.
+ * This segment layer is what turns positional access, insertion and removal
+ * into expected O(log n) operations and lets removals of, say, the current
+ * minimum be accounted for without rescanning the list.
+ *
+ * Relinking vertices never copies an element or calls the monoid: it only
+ * updates subtree sizes and marks the vertices whose cached aggregate is
+ * stale. The marked vertices (always the top of the tree) are recomputed by
+ * the next call to aggregate(), so T and Monoid make no assumptions beyond
+ * those of LinkedList, and an exception from either leaves the list as it
+ * was. Because aggregate() updates this cache, an AggregateList must not be
+ * read from several threads at once without synchronization.
+ *
+ * Only constant iterators are provided, since writing through an iterator
+ * would bypass the aggregates; use set() instead.
+ */
+template <typename T, typename Monoid = SumMonoid<T>> class AggregateList {
+public:
+    // typedefs for interoperability/compatibility with STL containers
+    using value_type = T;
+    using const_iterator = LinkedListConstIterator<T>;
+
+    /**
+     * Initializes an empty AggregateList.
+     * This operation provides strong exception safety.
+     */
+    AggregateList();
+
+    /**
+     * Initializes the AggregateList to be a copy of src.
+     * This operation provides strong exception safety.
+     *
+     * @param src AggregateList to copy
+     */
+    AggregateList(const AggregateList<T, Monoid>& src);
+
+    /**
+     * Makes this object a copy of rhs. Note that calling this method on
+     * yourself (l = l;) is equivalent to a no-op.
+     * This operation provides strong exception safety.
+     *
+     * @param rhs AggregateList to copy
+     * @return *this, used for chaining.
+     */
+    AggregateList<T, Monoid>& operator=(const AggregateList<T, Monoid>& rhs);
+
+    /**
+     * Destructor. Releases all resources held by this AggregateList.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     */
+    ~AggregateList() noexcept;
+
+    /**
+     * Adds value to the end of this AggregateList in expected logarithmic
+     * time.
+     * This operation provides strong exception safety.
+     *
+     * @param value value to append to this AggregateList
+     */
+    void add(const T& value);
+
+    /**
+     * Inserts value at the specified index. All elements at or to the right of
+     * index are shifted down by one spot. If this AggregateList needs to be
+     * enlarged (index is out of range) default values are used to fill the
+     * gaps, as in LinkedList.
+     * This operation provides strong exception safety.
+     *
+     * @param index index at which to insert value
+     * @param value the element to insert
+     */
+    void add(uint32_t index, const T& value);
+
+    /**
+     * Empties this AggregateList returning it to the same state as the default
+     * constructor.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     */
+    void clear() noexcept;
+
+    /**
+     * Returns a constant reference to the element stored at the provided index
+     * in expected logarithmic time. If index is out of bounds, an
+     * std::out_of_range exception is thrown with the index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the element to return
+     * @return constant reference to the element at the index.
+     */
+    const T& get(uint32_t index) const;
+
+    /**
+     * Sets the element at the specified index to the provided value and
+     * updates the aggregates that cover it. If index is out of bounds, an
+     * std::out_of_range exception is thrown with the index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the object to set
+     * @param value the new value
+     */
+    void set(uint32_t index, const T& value);
+
+    /**
+     * Removes the element at the specified index. If index is out of bounds
+     * an std::out_of_range exception is thrown with index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the object to remove.
+     */
+    void remove(uint32_t index);
+
+    /**
+     * Returns the aggregate of all elements in list order, or the identity of
+     * the monoid if this AggregateList is empty. Constant time, unless the
+     * list was modified since the last call, which first recomputes the
+     * stale aggregates (expected logarithmic time per modification).
+     * This operation provides strong exception safety.
+     *
+     * @return aggregate of the whole list
+     */
+    T aggregate() const;
+
+    /**
+     * Returns the aggregate of the elements with indices in [first, last) in
+     * expected logarithmic time. An empty range yields the identity. If
+     * first > last or last > size(), an std::out_of_range exception is thrown
+     * with the offending index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param first index of the first element of the range
+     * @param last index one past the last element of the range
+     * @return aggregate of the range
+     */
+    T aggregate(uint32_t first, uint32_t last) const;
+
+    /**
+     * Returns a constant iterator to the beginning.
+     * This operation is a no-throw.
+     *
+     * @return const_iterator
+     */
+    const_iterator begin() const noexcept;
+
+    /**
+     * Returns a constant iterator to the end.
+     * This operation is a no-throw.
+     *
+     * @return const_iterator
+     */
+    const_iterator end() const noexcept;
+
+    /**
+     * Returns true if this AggregateList is empty and false otherwise.
+     * This operation is a no-throw.
+     *
+     * @return bool True when empty
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * Return the size of this AggregateList.
+     * This operation is a no-throw.
+     *
+     * @return
+     */
+    uint32_t size() const noexcept;
+
+private:
+    /**
+     * A list node that doubles as a treap vertex.
+     */
+    struct Node : public LinkedListNode<T> {
+        Node(const T& item, uint32_t priority);
+
+        T mAgg;
+        Node* mLeft;
+        Node* mRight;
+        uint32_t mWeight;
+        uint32_t mPriority;
+        bool mStale;
+    };
+
+    /**
+     * Given an index, this method throws an std::out_of_range with the index as
+     * its message if index is out of bounds or is a no-op otherwise.
+     * This operation provides strong exception safety.
+     *
+     * @param index index to check
+     */
+    void rangeCheck(uint32_t index) const;
+
+    /**
+     * Returns the node at the given (valid) index.
+     * This operation is a no-throw.
+     *
+     * @param index index of the node
+     * @return node at index
+     */
+    Node* nodeAt(uint32_t index) const noexcept;
+
+    /**
+     * Creates an unlinked node holding value with a fresh random priority.
+     * This operation provides strong exception safety.
+     *
+     * @param value value to store
+     * @return the new node
+     */
+    std::unique_ptr<Node> makeNode(const T& value);
+
+    /**
+     * Links node into both layers so that it ends up at index.
+     * This operation is a no-throw.
+     *
+     * @param index index of the inserted node, at most size()
+     * @param node unlinked node to insert
+     */
+    void insertNode(uint32_t index, Node* node) noexcept;
+
+    /**
+     * Returns the number of elements in the subtree rooted at node.
+     * This operation is a no-throw.
+     */
+    static uint32_t weight(const Node* node) noexcept;
+
+    /**
+     * Recomputes the cached weight of node from its children and marks its
+     * aggregate stale.
+     * This operation is a no-throw.
+     */
+    static void pull(Node* node) noexcept;
+
+    /**
+     * Recomputes the stale aggregates in the subtree rooted at node. A
+     * vertex is only unmarked once its aggregate has been stored, so an
+     * exception leaves the remaining ones marked.
+     * This operation provides strong exception safety.
+     */
+    static void refresh(Node* node);
+
+    /**
+     * Splits the treap rooted at node into the first count elements (left)
+     * and the rest (right).
+     * This operation is a no-throw.
+     */
+    static void split(Node* node, uint32_t count, Node*& left, Node*& right) noexcept;
+
+    /**
+     * Concatenates the treaps rooted at left and right and returns the root.
+     * This operation is a no-throw.
+     */
+    static Node* merge(Node* left, Node* right) noexcept;
+
+    /**
+     * Marks the aggregates on the path from node down to the element at
+     * index stale.
+     * This operation is a no-throw.
+     */
+    static void touch(Node* node, uint32_t index) noexcept;
+
+    /**
+     * Returns the aggregate of the elements with indices in [first, last) of
+     * the subtree rooted at node, whose aggregates must be up to date.
+     */
+    static T query(const Node* node, uint32_t first, uint32_t last);
+
+    /**
+     * Returns the next pseudo-random treap priority.
+     * This operation is a no-throw.
+     */
+    uint32_t nextPriority() noexcept;
+
+    /**
+     * Swaps the contents of this AggregateList with that of other in constant
+     * time.
+     * This operation is a no-throw.
+     *
+     * @param other the AggregateList to swap with
+     */
+    void swap(AggregateList<T, Monoid>& other) noexcept;
+
+    /**
+     * (unique) pointer to the dummy node of the list layer.
+     */
+    std::unique_ptr<LinkedListNode<T>> mTail;
+
+    /**
+     * Root of the segment layer, nullptr when the list is empty.
+     */
+    Node* mRoot;
+
+    /**
+     * State of the xorshift generator used for treap priorities.
+     */
+    uint32_t mSeed;
+};
+
+#include "../src/AggregateList.cpp"
+
+#endif // AGGREGATE_LIST_H
@@ -0,0 +1,290 @@
+// CompressedSequence.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef COMPRESSED_SEQUENCE_H
+#define COMPRESSED_SEQUENCE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+template <typename T, uint32_t B> class CompressedSequenceIterator;
+
+/**
+ * A sequence of integers stored compactly, for long lists of sorted IDs,
+ * timestamps and the like, where a LinkedList spends about 40 bytes of node
+ * on every 8 bytes of payload.
+ *
+ * The elements are kept in blocks of at most B elements. A block stores each
+ * element as the difference from its predecessor in the block (the first one
+ * as the difference from 0), zigzag-mapped so that small negative steps stay
+ * small, as a varint: 7 bits per byte, the high bit marking that another byte
+ * follows. Sorted data with small gaps therefore takes one or two bytes per
+ * element. Every block also remembers its last value, so appending does not
+ * decode anything.
+ *
+ * Elements are decoded on the fly: iteration reads each byte once, get()
+ * skips whole blocks and decodes within one, and add(index, value) and
+ * remove() decode and re-encode the one block they change, splitting it when
+ * it outgrows B elements and dropping it when it becomes empty. Since the
+ * elements only exist encoded, get() and the iterators return them by value.
+ *
+ * Unlike LinkedList, add(index, value) does not fill gaps: an index past the
+ * end is out of range.
+ */
+template <typename T, uint32_t B = 128> class CompressedSequence {
+public:
+    static_assert(std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t),
+        "CompressedSequence stores integers of at most 64 bits");
+    static_assert(B > 1, "a block must hold more than one element");
+
+    using value_type = T;
+    using const_iterator = CompressedSequenceIterator<T, B>;
+
+    /**
+     * Initializes an empty CompressedSequence.
+     * This operation is a no-throw.
+     */
+    CompressedSequence() noexcept;
+
+    /**
+     * Adds value to the end of this CompressedSequence in constant time.
+     * This operation provides strong exception safety.
+     *
+     * @param value value to append
+     */
+    void add(T value);
+
+    /**
+     * Inserts value at the specified index, shifting the elements at or to the
+     * right of index down by one spot. Only the block holding index is
+     * decoded and re-encoded. If index is greater than size(), an
+     * std::out_of_range exception is thrown with the index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index at which to insert value
+     * @param value the element to insert
+     */
+    void add(uint32_t index, T value);
+
+    /**
+     * Empties this CompressedSequence and frees its blocks.
+     * This operation is a no-throw.
+     */
+    void clear() noexcept;
+
+    /**
+     * Returns the element stored at the provided index. If index is out of
+     * bounds, an std::out_of_range exception is thrown with the index as its
+     * message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the element to return
+     * @return the element at the index
+     */
+    T get(uint32_t index) const;
+
+    /**
+     * Removes the element at the specified index. Only the block holding it
+     * is decoded and re-encoded. If index is out of bounds an
+     * std::out_of_range exception is thrown with index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the element to remove
+     */
+    void remove(uint32_t index);
+
+    /**
+     * Returns true if and only if this CompressedSequence holds the same
+     * elements as rhs, in the same order.
+     * This operation is a no-throw.
+     *
+     * @param rhs the CompressedSequence being compared to
+     * @return true iff logically equivalent
+     */
+    bool operator==(const CompressedSequence<T, B>& rhs) const noexcept;
+
+    /**
+     * Returns false if this CompressedSequence is equal to rhs and true
+     * otherwise.
+     * This operation is a no-throw.
+     *
+     * @param rhs the CompressedSequence being compared to
+     * @return true iff not logically equivalent
+     */
+    bool operator!=(const CompressedSequence<T, B>& rhs) const noexcept;
+
+    /**
+     * Returns an iterator to the beginning.
+     * This operation is a no-throw.
+     *
+     * @return const_iterator
+     */
+    const_iterator begin() const noexcept;
+
+    /**
+     * Returns an iterator to the end.
+     * This operation is a no-throw.
+     *
+     * @return const_iterator
+     */
+    const_iterator end() const noexcept;
+
+    /**
+     * Returns true if this CompressedSequence is empty and false otherwise.
+     * This operation is a no-throw.
+     *
+     * @return bool True when empty
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * Return the size of this CompressedSequence.
+     * This operation is a no-throw.
+     *
+     * @return
+     */
+    uint32_t size() const noexcept;
+
+    /**
+     * Returns the number of bytes this CompressedSequence occupies, itself
+     * and the capacity of everything it allocated included.
+     * This operation is a no-throw.
+     *
+     * @return bytes in use
+     */
+    size_t memoryUsage() const noexcept;
+
+private:
+    friend class CompressedSequenceIterator<T, B>;
+
+    /**
+     * Up to B consecutive elements, delta and varint encoded.
+     */
+    struct Block {
+        std::vector<uint8_t> mBytes;
+        T mLast;
+        uint32_t mCount;
+    };
+
+    /**
+     * Longest varint of a 64-bit value.
+     */
+    static constexpr size_t kMaxVarint = 10;
+
+    /**
+     * Writes the varint of the zigzag-mapped difference value - prev to out
+     * and returns the number of bytes written.
+     * This operation is a no-throw.
+     *
+     * @param prev preceding element (0 for the first element of a block)
+     * @param value element to encode
+     * @param out buffer of at least kMaxVarint bytes
+     * @return bytes written
+     */
+    static size_t encode(T prev, T value, uint8_t* out) noexcept;
+
+    /**
+     * Reads the element following prev at cursor and advances cursor past it.
+     * This operation is a no-throw.
+     *
+     * @param prev preceding element (0 for the first element of a block)
+     * @param cursor position of the element's varint
+     * @return the element
+     */
+    static T decode(T prev, const uint8_t*& cursor) noexcept;
+
+    /**
+     * Returns the elements of block.
+     * This operation provides strong exception safety.
+     *
+     * @param block block to decode
+     * @return its elements in order
+     */
+    static std::vector<T> unpack(const Block& block);
+
+    /**
+     * Returns a block holding the elements [first, last).
+     * This operation provides strong exception safety.
+     *
+     * @param first first element
+     * @param last one past the last element
+     * @return the encoded block
+     */
+    static Block pack(const T* first, const T* last);
+
+    /**
+     * Returns the position of the block holding the element at index and
+     * reduces index to the element's offset within that block.
+     * This operation is a no-throw.
+     *
+     * @pre index < size()
+     * @param index index of the element; receives its offset in the block
+     * @return position of the block in mBlocks
+     */
+    size_t seek(uint32_t& index) const noexcept;
+
+    /**
+     * Given an index, this method throws an std::out_of_range with the index as
+     * its message if index is out of bounds or is a no-op otherwise.
+     * This operation provides strong exception safety.
+     *
+     * @param index index to check
+     */
+    void rangeCheck(uint32_t index) const;
+
+    /**
+     * The blocks, in order. None of them is empty.
+     */
+    std::vector<Block> mBlocks;
+
+    /**
+     * Number of elements in all blocks.
+     */
+    uint32_t mSize;
+};
+
+/**
+ * A forward iterator over a CompressedSequence that decodes one element per
+ * step. Elements are returned by value.
+ */
+template <typename T, uint32_t B> class CompressedSequenceIterator {
+public:
+    friend class CompressedSequence<T, B>;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = int32_t;
+    using pointer = const T*;
+    using reference = T;
+
+    CompressedSequenceIterator() = delete;
+
+    bool operator==(const CompressedSequenceIterator<T, B>& rhs) const noexcept;
+    bool operator!=(const CompressedSequenceIterator<T, B>& rhs) const noexcept;
+    T operator*() const noexcept;
+    CompressedSequenceIterator<T, B>& operator++() noexcept;
+    const CompressedSequenceIterator<T, B> operator++(int) noexcept;
+
+private:
+    const CompressedSequence<T, B>* mSequence;
+    size_t mBlock;
+    uint32_t mOffset;
+    const uint8_t* mCursor;
+    T mValue;
+
+    CompressedSequenceIterator(const CompressedSequence<T, B>* sequence, size_t block) noexcept;
+
+    /**
+     * Decodes the first element of mBlock, if there is such a block.
+     */
+    void enterBlock() noexcept;
+};
+
+#include "../src/CompressedSequence.cpp"
+
+#endif // COMPRESSED_SEQUENCE_H
@@ -0,0 +1,154 @@
+// ConcurrentSortedList.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef CONCURRENT_SORTED_LIST_H
+#define CONCURRENT_SORTED_LIST_H
+
+#include "LinkedListNode.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+/**
+ * A sorted set of values that any number of threads may insert into, erase
+ * from and search at the same time.
+ *
+ * The values live in a chain of LinkedListNodes between a head and a tail
+ * sentinel, each node extended with its own mutex. Every operation walks the
+ * chain with hand-over-hand (lock coupling) locking: it holds the lock of a
+ * node until it has acquired the lock of the next one. Locks are therefore
+ * always taken in list order, which rules out deadlock, and operations on
+ * different parts of the list proceed in parallel. A thread that erases a
+ * node holds the locks of the node and of its predecessor, so no other thread
+ * can be on the node or be waiting for it, and the node is freed immediately.
+ *
+ * The mNext link of a node is guarded by the node's lock. The mPrev link is
+ * maintained as well (so that the chain has LinkedList's shape) and is only
+ * written by a thread that holds the lock of the node's predecessor.
+ *
+ * This class assumes that Compare does not throw.
+ */
+template <typename T, typename Compare = std::less<T>> class ConcurrentSortedList {
+public:
+    // typedefs for interoperability/compatibility with STL containers
+    using value_type = T;
+
+    /**
+     * Initializes an empty ConcurrentSortedList.
+     * This operation provides strong exception safety.
+     *
+     * @param compare strict weak ordering of the values
+     */
+    explicit ConcurrentSortedList(const Compare& compare = Compare());
+
+    ConcurrentSortedList(const ConcurrentSortedList<T, Compare>&) = delete;
+    ConcurrentSortedList<T, Compare>& operator=(const ConcurrentSortedList<T, Compare>&) = delete;
+
+    /**
+     * Destructor. Releases all resources held by this ConcurrentSortedList.
+     * No other thread may be using the list.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     */
+    ~ConcurrentSortedList() noexcept;
+
+    /**
+     * Inserts value at its sorted position unless an equivalent value is
+     * already present.
+     * This operation provides strong exception safety.
+     *
+     * @param value the value to insert
+     * @return true iff value was inserted
+     */
+    bool insert(const T& value);
+
+    /**
+     * Removes the value equivalent to value, if any.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     *
+     * @param value the value to remove
+     * @return true iff a value was removed
+     */
+    bool erase(const T& value) noexcept;
+
+    /**
+     * Returns true iff a value equivalent to value is present.
+     * This operation is a no-throw.
+     *
+     * @param value the value to look for
+     * @return true iff present
+     */
+    bool contains(const T& value) const noexcept;
+
+    /**
+     * Calls function with every value in sorted order. The walk is hand over
+     * hand, so concurrent operations on the part of the list that has already
+     * been visited (or not yet reached) are not held up. function runs while
+     * the lock of the visited node is held and must not use this list. If
+     * function throws, the walk stops and the exception is propagated.
+     * This operation provides strong exception safety, provided function does.
+     *
+     * @param function callable taking a const T&
+     */
+    template <typename Function> void forEach(Function function) const;
+
+    /**
+     * Returns true if this ConcurrentSortedList is empty and false otherwise.
+     * This operation is a no-throw.
+     *
+     * @return bool True when empty
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * Return the number of values in this ConcurrentSortedList.
+     * This operation is a no-throw.
+     *
+     * @return
+     */
+    uint32_t size() const noexcept;
+
+private:
+    /**
+     * A list node with the lock that guards its mNext link.
+     */
+    struct Node : LinkedListNode<T> {
+        explicit Node(const T& item = T());
+
+        Node* next() const noexcept;
+
+        mutable std::mutex mLock;
+    };
+
+    /**
+     * Walks the list hand over hand and returns the first node whose value is
+     * not less than value (the tail if there is none), locked together with
+     * its predecessor, which is stored in pred.
+     * This operation is a no-throw.
+     *
+     * @param value the value to look for
+     * @param pred receives the locked predecessor
+     * @return the locked node
+     */
+    Node* find(const T& value, Node*& pred) const noexcept;
+
+    /**
+     * Returns true iff node is a real node holding a value equivalent to value.
+     * This operation is a no-throw.
+     */
+    bool matches(const Node* node, const T& value) const noexcept;
+
+    Compare mCompare;
+    mutable Node mHead;
+    mutable Node mTail;
+    std::atomic<uint32_t> mSize;
+};
+
+#include "../src/ConcurrentSortedList.cpp"
+
+#endif // CONCURRENT_SORTED_LIST_H
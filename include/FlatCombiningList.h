@@ -0,0 +1,203 @@
+// FlatCombiningList.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef FLAT_COMBINING_LIST_H
+#define FLAT_COMBINING_LIST_H
+
+#include "LinkedList.h"
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * A LinkedList shared by many threads that append to its back and remove from
+ * its front, using flat combining instead of making every thread take the
+ * list's lock.
+ *
+ * On its first request a thread claims the lowest free slot (each slot sits
+ * on its own cache line) and keeps it for every later request, until the
+ * thread exits. A thread publishes each request in its slot and then either
+ * waits for the request to be marked done or, if the combiner lock is free,
+ * becomes the combiner itself. The combiner
+ * serves every pending request in one pass: appended values are copied into
+ * a batch LinkedList, which is then spliced onto the shared list in
+ * constant time, and front removals are served from the shared list (or from
+ * the batch, once the shared list is empty). Only the combiner ever touches
+ * the shared list, so its nodes and its dummy node stay in the combiner's
+ * cache instead of bouncing between all threads.
+ *
+ * An exception thrown while serving a request (for example by T's copy
+ * constructor) is handed back to, and rethrown in, the thread that made the
+ * request; the other requests of the pass are unaffected.
+ */
+template <typename T> class FlatCombiningList {
+public:
+    // typedefs for interoperability/compatibility with STL containers
+    using value_type = T;
+
+    /**
+     * Initializes an empty FlatCombiningList with the given number of request
+     * slots. More threads than slots may use the list; a thread that finds
+     * every slot taken serves its own requests under the combiner lock until
+     * a slot is free.
+     * This operation provides strong exception safety.
+     *
+     * @param slots number of request slots
+     */
+    explicit FlatCombiningList(uint32_t slots = 64);
+
+    FlatCombiningList(const FlatCombiningList<T>&) = delete;
+    FlatCombiningList<T>& operator=(const FlatCombiningList<T>&) = delete;
+
+    /**
+     * Appends a copy of value to the back of the list.
+     * This operation provides strong exception safety.
+     *
+     * @param value value to append
+     */
+    void add(const T& value);
+
+    /**
+     * Removes the front element and assigns it to value if the list is not
+     * empty.
+     * This operation provides strong exception safety.
+     *
+     * @param value receives the removed element
+     * @return true iff an element was removed
+     */
+    bool removeFront(T& value);
+
+    /**
+     * Calls function with the underlying LinkedList while no request is being
+     * served, and returns what it returns.
+     * This operation provides the same exception safety as function.
+     *
+     * @param function callable taking a LinkedList<T>&
+     * @return result of function
+     */
+    template <typename Function> auto withList(Function function);
+
+    /**
+     * Returns true if this FlatCombiningList was empty after the last pass.
+     * This operation is a no-throw.
+     *
+     * @return bool True when empty
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * Return the size of this FlatCombiningList as of the last pass.
+     * This operation is a no-throw.
+     *
+     * @return
+     */
+    uint32_t size() const noexcept;
+
+private:
+    enum State : uint32_t { kFree, kClaimed, kAdd, kRemove, kServed, kDone };
+
+    /**
+     * A published request. The thread owning the slot fills it in before
+     * setting mState to kAdd or kRemove; the combiner fills in the result
+     * before setting it to kDone. Between requests the slot stays kClaimed.
+     */
+    struct alignas(64) Slot {
+        std::atomic<uint32_t> mState;
+        const T* mValue;
+        T* mOut;
+        bool mFound;
+        std::exception_ptr mError;
+    };
+
+    /**
+     * The slot a thread holds in one FlatCombiningList. mSlots also tells the
+     * lists apart: it keeps the control block alive, so a later list cannot
+     * be mistaken for one that is gone.
+     */
+    struct Registration {
+        std::weak_ptr<Slot[]> mSlots;
+        uint32_t mIndex;
+    };
+
+    /**
+     * The slots the current thread holds, one per FlatCombiningList<T> it
+     * has used. Destroying it on thread exit frees the slots of the lists
+     * that still exist.
+     */
+    struct Registry {
+        ~Registry();
+
+        std::vector<Registration> mEntries;
+    };
+
+    /**
+     * Publishes a request in a free slot and waits until it has been served,
+     * combining if possible. Rethrows the exception the request raised.
+     * Returns mFound of the slot.
+     */
+    bool submit(State kind, const T* value, T* out);
+
+    /**
+     * Serves a request of the calling thread alone under mCombiner, for a
+     * thread that has no slot. Returns true iff an element was removed.
+     */
+    bool serveAlone(State kind, const T* value, T* out);
+
+    /**
+     * Serves every published request. Must be called with mCombiner held.
+     * This operation is a no-throw.
+     */
+    void combine() noexcept;
+
+    /**
+     * Returns the slot the calling thread holds in this list, claiming one
+     * on its first request, or nullptr if every slot is taken.
+     */
+    Slot* ownSlot();
+
+    /**
+     * Claims the lowest free slot and returns its index, or mSlotCount if
+     * every slot is taken.
+     * This operation is a no-throw.
+     */
+    uint32_t claim() noexcept;
+
+    /**
+     * Returns the Registry of the calling thread.
+     * This operation is a no-throw.
+     */
+    static Registry& registry() noexcept;
+
+    std::mutex mCombiner;
+    LinkedList<T> mList;
+
+    /**
+     * Values appended during the current pass. Combiner only; always empty
+     * between passes.
+     */
+    LinkedList<T> mBatch;
+
+    std::atomic<uint32_t> mSize;
+    uint32_t mSlotCount;
+
+    /**
+     * One past the highest slot ever claimed; the combiner scans no further.
+     */
+    std::atomic<uint32_t> mSlotsUsed;
+
+    /**
+     * Shared with the Registration of every thread holding a slot, which
+     * may outlive this list.
+     */
+    std::shared_ptr<Slot[]> mSlots;
+};
+
+#include "../src/FlatCombiningList.cpp"
+
+#endif // FLAT_COMBINING_LIST_H
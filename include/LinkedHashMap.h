@@ -0,0 +1,312 @@
+// LinkedHashMap.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef LINKED_HASH_MAP_H
+#define LINKED_HASH_MAP_H
+
+#include "LinkedList.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * A hash map that remembers insertion order. Every entry is stored in exactly
+ * one LinkedListNode that lives on the same circular, dummy-terminated chain
+ * used by LinkedList; the nodes are additionally indexed by an open-addressing
+ * (linear probing) table of node pointers. Lookups, insertions and removals
+ * therefore run in expected constant time while iteration walks the chain in
+ * insertion order without touching the table.
+ *
+ * In addition to the assumptions made by LinkedList about its parameterizing
+ * type, this class assumes that:
+ *
+ * 1. K and V both have default constructors (the dummy node stores a
+ *    default-constructed entry).
+ * 2. std::hash<K> and K::operator== are no-throw.
+ *
+ * Iterators are the regular LinkedList iterators over the entry type. Unlike
+ * LinkedList, erasing through erase(iterator) only invalidates iterators to
+ * the erased entry, so a map may be filtered while it is being iterated over
+ * by continuing with the returned iterator. Any insertion may rehash the table
+ * but never moves a node, so iterators stay valid across insertions.
+ */
+template <typename K, typename V> class LinkedHashMap {
+public:
+    // typedefs for interoperability/compatibility with STL containers
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using iterator = LinkedListIterator<value_type>;
+    using const_iterator = LinkedListConstIterator<value_type>;
+
+    /**
+     * Initializes an empty LinkedHashMap.
+     * This operation provides strong exception safety.
+     */
+    LinkedHashMap();
+
+    /**
+     * Initializes the LinkedHashMap to be a copy of src, preserving the
+     * insertion order of src.
+     * This operation provides strong exception safety.
+     *
+     * @param src LinkedHashMap to copy
+     */
+    LinkedHashMap(const LinkedHashMap<K, V>& src);
+
+    /**
+     * Makes this object a copy of rhs using the same guidelines as the copy
+     * constructor. Note that calling this method on yourself (m = m;) is
+     * equivalent to a no-op.
+     * This operation provides strong exception safety.
+     *
+     * @param rhs LinkedHashMap to copy
+     * @return *this, used for chaining.
+     */
+    LinkedHashMap<K, V>& operator=(const LinkedHashMap<K, V>& rhs);
+
+    /**
+     * Destructor. Releases all resources held by this LinkedHashMap.
+     * This operation is no-throw under the assumption that the parameterizing
+     * types' destructors are no-throw.
+     */
+    ~LinkedHashMap() noexcept;
+
+    /**
+     * Inserts the entry (key, value) at the end of the iteration order if key
+     * is not already present. An existing entry is left untouched.
+     * This operation provides strong exception safety.
+     *
+     * @param key key of the entry
+     * @param value value of the entry
+     * @return iterator to the entry with the given key and true iff the entry
+     *         was inserted by this call.
+     */
+    std::pair<iterator, bool> insert(const K& key, const V& value);
+
+    /**
+     * Returns a reference to the value mapped to key, inserting a default
+     * constructed value at the end of the iteration order if key is absent.
+     * This operation provides strong exception safety.
+     *
+     * @param key key to look up
+     * @return reference to the mapped value
+     */
+    V& operator[](const K& key);
+
+    /**
+     * Returns a constant reference to the value mapped to key. If key is not
+     * present, an std::out_of_range exception is thrown.
+     * This operation provides strong exception safety.
+     *
+     * @param key key to look up
+     * @return constant reference to the mapped value
+     */
+    const V& at(const K& key) const;
+
+    /**
+     * Returns a reference to the value mapped to key. If key is not present,
+     * an std::out_of_range exception is thrown.
+     * This operation provides strong exception safety.
+     *
+     * @param key key to look up
+     * @return reference to the mapped value
+     */
+    V& at(const K& key);
+
+    /**
+     * Returns a constant iterator to the entry with the given key, or end() if
+     * there is no such entry.
+     * This operation is a no-throw.
+     *
+     * @param key key to look up
+     * @return const_iterator
+     */
+    const_iterator find(const K& key) const noexcept;
+
+    /**
+     * Returns an iterator to the entry with the given key, or end() if there
+     * is no such entry.
+     * This operation is a no-throw.
+     *
+     * @param key key to look up
+     * @return iterator
+     */
+    iterator find(const K& key) noexcept;
+
+    /**
+     * Returns true if and only if an entry with the given key is present.
+     * This operation is a no-throw.
+     *
+     * @param key key to look up
+     * @return true iff present
+     */
+    bool contains(const K& key) const noexcept;
+
+    /**
+     * Removes the entry with the given key, if present.
+     * This operation is no-throw under the assumption that the parameterizing
+     * types' destructors are no-throw.
+     *
+     * @param key key of the entry to remove
+     * @return true iff an entry was removed
+     */
+    bool erase(const K& key) noexcept;
+
+    /**
+     * Removes the entry pointed to by iter and returns an iterator to the entry
+     * that followed it in iteration order. Other iterators stay valid.
+     * This operation is no-throw under the assumption that the parameterizing
+     * types' destructors are no-throw.
+     *
+     * @pre iter must point to an entry (not end) within this map
+     * @param iter iterator pointing to the entry that should be removed
+     * @return iterator to the next entry
+     */
+    iterator erase(iterator iter) noexcept;
+
+    /**
+     * Empties this LinkedHashMap returning it to the same state as the default
+     * constructor.
+     * This operation is no-throw under the assumption that the parameterizing
+     * types' destructors are no-throw.
+     */
+    void clear() noexcept;
+
+    /**
+     * Returns a constant iterator to the oldest entry.
+     * This operation is a no-throw.
+     *
+     * @return const_iterator
+     */
+    const_iterator begin() const noexcept;
+
+    /**
+     * Returns an iterator to the oldest entry.
+     * This operation is a no-throw.
+     *
+     * @return iterator
+     */
+    iterator begin() noexcept;
+
+    /**
+     * Returns a constant iterator to the end.
+     * This operation is a no-throw.
+     *
+     * @return const_iterator
+     */
+    const_iterator end() const noexcept;
+
+    /**
+     * Returns an iterator to the end.
+     * This operation is a no-throw.
+     *
+     * @return iterator
+     */
+    iterator end() noexcept;
+
+    /**
+     * Returns true if this LinkedHashMap is empty and false otherwise.
+     * This operation is a no-throw.
+     *
+     * @return bool True when empty
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * Return the number of entries in this LinkedHashMap.
+     * This operation is a no-throw.
+     *
+     * @return
+     */
+    uint32_t size() const noexcept;
+
+private:
+    /**
+     * Returns the index of the slot that holds key or, if key is absent, of the
+     * empty slot at which the probe sequence for key ends.
+     * This operation is a no-throw.
+     *
+     * @pre the table has at least one empty slot
+     * @param key key to look up
+     * @return slot index
+     */
+    uint32_t probe(const K& key) const noexcept;
+
+    /**
+     * Returns the node holding key, or nullptr if key is absent.
+     * This operation is a no-throw.
+     *
+     * @param key key to look up
+     * @return pointer to the node
+     */
+    LinkedListNode<value_type>* lookup(const K& key) const noexcept;
+
+    /**
+     * Makes sure that one more entry can be added without exceeding the maximum
+     * load factor, rehashing into a table twice as big if necessary.
+     * This operation provides strong exception safety.
+     */
+    void reserveOne();
+
+    /**
+     * Rebuilds the slot table with the given (power of two) capacity.
+     * This operation provides strong exception safety.
+     *
+     * @param capacity new number of slots
+     */
+    void rehash(uint32_t capacity);
+
+    /**
+     * Empties the given slot and shifts back the entries of its probe run so
+     * that no tombstones are necessary.
+     * This operation is a no-throw.
+     *
+     * @param slot index of the slot to empty
+     */
+    void eraseSlot(uint32_t slot) noexcept;
+
+    /**
+     * Returns the preferred slot of key in the current table.
+     * This operation is a no-throw.
+     *
+     * @param key key to hash
+     * @return slot index
+     */
+    uint32_t home(const K& key) const noexcept;
+
+    /**
+     * Swaps the contents of this LinkedHashMap with that of other in constant
+     * time.
+     * This operation is a no-throw.
+     *
+     * @param other the LinkedHashMap to swap with
+     */
+    void swap(LinkedHashMap<K, V>& other) noexcept;
+
+    /**
+     * The number of entries in the map. This does not include the dummy node
+     */
+    uint32_t mSize;
+
+    /**
+     * (unique) pointer to the dummy node. mTail->mNext points to the oldest
+     * entry of this map (if one exists).
+     */
+    std::unique_ptr<LinkedListNode<value_type>> mTail;
+
+    /**
+     * Open-addressing table of entry nodes. Its size is zero or a power of two
+     * and an empty slot holds nullptr.
+     */
+    std::vector<LinkedListNode<value_type>*> mSlots;
+};
+
+#include "../src/LinkedHashMap.cpp"
+
+#endif // LINKED_HASH_MAP_H
@@ -3,10 +3,16 @@
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
+#include "LinkedListEditBatch.h"
 #include "LinkedListNode.h"
+#include "LinkedListReclaimer.h"
+#include "LinkedListTrace.h"
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
 
 /**
  * Forward declarations.
@@ -29,6 +35,17 @@ template <typename T> class LinkedListIterator;
 
 template <typename T> class LinkedListConstIterator;
 
+/**
+ * How LinkedList::find and LinkedList::findIf reorganize the list after a
+ * successful search, so that frequently searched elements drift toward the
+ * head. Both policies only relink the found node; no element is copied.
+ *
+ * Static: the order is left alone.
+ * MoveToFront: the found element becomes the first element.
+ * Transpose: the found element swaps places with its predecessor.
+ */
+enum class SearchPolicy : uint8_t { Static, MoveToFront, Transpose };
+
 /**
  * An node-backed list implementation. This class attempts to provide certain
  * levels of exception safety (consult each method documentation for specifics)
@@ -56,44 +73,113 @@ template <typename T> class LinkedListConstIterator;
  * Due to this node structure, most of the operations performed on the
  * LinkedList can execute safely without making backup copies of the list.
  *
+ * Gaps created by add(index, value) past the end are kept as a single node
+ * standing for a run of default values (see LinkedListNode::mCount). Reading
+ * through get() const or const iterators never expands such a run; obtaining
+ * a mutable reference to one of its elements (get(), set(), a mutable
+ * iterator) splits that element out into a node of its own.
+ *
+ * Every node, the dummy node included, is obtained from Allocator (rebound to
+ * the node type) through std::allocator_traits, and the allocator is
+ * propagated on copy, move and swap as its propagate_on_container_* traits
+ * ask, like the standard containers do. pmr::LinkedList<T> uses a
+ * std::pmr::polymorphic_allocator, so that e.g. a request-scoped list can live
+ * on a std::pmr::monotonic_buffer_resource. Runs of default values are only
+ * kept by lists using std::allocator (the iterators that split them do not
+ * know the list's allocator); other lists fill gaps with ordinary nodes.
+ *
+ * A list that is read mostly by index can opt in to an index (see
+ * setIndexed): an array of node pointers built on the first indexed access
+ * after a structural change, which makes get(), set() and the lookup part of
+ * remove() and add(index, value) constant time until the next change.
+ * Appending keeps it up to date; every other structural change discards it.
+ * No index is built while the list holds a run of default values. Because
+ * const reads may build the index, an indexed list must not be read from
+ * several threads at once without synchronization.
+ *
  * This class provides a set of STL-style iterators. As with most
  * iterator implementations, modifying the LinkedList while iterating over it
  * invalidates all current iterators. Attempts to use invalidated iterators
  * constitutes undefined behavior.
  *
  */
-template <typename T> class LinkedList {
+template <typename T, typename Allocator = std::allocator<T>> class LinkedList {
 public:
     // typedefs for interoperability/compatibility with STL containers
     // See C++17 standard §23.1 [container.requirements.general]
     using value_type = T;
+    using allocator_type = Allocator;
     using iterator = LinkedListIterator<T>;
     using const_iterator = LinkedListConstIterator<T>;
 
     /**
-     * Initializes an empty LinkedList.
+     * Initializes an empty LinkedList using a default-constructed allocator.
      * This operation provides strong exception safety.
      */
     LinkedList();
 
     /**
-     * Initializes the LinkedList to be a copy of src.
+     * Initializes an empty LinkedList that allocates its nodes with allocator.
+     * This operation provides strong exception safety.
+     *
+     * @param allocator allocator to use
+     */
+    explicit LinkedList(const Allocator& allocator);
+
+    /**
+     * Initializes the LinkedList to be a copy of src. The allocator is
+     * obtained from src's through select_on_container_copy_construction.
+     * This operation provides strong exception safety.
+     *
+     * @param src LinkedList to copy
+     */
+    LinkedList(const LinkedList<T, Allocator>& src);
+
+    /**
+     * Initializes the LinkedList to be a copy of src that allocates its nodes
+     * with allocator.
      * This operation provides strong exception safety.
      *
      * @param src LinkedList to copy
+     * @param allocator allocator to use
+     */
+    LinkedList(const LinkedList<T, Allocator>& src, const Allocator& allocator);
+
+    /**
+     * Initializes the LinkedList with the elements and the allocator of src,
+     * leaving src empty. The elements are not copied, but a dummy node is
+     * allocated.
+     * This operation provides strong exception safety.
+     *
+     * @param src LinkedList to move from
      */
-    LinkedList(const LinkedList<T>& src);
+    LinkedList(LinkedList<T, Allocator>&& src);
 
     /**
      * Makes this object a copy of rhs using the same guidelines as the copy
      * constructor. Note that calling this method on yourself (l = l;) is
-     * equivalent to a no-op.
+     * equivalent to a no-op. The allocator of rhs is adopted if the
+     * allocator's propagate_on_container_copy_assignment is true. If
+     * the allocator stays the same and copying T cannot throw, the existing
+     * nodes are assigned to instead of building a copy and swapping with it.
      * This operation provides strong exception safety.
      *
      * @param rhs LinkedList to copy
      * @return *this, used for chaining.
      */
-    LinkedList<T>& operator=(const LinkedList<T>& rhs);
+    LinkedList<T, Allocator>& operator=(const LinkedList<T, Allocator>& rhs);
+
+    /**
+     * Replaces the contents of this object with those of rhs. The nodes of rhs
+     * are taken over in constant time if the allocator of rhs is adopted
+     * (propagate_on_container_move_assignment) or equal to this object's;
+     * otherwise the elements are copied. rhs is left valid but unspecified.
+     * This operation provides strong exception safety.
+     *
+     * @param rhs LinkedList to move from
+     * @return *this, used for chaining.
+     */
+    LinkedList<T, Allocator>& operator=(LinkedList<T, Allocator>&& rhs);
 
     /**
      * Destructor. Releases all resources held by this LinkedList.
@@ -113,12 +199,14 @@ public:
 
     /**
      * Inserts value at the specified index. All elements at or to the right of
-     * index are shifted down by one spot. Time proportional to the maximum of
-     * the size of this LinkedList or index is needed to perform this operation.
-     * In particular, note that this operation does not perform the tail
-     * insertion optimization that add(const T& value) offers. If this
-     * LinkedList needs to be enlarged (index is out of range) default values
-     * are used to fill the gaps.
+     * index are shifted down by one spot. Time proportional to index is needed
+     * to perform this operation. In particular, note that this operation does
+     * not perform the tail insertion optimization that add(const T& value)
+     * offers. If this LinkedList needs to be enlarged (index is out of range)
+     * default values are used to fill the gap. The gap is stored as a single
+     * run in constant time and space; its elements are only materialized, one
+     * at a time, when they are written or accessed through a mutable reference
+     * or iterator.
      * This operation provides strong exception safety.
      *
      * @param index index at which to insert value
@@ -126,14 +214,93 @@ public:
      */
     void add(uint32_t index, const T& value);
 
+    /**
+     * Applies every edit recorded in batch during a single forward traversal
+     * of this LinkedList, with the same result as issuing the recorded calls
+     * one after another. All new elements are copied before the list is
+     * modified and replaced elements are swapped for new nodes rather than
+     * assigned to, so either every edit takes effect or none does. If this
+     * LinkedList does not have the size batch was recorded for, an
+     * std::invalid_argument exception is thrown.
+     * This operation provides strong exception safety.
+     *
+     * @param batch the edits to apply
+     */
+    void apply(const LinkedListEditBatch<T>& batch);
+
     /**
      * Empties this LinkedList returning it to the same state as the default
-     * constructor.
+     * constructor. The chain of nodes is detached in constant time and then
+     * released without relinking, on the reclaimer thread if this LinkedList
+     * has a reclaimer (see setReclaimer).
      * This operation is no-throw under the assumption that the parameterizing
      * type's destructor is no-throw.
      */
     void clear() noexcept;
 
+    /**
+     * Opts this LinkedList in to (or, given nullptr, out of) deferred
+     * reclamation: from now on clear(), the destructor and assignment hand the
+     * nodes they release to reclaimer instead of freeing them on the calling
+     * thread. The reclaimer must outlive this LinkedList (or be unset before it
+     * is destroyed). The setting belongs to this object and is not copied.
+     * The destructor of T then runs on the reclaimer thread, concurrently with
+     * the caller, so it must be safe to run there: state it shares with other
+     * elements or with the caller needs synchronization, or the caller must
+     * wait for LinkedListReclaimer::flush() before touching it again.
+     * Lists whose allocator cannot be recreated on the reclaimer thread (one
+     * that is not always equal or not default-constructible) keep freeing
+     * their nodes synchronously.
+     * This operation is a no-throw.
+     *
+     * @param reclaimer reclaimer to use, or nullptr to free synchronously
+     */
+    void setReclaimer(LinkedListReclaimer* reclaimer) noexcept;
+
+    /**
+     * Opts this LinkedList in to (or, given nullptr, out of) recording its
+     * operations: from now on add(), get(), set(), remove(), clear(), find(),
+     * findIf(), begin(), erase(), splice(), rotate(), moveToFront(),
+     * moveToBack() and apply() each append an event to recorder (see
+     * TraceOp), and so does the destructor, as a clear(). An event whose
+     * index is a position found through an iterator costs a walk of the list
+     * up to that position. Traversals the library makes
+     * on its own (operator==, toText()) are not recorded. The recorder must
+     * outlive this LinkedList (or be unset before it is destroyed). The
+     * setting belongs to this object and is not copied.
+     * This operation is a no-throw.
+     *
+     * @param recorder recorder to use, or nullptr to stop recording
+     */
+    void setRecorder(LinkedListTraceRecorder* recorder) noexcept;
+
+    /**
+     * Opts this LinkedList in to (or out of) keeping an index of its nodes
+     * (see the class description). Opting out frees the index. The setting
+     * belongs to this object and is not copied.
+     * This operation is a no-throw.
+     *
+     * @param indexed whether to keep an index
+     */
+    void setIndexed(bool indexed) noexcept;
+
+    /**
+     * Frees the memory held by the index. If this LinkedList is indexed, the
+     * index is rebuilt on the next indexed access.
+     * This operation is a no-throw.
+     */
+    void dropIndex() noexcept;
+
+    /**
+     * Returns the number of bytes allocated for the index, which is 0 unless
+     * this LinkedList is indexed and has been read by index since the index
+     * was last dropped.
+     * This operation is a no-throw.
+     *
+     * @return bytes held by the index
+     */
+    size_t indexMemory() const noexcept;
+
     /**
      * Returns a constant reference to the element stored at the provided index.
      * If index is out of bounds, an std::out_of_range exception is thrown with
@@ -164,7 +331,7 @@ public:
      * @param rhs the LinkedList being compared to
      * @return true iff logically equivalent
      */
-    bool operator==(const LinkedList<T>& rhs) const;
+    bool operator==(const LinkedList<T, Allocator>& rhs) const;
 
     /**
      * Returns false if this LinkedList is equal to rhs and true otherwise.
@@ -173,7 +340,7 @@ public:
      * @param rhs the LinkedList being compared to
      * @return true iff not logically equivalent
      */
-    bool operator!=(const LinkedList<T>& rhs) const;
+    bool operator!=(const LinkedList<T, Allocator>& rhs) const;
 
     /**
      * Returns a constant iterator to the beginning.
@@ -226,6 +393,19 @@ public:
      */
     void remove(uint32_t index);
 
+    /**
+     * Removes the element position points to in constant time and returns
+     * an iterator to the element after it. Only iterators to the removed
+     * element are invalidated. position must be a dereferenceable iterator
+     * into this LinkedList.
+     * This operation is no-throw under the assumption that the
+     * parameterizing type's destructor is no-throw.
+     *
+     * @param position iterator to the element to remove
+     * @return iterator to the element that followed it
+     */
+    iterator erase(iterator position) noexcept;
+
     /**
      * Sets the element at the specified index to the provided value. If index
      * is out of bounds, an std::out_of_range exception is thrown with the index
@@ -237,6 +417,137 @@ public:
      */
     void set(uint32_t index, const T& value);
 
+    /**
+     * Returns a constant iterator to the first element equal to value, or
+     * end() if there is none. The search takes time proportional to the
+     * position of the element.
+     * This operation provides strong exception safety.
+     *
+     * @param value value to search for
+     * @return const_iterator to the element, or end()
+     */
+    const_iterator find(const T& value) const;
+
+    /**
+     * Returns an iterator to the first element equal to value, or end() if
+     * there is none, and then reorganizes this LinkedList as policy asks (see
+     * SearchPolicy). Reorganizing only relinks the found node, so iterators
+     * stay valid, although the elements they point to may change position.
+     * An element in a run of default values is found but not moved.
+     * This operation provides strong exception safety.
+     *
+     * @param value value to search for
+     * @param policy how to reorganize the list after a hit
+     * @return iterator to the element, or end()
+     */
+    iterator find(const T& value, SearchPolicy policy = SearchPolicy::Static);
+
+    /**
+     * Returns a constant iterator to the first element for which pred
+     * returns true, or end() if there is none.
+     * This operation provides strong exception safety.
+     *
+     * @param pred predicate taking a const T&
+     * @return const_iterator to the element, or end()
+     */
+    template <typename Predicate> const_iterator findIf(Predicate pred) const;
+
+    /**
+     * Returns an iterator to the first element for which pred returns true,
+     * or end() if there is none, and then reorganizes this LinkedList as
+     * policy asks, like find().
+     * This operation provides strong exception safety.
+     *
+     * @param pred predicate taking a const T&
+     * @param policy how to reorganize the list after a hit
+     * @return iterator to the element, or end()
+     */
+    template <typename Predicate>
+    iterator findIf(Predicate pred, SearchPolicy policy = SearchPolicy::Static);
+
+    /**
+     * Moves every element of other in front of position in constant time,
+     * leaving other empty. No element is copied and no node is allocated or
+     * freed. other must not be this LinkedList and its allocator must compare
+     * equal to this LinkedList's.
+     * This operation is a no-throw.
+     *
+     * @param position iterator into this LinkedList (may be end())
+     * @param other the LinkedList whose elements are moved
+     */
+    void splice(iterator position, LinkedList<T, Allocator>& other) noexcept;
+
+    /**
+     * Moves the element element points to from other to the front of
+     * position in constant time. The node itself is relinked, so iterators
+     * to the element stay valid and now refer into this LinkedList. other
+     * may be this LinkedList; otherwise its allocator must compare equal to
+     * this LinkedList's. Moving an element out of a run of default values
+     * first gives it a node of its own, which may throw.
+     * This operation provides strong exception safety.
+     *
+     * @param position iterator into this LinkedList (may be end())
+     * @param other the LinkedList holding the element
+     * @param element dereferenceable iterator into other
+     */
+    void splice(iterator position, LinkedList<T, Allocator>& other, iterator element);
+
+    /**
+     * Moves the first k elements of this LinkedList, in order, behind the
+     * last one (k is taken modulo size()). Only the dummy node is relinked,
+     * after a walk from whichever end is closer to the new first element, so
+     * this completes in time proportional to min(k, size() - k), or in
+     * constant time if the index is built; a stale index is not rebuilt. No
+     * element is copied and no node is allocated unless the new first element lies
+     * inside a run of default values, which is then split.
+     * This operation provides strong exception safety.
+     *
+     * @param k number of positions to rotate by
+     */
+    void rotate(uint32_t k);
+
+    /**
+     * Moves the element position points to to the front of this LinkedList
+     * in constant time. The node is relinked, so iterators to the element
+     * stay valid. No element is copied and no node is allocated unless the
+     * element is the first of a run of default values, which then gets a
+     * node of its own.
+     * This operation provides strong exception safety.
+     *
+     * @param position dereferenceable iterator into this LinkedList
+     */
+    void moveToFront(iterator position);
+
+    /**
+     * Moves the element position points to to the back of this LinkedList
+     * in constant time. The node is relinked, so iterators to the element
+     * stay valid. No element is copied and no node is allocated unless the
+     * element is the first of a run of default values, which then gets a
+     * node of its own.
+     * This operation provides strong exception safety.
+     *
+     * @param position dereferenceable iterator into this LinkedList
+     */
+    void moveToBack(iterator position);
+
+    /**
+     * Swaps the contents of this LinkedList with that of other in constant
+     * time. The allocators are swapped as well if the allocator's
+     * propagate_on_container_swap is true; otherwise they must compare equal.
+     * This operation is a no-throw.
+     *
+     * @param other the LinkedList to swap with
+     */
+    void swap(LinkedList<T, Allocator>& other) noexcept;
+
+    /**
+     * Returns a copy of the allocator this LinkedList allocates its nodes with.
+     * This operation is a no-throw.
+     *
+     * @return allocator
+     */
+    Allocator getAllocator() const noexcept;
+
     /**
      * Return the size of this LinkedList.
      * This operation is a no-throw.
@@ -246,6 +557,42 @@ public:
     uint32_t size() const noexcept;
 
 private:
+    template <typename U, typename A, typename Flush>
+    friend void formatText(const LinkedList<U, A>& list, char separator, Flush flush);
+
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    using NodeAllocator = typename AllocatorTraits::template rebind_alloc<LinkedListNode<T>>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+    using IndexAllocator = typename AllocatorTraits::template rebind_alloc<LinkedListNodeBase*>;
+
+    /**
+     * Off: no index is kept. Stale: the index must be rebuilt before use.
+     * Built: mIndex holds every node in order. Unusable: the list holds a run
+     * of default values, so no index is built until the next change.
+     */
+    enum class IndexState : uint8_t { Off, Stale, Built, Unusable };
+
+    /**
+     * Whether gaps are kept as runs of default values. Splitting a run
+     * allocates with new (see LinkedListNode::isolate), which only matches
+     * how std::allocator obtains memory.
+     */
+    static constexpr bool kCompressGaps = std::is_same_v<Allocator, std::allocator<T>>;
+
+    /**
+     * Whether detached chains may be handed to a LinkedListReclaimer, which
+     * needs to recreate the allocator to free them.
+     */
+    static constexpr bool kDeferredReclaim
+        = NodeTraits::is_always_equal::value && std::is_default_constructible_v<NodeAllocator>;
+
+    /**
+     * Whether copy assignment may assign to existing nodes: once copying T
+     * cannot throw, doing so keeps the strong guarantee.
+     */
+    static constexpr bool kReuseNodes
+        = std::is_nothrow_copy_constructible_v<T> && std::is_nothrow_copy_assignable_v<T>;
+
     /**
      * Given an index, this method throws an std::out_of_range with the index as
      * its message if index is out of bounds or is a no-op otherwise.
@@ -255,6 +602,86 @@ private:
      */
     void rangeCheck(uint32_t index) const;
 
+    /**
+     * Returns the node whose run contains the element at index and stores the
+     * position of that element within the run in offset.
+     * This operation is a no-throw.
+     *
+     * @pre index < size()
+     * @param index index of the element
+     * @param offset receives the offset of the element within the node's run
+     * @return node containing the element
+     */
+    LinkedListNode<T>* locate(uint32_t index, uint32_t& offset) const noexcept;
+
+    /**
+     * Makes sure the index is built, if this LinkedList is indexed and an
+     * index can be built. Running out of memory leaves the index stale.
+     * This operation is a no-throw.
+     *
+     * @return true iff mIndex may be used
+     */
+    bool buildIndex() const noexcept;
+
+    /**
+     * Records a structural change: the index, if kept, must be rebuilt.
+     * This operation is a no-throw.
+     */
+    void invalidateIndex() noexcept;
+
+    /**
+     * Records op in the recorder, if this LinkedList has one, with the
+     * current size.
+     * This operation is a no-throw.
+     *
+     * @param op kind of operation
+     * @param index index of the operation (see TraceEvent)
+     * @param count count of the operation (see TraceEvent)
+     */
+    void trace(TraceOp op, uint32_t index, uint32_t count = 0) const noexcept;
+
+    /**
+     * Returns the index of the first element node holds, or size() for the
+     * dummy node, by walking from the front. Only used for tracing.
+     * This operation is a no-throw.
+     *
+     * @param node node of this LinkedList
+     * @return index of node
+     */
+    uint32_t positionOf(const LinkedListNodeBase* node) const noexcept;
+
+    /**
+     * Returns a constant iterator to the beginning like begin(), without
+     * recording anything. Used by traversals the library makes on its own.
+     * This operation is a no-throw.
+     *
+     * @return const_iterator
+     */
+    const_iterator untracedBegin() const noexcept;
+
+    /**
+     * Moves every element of other in front of position like
+     * splice(position, other), without recording anything. Used where a
+     * splice is part of another operation.
+     * This operation is a no-throw.
+     *
+     * @param position iterator into this LinkedList (may be end())
+     * @param other the LinkedList whose elements are moved
+     */
+    void transfer(iterator position, LinkedList<T, Allocator>& other) noexcept;
+
+    /**
+     * Returns the node holding exactly the element at index, first splitting
+     * it out of its run of default values if necessary. The contents of this
+     * LinkedList do not change.
+     * This operation provides strong exception safety.
+     *
+     * @pre index < size()
+     * @param index index of the element
+     * @return node holding the element
+     */
+    LinkedListNode<T>* materialize(uint32_t index);
+
     /**
      * Removes from this LinkedList the node pointed to by iter.
      * This operation is no-throw under the assumption that the parameterizing
@@ -266,12 +693,101 @@ private:
     void removeNode(iterator iter) noexcept;
 
     /**
-     * Swaps the contents of this LinkedList with that of other in constant time.
+     * Returns the first node, in list order, whose item satisfies pred, or
+     * the dummy node if there is none, and stores the index of its (first)
+     * element, or the size, in position.
+     * This operation provides strong exception safety.
+     *
+     * @param pred predicate taking a const T&
+     * @param position receives the index of the node found
+     * @return matching node or mTail
+     */
+    template <typename Predicate>
+    LinkedListNode<T>* search(Predicate& pred, uint32_t& position) const;
+
+    /**
+     * Relinks node toward the head as policy asks. The dummy node and nodes
+     * standing for a run of default values stay where they are.
+     * This operation is a no-throw.
+     *
+     * @param node node found by a search
+     * @param policy reorganization to perform
+     */
+    void promote(LinkedListNode<T>* node, SearchPolicy policy) noexcept;
+
+    /**
+     * Allocates a node holding a copy of item. The node is linked in front
+     * of next or, if next is nullptr, only to itself.
+     * This operation provides strong exception safety.
+     *
+     * @param item item to store in the node
+     * @param next node to link the new node in front of, or nullptr
+     * @return the new node
+     */
+    LinkedListNode<T>* createNode(const T& item, LinkedListNode<T>* next = nullptr);
+
+    /**
+     * Destroys node, which unlinks it from its neighbors, and frees it.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     *
+     * @param node node obtained from createNode
+     */
+    void destroyNode(LinkedListNode<T>* node) noexcept;
+
+    /**
+     * Hands a detached, nullptr-terminated chain to the reclaimer or, without
+     * one, frees it right away.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     *
+     * @param first first node of the chain (may be nullptr)
+     */
+    void release(LinkedListNode<T>* first) noexcept;
+
+    /**
+     * Makes this LinkedList a copy of rhs by assigning to its existing nodes.
+     * Any nodes missing are created before anything is assigned and surplus
+     * nodes are released afterwards, so with a no-throw copy assignment either
+     * the whole copy succeeds or this list is unchanged.
+     * This operation provides strong exception safety.
+     *
+     * @pre kReuseNodes and rhs is not this LinkedList
+     * @param rhs LinkedList to copy
+     */
+    void assignNodes(const LinkedList<T, Allocator>& rhs);
+
+    /**
+     * Destroys and frees first and every node reachable from it through
+     * mNext, up to (but not including) nullptr, without relinking their
+     * neighbors (see LinkedListNode::destroyChain). Trivially destructible
+     * elements need no destructor call, so their nodes are only freed.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     *
+     * @param allocator allocator the nodes were obtained from
+     * @param first first node of a nullptr-terminated chain (may be nullptr)
+     */
+    static void destroyChain(NodeAllocator& allocator, LinkedListNode<T>* first) noexcept;
+
+    /**
+     * Type-erased destroyChain for use with LinkedListReclaimer. Only used
+     * when kDeferredReclaim holds.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     *
+     * @param first first node of a nullptr-terminated chain
+     */
+    static void reclaimChain(void* first) noexcept;
+
+    /**
+     * Swaps the nodes and sizes of this LinkedList and other in constant time,
+     * but not their allocators.
      * This operation is a no-throw.
      *
      * @param other the LinkedList to swap with
      */
-    void swap(LinkedList<T>& rhs) noexcept;
+    void swapNodes(LinkedList<T, Allocator>& other) noexcept;
 
     /**
      * The logical size of the list. This does not include the dummy node
@@ -279,13 +795,48 @@ private:
     uint32_t mSize;
 
     /**
-     * (unique) pointer to the dummy node. mTail->mNext points to the first valid
-     * element of this list (if one exists). The use of std::unique_ptr
-     * facilitates implementing strong exception safety (RAII).
+     * Allocator for every node of this list, the dummy node included.
      */
-    std::unique_ptr<LinkedListNode<T>> mTail;
+    NodeAllocator mAllocator;
+
+    /**
+     * Pointer to the dummy node. mTail->mNext points to the first valid
+     * element of this list (if one exists). It is never nullptr, not even in
+     * a moved-from list.
+     */
+    LinkedListNode<T>* mTail;
+
+    /**
+     * Reclaimer that frees detached chains, or nullptr to free them on the
+     * calling thread.
+     */
+    LinkedListReclaimer* mReclaimer;
+
+    /**
+     * Recorder of the operations on this list, or nullptr.
+     */
+    LinkedListTraceRecorder* mRecorder;
+
+    /**
+     * Node pointers in list order while mIndexState is Built. They are kept as
+     * LinkedListNodeBase pointers so that lists of every element type share
+     * one vector instantiation (per allocator).
+     */
+    mutable std::vector<LinkedListNodeBase*, IndexAllocator> mIndex;
+
+    /**
+     * State of mIndex (see IndexState).
+     */
+    mutable IndexState mIndexState;
 };
 
+namespace pmr {
+/**
+ * A LinkedList whose nodes come from a std::pmr::memory_resource.
+ */
+template <typename T> using LinkedList = ::LinkedList<T, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+
 #include "../src/LinkedList.cpp"
 #include "LinkedListConstIter.h"
 #include "LinkedListIter.h"
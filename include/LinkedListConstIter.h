@@ -3,20 +3,28 @@
 #ifndef LINKEDLISTCONSTITER_H
 #define LINKEDLISTCONSTITER_H
 
+#include <cstdint>
 #include <exception>
 #include <iterator>
 
-template <typename T> class LinkedList;
+template <typename T, typename Allocator> class LinkedList;
 template <typename T> class LinkedListNode;
+template <typename K, typename V> class LinkedHashMap;
+template <typename T, typename Monoid> class AggregateList;
 
 /**
  * This header contains the const iterator for the
  * LinkedList container.  All of the methods for the classes should be self-explanatory
  *
+ * Besides the node it points into, a const iterator remembers its offset within
+ * that node's run of default values (see LinkedListNode::mCount), so reading a
+ * list through const iterators never materializes such a run.
  */
 template <typename T> class LinkedListConstIterator {
 public:
-    friend class LinkedList<T>;
+    template <typename U, typename Allocator> friend class LinkedList;
+    template <typename K, typename V> friend class LinkedHashMap;
+    template <typename U, typename Monoid> friend class AggregateList;
     using iterator_category = std::bidirectional_iterator_tag;
     using value_type = T;
     using difference_type = int32_t;
@@ -36,7 +44,8 @@ public:
 
 private:
     LinkedListNode<T>* mPtr;
-    explicit LinkedListConstIterator(LinkedListNode<T>* ptr);
+    uint32_t mOffset;
+    explicit LinkedListConstIterator(LinkedListNode<T>* ptr, uint32_t offset = 0);
 };
 
 #include "../src/LinkedListConstIter.cpp"
@@ -0,0 +1,286 @@
+// LinkedListEditBatch.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef LINKED_LIST_EDIT_BATCH_H
+#define LINKED_LIST_EDIT_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+template <typename T, typename Allocator> class LinkedList;
+
+/**
+ * A batch of positional edits to be applied to a LinkedList in a single pass.
+ *
+ * Edits are recorded with exactly the meaning the corresponding LinkedList
+ * calls would have if they were issued one after another: the index of every
+ * edit refers to the list as left by the edits recorded before it. While
+ * recording, the batch keeps the edits in list order in a treap (a binary
+ * search tree balanced by random priorities) whose nodes know how many
+ * elements of the edited and of the original list their subtree covers, so
+ * LinkedList::apply can perform all of them during one forward traversal
+ * instead of one traversal per edit.
+ *
+ * Recording an edit takes expected time logarithmic in the number of edits
+ * already recorded; the list itself is not touched until it is applied. The
+ * gap that add() past the end fills with default values is recorded as one
+ * edit, however long it is, and applied as one run of default values (see
+ * LinkedList). Out of range indices are reported while recording, exactly as
+ * the LinkedList would report them.
+ */
+template <typename T> class LinkedListEditBatch {
+public:
+    /**
+     * Initializes an empty batch of edits for list. The batch may only be
+     * applied to a list of the same size as list has now.
+     * This operation is a no-throw.
+     *
+     * @param list the list the edits will be applied to
+     */
+    template <typename Allocator>
+    explicit LinkedListEditBatch(const LinkedList<T, Allocator>& list) noexcept;
+
+    /**
+     * Records the insertion of value at index, with the semantics of
+     * LinkedList::add(uint32_t, const T&) (including filling any gap with
+     * default values).
+     * This operation provides strong exception safety.
+     *
+     * @param index index at which to insert value
+     * @param value the element to insert
+     */
+    void add(uint32_t index, const T& value);
+
+    /**
+     * Records the removal of the element at index. If index is out of bounds
+     * an std::out_of_range exception is thrown with index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the object to remove
+     */
+    void remove(uint32_t index);
+
+    /**
+     * Records setting the element at index to value. If index is out of
+     * bounds an std::out_of_range exception is thrown with index as its
+     * message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the object to set
+     * @param value the new value
+     */
+    void set(uint32_t index, const T& value);
+
+    /**
+     * Discards every recorded edit.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     */
+    void clear() noexcept;
+
+    /**
+     * Returns true if no edit that changes the list is pending.
+     * This operation is a no-throw.
+     *
+     * @return bool True when empty
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * Returns the size the list will have once the batch has been applied.
+     * This operation is a no-throw.
+     *
+     * @return resulting size
+     */
+    uint32_t resultSize() const noexcept;
+
+private:
+    template <typename U, typename Allocator> friend class LinkedList;
+
+    enum class Kind : uint8_t { Insert, Fill, Set, Remove };
+
+    /**
+     * A normalized edit, as LinkedList::apply consumes them. Insertions and
+     * fills precede the original element mOrigin (or are appended, if
+     * mOrigin is the original size); sets and removals apply to the original
+     * element mOrigin. mValue indexes mValues; a fill instead inserts mCount
+     * default values, and mCount is 1 for every other kind.
+     */
+    struct Edit {
+        uint32_t mOrigin;
+        uint32_t mValue;
+        uint32_t mCount;
+        Kind mKind;
+    };
+
+    /**
+     * Marks the absence of a node.
+     */
+    static constexpr uint32_t kNil = UINT32_MAX;
+
+    /**
+     * A recorded edit in the treap. Instead of its original position a node
+     * holds mGap, the number of untouched original elements between the
+     * previous edit and this one, so that recording never has to renumber
+     * the edits that follow. mNodes, mLength and mOrigins count the nodes,
+     * the elements of the edited list and the original elements the subtree
+     * covers, gaps included.
+     */
+    struct Node {
+        uint32_t mGap;
+        uint32_t mValue;
+        uint32_t mCount;
+        Kind mKind;
+        uint32_t mPriority = 0;
+        uint32_t mLeft = kNil;
+        uint32_t mRight = kNil;
+        uint32_t mNodes = 1;
+        uint32_t mLength = 0;
+        uint32_t mOrigins = 0;
+    };
+
+    /**
+     * The element at a given current index: either part of the edit of
+     * mNode, the node at mRank (the element at mOffset of a fill), or an
+     * untouched original element in the gap in front of that node, mBefore
+     * elements into it. For the untouched elements after the last edit (or
+     * the end of the list) mNode is kNil and mRank the number of nodes.
+     */
+    struct Location {
+        uint32_t mRank;
+        uint32_t mNode;
+        uint32_t mBefore;
+        uint32_t mOffset;
+        bool mIsEdit;
+    };
+
+    /**
+     * Finds the element at the given current index.
+     * This operation is a no-throw.
+     *
+     * @param index current index, at most resultSize()
+     * @return location of the element
+     */
+    Location locate(uint32_t index) const noexcept;
+
+    /**
+     * Records an edit of the given kind for the element at location.
+     * This operation provides strong exception safety.
+     */
+    void record(const Location& location, Kind kind, uint32_t value);
+
+    /**
+     * Records an edit of the given kind for the element at location, which
+     * lies inside a fill: the fill is split around it.
+     * This operation provides strong exception safety.
+     */
+    void recordInFill(const Location& location, Kind kind, uint32_t value);
+
+    /**
+     * Makes sure that count more nodes can be stored without reallocating.
+     * This operation provides strong exception safety.
+     */
+    void makeRoom(size_t count);
+
+    /**
+     * Drops the node at rank, handing its gap on to the node after it.
+     * The caller must have reserved room for two nodes.
+     * This operation is a no-throw.
+     */
+    void erase(uint32_t rank) noexcept;
+
+    /**
+     * Replaces the count nodes starting at rank with copies of the nodes in
+     * [first, last). The caller must have reserved room for them.
+     * This operation is a no-throw.
+     */
+    void replace(uint32_t rank, uint32_t count, const Node* first, const Node* last) noexcept;
+
+    /**
+     * Returns the node at rank.
+     * This operation is a no-throw.
+     */
+    uint32_t nodeAt(uint32_t rank) const noexcept;
+
+    /**
+     * Splits the treap rooted at root into its first rank nodes and the
+     * rest.
+     * This operation is a no-throw.
+     */
+    void split(uint32_t root, uint32_t rank, uint32_t& left, uint32_t& right) noexcept;
+
+    /**
+     * Joins two treaps, every node of left preceding every node of right,
+     * and returns the root.
+     * This operation is a no-throw.
+     */
+    uint32_t merge(uint32_t left, uint32_t right) noexcept;
+
+    /**
+     * Recomputes the counts of node from its own edit and its children.
+     * This operation is a no-throw.
+     */
+    void update(uint32_t node) noexcept;
+
+    /**
+     * Returns the nodes of the treap in list order as normalized edits.
+     * This operation provides strong exception safety.
+     */
+    std::vector<Edit> edits() const;
+
+    /**
+     * Appends value to the value store and returns its index.
+     * This operation provides strong exception safety.
+     */
+    uint32_t store(const T& value);
+
+    /**
+     * Given an index, this method throws an std::out_of_range with the index as
+     * its message if index is out of bounds or is a no-op otherwise.
+     * This operation provides strong exception safety.
+     *
+     * @param index index to check
+     */
+    void rangeCheck(uint32_t index) const;
+
+    /**
+     * Size of the list the batch was created for.
+     */
+    uint32_t mBaseSize;
+
+    /**
+     * Size of the list after all recorded edits.
+     */
+    uint32_t mResultSize;
+
+    /**
+     * Storage of the treap nodes, including those that were replaced since
+     * clear(). Only ever appended to so that recording can reserve room for
+     * the nodes it needs before it changes anything.
+     */
+    std::vector<Node> mNodes;
+
+    /**
+     * Root of the treap, or kNil if no edit is pending.
+     */
+    uint32_t mRoot;
+
+    /**
+     * State of the xorshift generator that draws the node priorities.
+     */
+    uint32_t mSeed;
+
+    /**
+     * Values referenced by the edits. Only ever appended to so that recording
+     * an edit never has to move an element.
+     */
+    std::vector<T> mValues;
+};
+
+#include "../src/LinkedListEditBatch.cpp"
+
+#endif // LINKED_LIST_EDIT_BATCH_H
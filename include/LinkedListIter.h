@@ -6,18 +6,23 @@
 #include <exception>
 #include <iterator>
 
-template <typename T> class LinkedList;
+template <typename T, typename Allocator> class LinkedList;
 template <typename T> class LinkedListNode;
+template <typename K, typename V> class LinkedHashMap;
 
 /**
  * This header contains both the normal iterator and the const iterator for the
  * LinkedList container.  All of the methods for both classes should be self-explanatory
  *
+ * Because it hands out mutable references, dereferencing or stepping onto an
+ * element of a run of default values (see LinkedListNode::mCount) materializes
+ * that element into its own node first. This may allocate, and it invalidates
+ * const iterators pointing into the same run.
  */
-template <typename T>
-class LinkedListIterator : public std::iterator<std::bidirectional_iterator_tag, T> {
+template <typename T> class LinkedListIterator {
 public:
-    friend class LinkedList<T>;
+    template <typename U, typename Allocator> friend class LinkedList;
+    template <typename K, typename V> friend class LinkedHashMap;
     using iterator_category = std::bidirectional_iterator_tag;
     using value_type = T;
     using difference_type = int32_t;
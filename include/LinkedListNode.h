@@ -3,16 +3,25 @@
 #ifndef LINKED_LIST_NODE_H
 #define LINKED_LIST_NODE_H
 
+#include "LinkedListNodeBase.h"
+#include <cstdint>
+
 // Forward declarations (see include/LinkedList.h for an explanation)
-template <typename T> class LinkedList;
+template <typename T, typename Allocator> class LinkedList;
 template <typename T> class LinkedListIterator;
 template <typename T> class LinkedListConstIterator;
+template <typename K, typename V> class LinkedHashMap;
+template <typename T, typename Monoid> class AggregateList;
+template <typename T, typename Compare> class ConcurrentSortedList;
 
 /**
  * A helper utility class for implementing the LinkedList. Most of this class is
- * private so that only its friends may use its functionality.
+ * private so that only its friends may use its functionality. The links and
+ * the operations on them come from LinkedListNodeBase, which is shared by all
+ * element types; mPrev and mNext therefore point to LinkedListNodeBase, and
+ * prev() and next() return them as nodes of this type.
  */
-template <typename T> class LinkedListNode {
+template <typename T> class LinkedListNode : public LinkedListNodeBase {
 public:
     /**
      * Initializes this node to store the provided item. The next and previous
@@ -30,9 +39,12 @@ public:
     ~LinkedListNode() noexcept;
 
 private:
-    friend class LinkedList<T>;
+    template <typename U, typename Allocator> friend class LinkedList;
     friend class LinkedListIterator<T>;
     friend class LinkedListConstIterator<T>;
+    template <typename K, typename V> friend class LinkedHashMap;
+    template <typename U, typename Monoid> friend class AggregateList;
+    template <typename U, typename Compare> friend class ConcurrentSortedList;
 
     /**
      * Initializes this node with the provided values, i.e. the node stores
@@ -48,18 +60,49 @@ private:
     LinkedListNode(const T& item, LinkedListNode<T>* prev, LinkedListNode<T>* next);
 
     /**
-     * Establishes the proper linkage between the provided nodes.  First and
-     * second should never be nullptr, so don't bother checking for that.
+     * Returns the previous node.
+     * This operation is a no-throw.
+     *
+     * @return previous node
+     */
+    LinkedListNode<T>* prev() const noexcept;
+
+    /**
+     * Returns the next node.
+     * This operation is a no-throw.
+     *
+     * @return next node
+     */
+    LinkedListNode<T>* next() const noexcept;
+
+    /**
+     * Deletes first and every node reachable from it through mNext, up to (but
+     * not including) nullptr. The chain must already be detached from any
+     * list; the neighbors of the deleted nodes are not relinked, so each node
+     * is touched exactly once.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     *
+     * @param first first node of a nullptr-terminated chain (may be nullptr)
+     */
+    static void destroyChain(LinkedListNode<T>* first) noexcept;
+
+    /**
+     * Makes the element at offset within the run represented by node a node
+     * of its own and returns that node. node keeps representing the first
+     * element(s) of the run; the element at offset and the elements after it
+     * move to new nodes linked right after node. A node that represents a
+     * single element is returned as is. Either all new nodes are created and
+     * linked or, if creating one throws, the chain is left unchanged.
+     * This operation provides strong exception safety.
      *
-     * @param   first node to link as preceding node
-     * @param   second node to link as succeeding node
-     * @post    first and second are linked in that order
+     * @param node node whose run contains the element
+     * @param offset position of the element within the run (< node->mCount)
+     * @return node holding exactly the element at offset
      */
-    static void link(LinkedListNode<T>* first, LinkedListNode<T>* second) noexcept;
+    static LinkedListNode<T>* isolate(LinkedListNode<T>* node, uint32_t offset);
 
     T mItem;
-    LinkedListNode<T>* mPrev;
-    LinkedListNode<T>* mNext;
 };
 
 #include "../src/LinkedListNode.cpp"
@@ -0,0 +1,207 @@
+// LinkedListNodeBase.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef LINKED_LIST_NODE_BASE_H
+#define LINKED_LIST_NODE_BASE_H
+
+#include <cstdint>
+
+// Forward declarations (see include/LinkedList.h for an explanation)
+template <typename T> class LinkedListNode;
+template <typename T, typename Allocator> class LinkedList;
+template <typename T> class LinkedListIterator;
+template <typename T> class LinkedListConstIterator;
+template <typename K, typename V> class LinkedHashMap;
+template <typename T, typename Monoid> class AggregateList;
+template <typename T, typename Compare> class ConcurrentSortedList;
+
+/**
+ * The part of a LinkedListNode that does not depend on the element type: the
+ * links and the run count. Linking, unlinking, splicing, seeking and
+ * reordering never look at an item, so they are implemented once, on this
+ * class, in src/LinkedListNodeBase.cpp, instead of being instantiated for
+ * every element type. LinkedListNode<T> derives from it, adds the item and
+ * casts the links back to its own type.
+ *
+ * Every operation takes the dummy node of a circular list where it needs
+ * one; none of them allocates or throws. Like LinkedListNode, this class is
+ * private to its friends.
+ */
+class LinkedListNodeBase {
+private:
+    template <typename T> friend class LinkedListNode;
+    template <typename T, typename Allocator> friend class LinkedList;
+    template <typename T> friend class LinkedListIterator;
+    template <typename T> friend class LinkedListConstIterator;
+    template <typename K, typename V> friend class LinkedHashMap;
+    template <typename T, typename Monoid> friend class AggregateList;
+    template <typename T, typename Compare> friend class ConcurrentSortedList;
+
+    /**
+     * Initializes a node of count 1 linked only to itself.
+     * This operation is a no-throw.
+     */
+    LinkedListNodeBase() noexcept;
+
+    /**
+     * Destructor. Unlinks this node from its neighbors.
+     * This operation is a no-throw.
+     */
+    ~LinkedListNodeBase() noexcept;
+
+    LinkedListNodeBase(const LinkedListNodeBase&) = delete;
+    LinkedListNodeBase& operator=(const LinkedListNodeBase&) = delete;
+
+    /**
+     * Establishes the proper linkage between the provided nodes.  First and
+     * second should never be nullptr, so don't bother checking for that.
+     *
+     * @param   first node to link as preceding node
+     * @param   second node to link as succeeding node
+     * @post    first and second are linked in that order
+     */
+    static void link(LinkedListNodeBase* first, LinkedListNodeBase* second) noexcept;
+
+    /**
+     * Links the detached node in front of next.
+     * This operation is a no-throw.
+     *
+     * @param node node to insert
+     * @param next node of a list
+     */
+    static void insertBefore(LinkedListNodeBase* node, LinkedListNodeBase* next) noexcept;
+
+    /**
+     * Links the detached chain first..last in front of next.
+     * This operation is a no-throw.
+     *
+     * @param first first node of the chain
+     * @param last last node of the chain (its mNext is ignored)
+     * @param next node of a list
+     */
+    static void insertChain(
+        LinkedListNodeBase* first, LinkedListNodeBase* last, LinkedListNodeBase* next) noexcept;
+
+    /**
+     * Returns the node whose run contains the element at index of the list
+     * with dummy node dummy, and stores the position of that element within
+     * the run in offset.
+     * This operation is a no-throw.
+     *
+     * @pre index is less than the size of the list
+     * @param dummy dummy node of the list
+     * @param index index of the element
+     * @param offset receives the offset of the element within the node's run
+     * @return node containing the element
+     */
+    static LinkedListNodeBase* seek(
+        const LinkedListNodeBase* dummy, uint32_t index, uint32_t& offset) noexcept;
+
+    /**
+     * Cuts node and every node after it, up to dummy, out of the list and
+     * returns them as a nullptr-terminated chain, or returns nullptr if node
+     * is dummy.
+     * This operation is a no-throw.
+     *
+     * @param node first node to detach (may be dummy)
+     * @param dummy dummy node of the list
+     * @return first node of the detached chain, or nullptr
+     */
+    static LinkedListNodeBase* detachFrom(
+        LinkedListNodeBase* node, LinkedListNodeBase* dummy) noexcept;
+
+    /**
+     * Moves every node of the list with dummy node from in front of
+     * position, leaving that list empty.
+     * This operation is a no-throw.
+     *
+     * @param position node of another list
+     * @param from dummy node of the list whose nodes move
+     */
+    static void spliceAll(LinkedListNodeBase* position, LinkedListNodeBase* from) noexcept;
+
+    /**
+     * Unlinks node from its list and links it in front of next, which may
+     * belong to another list. Relinking the dummy node of a list rotates
+     * that list.
+     * This operation is a no-throw.
+     *
+     * @pre node is not next
+     * @param node node to move
+     * @param next node to move it in front of
+     */
+    static void relink(LinkedListNodeBase* node, LinkedListNodeBase* next) noexcept;
+
+    /**
+     * Moves node right after dummy.
+     * This operation is a no-throw.
+     *
+     * @pre node is neither dummy nor its successor
+     * @param node node to move
+     * @param dummy dummy node of the list
+     */
+    static void moveToFront(LinkedListNodeBase* node, LinkedListNodeBase* dummy) noexcept;
+
+    /**
+     * Swaps node with its predecessor.
+     * This operation is a no-throw.
+     *
+     * @pre neither node nor its predecessor is the dummy node
+     * @param node node to move one step toward the front
+     */
+    static void transpose(LinkedListNodeBase* node) noexcept;
+
+    LinkedListNodeBase* mPrev;
+    LinkedListNodeBase* mNext;
+
+    /**
+     * Number of consecutive list elements this node stands for. It is 1 for an
+     * ordinary node; a larger count marks a run of default-constructed
+     * elements (created when LinkedList::add fills a gap) that all share
+     * the item until one of them is materialized with isolate().
+     */
+    uint32_t mCount;
+};
+
+// The constructors, the destructor and link() are a few stores each and run
+// on every node operation, so they stay inline; everything else is defined
+// in src/LinkedListNodeBase.cpp.
+
+/**
+ * Initializes a node of count 1 linked only to itself.
+ * This operation is a no-throw.
+ */
+inline LinkedListNodeBase::LinkedListNodeBase() noexcept
+    : mPrev(this)
+    , mNext(this)
+    , mCount(1)
+{
+}
+
+/**
+ * Destructor. Unlinks this node from its neighbors.
+ * This operation is a no-throw.
+ */
+inline LinkedListNodeBase::~LinkedListNodeBase() noexcept
+{
+    link(mPrev, mNext);
+}
+
+/**
+ * Establishes the proper linkage between the provided nodes.  First and
+ * second should never be nullptr, so don't bother checking for that.
+ *
+ * @param   first node to link as preceding node
+ * @param   second node to link as succeeding node
+ * @post    first and second are linked in that order
+ */
+inline void LinkedListNodeBase::link(LinkedListNodeBase* first, LinkedListNodeBase* second) noexcept
+{
+    first->mNext = second;
+    second->mPrev = first;
+}
+
+#endif // LINKED_LIST_NODE_BASE_H
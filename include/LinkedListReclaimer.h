@@ -0,0 +1,103 @@
+// LinkedListReclaimer.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef LINKED_LIST_RECLAIMER_H
+#define LINKED_LIST_RECLAIMER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/**
+ * A background thread that frees node chains detached from lists. A list that
+ * has been handed a reclaimer (see LinkedList::setReclaimer) detaches its whole
+ * chain in constant time on clear() or destruction and retires it here, so the
+ * caller never pays for running element destructors and returning memory to
+ * the allocator.
+ *
+ * The reclaimer is not a template: a retired chain is an opaque pointer paired
+ * with the function that knows how to free it. One reclaimer may therefore
+ * serve lists of any element type, as long as those elements may be destroyed
+ * on a thread other than the one that created them.
+ *
+ * A reclaimer must outlive every list that uses it. Destroying the reclaimer
+ * frees everything that is still pending before the thread is joined.
+ */
+class LinkedListReclaimer {
+public:
+    /**
+     * Signature of the function that frees a retired chain.
+     */
+    using Reclaim = void (*)(void*) noexcept;
+
+    /**
+     * Starts the background thread.
+     * This operation provides strong exception safety.
+     */
+    LinkedListReclaimer();
+
+    LinkedListReclaimer(const LinkedListReclaimer&) = delete;
+    LinkedListReclaimer& operator=(const LinkedListReclaimer&) = delete;
+
+    /**
+     * Destructor. Frees all pending chains and joins the background thread.
+     * This operation is a no-throw.
+     */
+    ~LinkedListReclaimer() noexcept;
+
+    /**
+     * Queues chain to be freed by reclaim on the background thread. If the
+     * request cannot be queued, the chain is freed on the calling thread
+     * instead.
+     * This operation is a no-throw.
+     *
+     * @param chain opaque pointer to the detached chain
+     * @param reclaim function that frees chain
+     */
+    void retire(void* chain, Reclaim reclaim) noexcept;
+
+    /**
+     * Blocks until every chain retired before this call has been freed.
+     * This operation provides strong exception safety.
+     */
+    void flush();
+
+    /**
+     * Returns the number of chains freed on the background thread so far.
+     * This operation is a no-throw.
+     *
+     * @return number of reclaimed chains
+     */
+    uint64_t reclaimed() const noexcept;
+
+private:
+    /**
+     * A chain waiting to be freed.
+     */
+    struct Retired {
+        void* mChain;
+        Reclaim mReclaim;
+    };
+
+    /**
+     * Body of the background thread.
+     * This operation is a no-throw.
+     */
+    void run() noexcept;
+
+    mutable std::mutex mMutex;
+    std::condition_variable mWork;
+    std::condition_variable mIdle;
+    std::deque<Retired> mQueue;
+    uint64_t mRetired;
+    uint64_t mReclaimed;
+    bool mStopping;
+    std::thread mThread;
+};
+
+#endif // LINKED_LIST_RECLAIMER_H
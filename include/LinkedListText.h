@@ -0,0 +1,105 @@
+// LinkedListText.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef LINKED_LIST_TEXT_H
+#define LINKED_LIST_TEXT_H
+
+#include "LinkedList.h"
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * Converts elements of type T to and from text for toText() and
+ * fromText(). It is specialized here for arithmetic types, which are
+ * formatted with std::to_chars (the shortest representation that reads
+ * back exactly) and parsed with std::from_chars; other element types get
+ * text support by specializing it with the same two functions:
+ *
+ *     // Writes value at first and returns the end of its text, or nullptr
+ *     // if it does not fit in [first, last)
+ *     static char* format(char* first, char* last, const T& value);
+ *
+ *     // Reads a value from the start of [first, last) into value and
+ *     // returns the end of its text, or nullptr if there is none
+ *     static const char* parse(const char* first, const char* last, T& value);
+ *
+ * The text of an element must not contain whitespace, which separates
+ * elements.
+ */
+template <typename T, typename Enable = void> struct TextCodec;
+
+template <typename T>
+struct TextCodec<T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>> {
+    static char* format(char* first, char* last, const T& value) noexcept;
+    static const char* parse(const char* first, const char* last, T& value) noexcept;
+};
+
+/**
+ * Writes the elements of list to the file descriptor fd as text, each
+ * followed by separator (which must be whitespace). The text is built in
+ * a reusable buffer of kTextChunk bytes that is written with one write()
+ * call whenever it fills up, instead of element by element through a
+ * stream. If writing fails, an std::system_error is thrown; if the text of
+ * one element does not fit in the buffer, an std::length_error is thrown.
+ * This operation provides basic exception safety: list is not modified,
+ * but part of the text may have been written.
+ *
+ * @param list list to write
+ * @param fd file descriptor open for writing
+ * @param separator character written after every element
+ */
+template <typename T, typename Allocator>
+void toText(const LinkedList<T, Allocator>& list, int fd, char separator = '\n');
+
+/**
+ * Returns the elements of list as text, in the format written by
+ * toText(list, fd, separator).
+ * This operation provides strong exception safety.
+ *
+ * @param list list to format
+ * @param separator character written after every element
+ * @return text of the elements
+ */
+template <typename T, typename Allocator>
+std::string toText(const LinkedList<T, Allocator>& list, char separator = '\n');
+
+/**
+ * Reads whitespace-separated elements from the file descriptor fd until
+ * its end and appends them to list. The file is read in chunks of
+ * kTextChunk bytes with one read() call each and parsed in place. If
+ * reading fails, an std::system_error is thrown; if the text holds
+ * something that is not an element, or an element longer than a chunk,
+ * an std::invalid_argument exception is thrown with the offset of that
+ * text in the file as its message.
+ * This operation provides strong exception safety for list.
+ *
+ * @param list list to append to
+ * @param fd file descriptor open for reading
+ */
+template <typename T, typename Allocator> void fromText(LinkedList<T, Allocator>& list, int fd);
+
+/**
+ * Parses the whitespace-separated elements in text and appends them to
+ * list, throwing like fromText(list, fd) on malformed text.
+ * This operation provides strong exception safety.
+ *
+ * @param list list to append to
+ * @param text text to parse
+ */
+template <typename T, typename Allocator>
+void fromText(LinkedList<T, Allocator>& list, std::string_view text);
+
+/**
+ * Size of the buffers toText() and fromText() work in.
+ */
+const size_t kTextChunk = 64 * 1024;
+
+#include "../src/LinkedListText.cpp"
+
+#endif // LINKED_LIST_TEXT_H
@@ -0,0 +1,200 @@
+// LinkedListTrace.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef LINKED_LIST_TRACE_H
+#define LINKED_LIST_TRACE_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * Kinds of LinkedList operations a trace records. Add is add(value) (or
+ * add(index, value) at the end); Insert is any other add(index, value);
+ * Find is find() or findIf(); Iterate is a call to begin(); Erase is
+ * erase(iterator). SpliceIn and SpliceOut are the two sides of a splice()
+ * between lists, each recorded by the list it changes; Move is a splice()
+ * within one list, moveToFront() or moveToBack(); Rotate is rotate(); Apply
+ * is apply() of an edit batch.
+ */
+enum class TraceOp : uint8_t {
+    Add,
+    Insert,
+    Get,
+    Set,
+    Remove,
+    Clear,
+    Find,
+    Iterate,
+    Erase,
+    SpliceIn,
+    SpliceOut,
+    Move,
+    Rotate,
+    Apply
+};
+
+/**
+ * One recorded operation. mIndex is the index the operation was given (for
+ * Add, the size; for Find, the position of the element found, or the size
+ * if there was none; for Clear and Iterate, 0; for Erase, the position of
+ * the erased element; for SpliceIn, the position the elements were
+ * inserted at; for SpliceOut, the position of the first element taken; for
+ * Move, the position of the moved element; for Rotate, the number of
+ * positions modulo the size; for Apply, the size afterwards) and mSize is
+ * the size of the list before the operation. mCount is the number of
+ * elements spliced for SpliceIn and SpliceOut, the position the element
+ * was moved in front of for Move (the size for the end), the number of
+ * edits for Apply, and 0 for the other kinds.
+ */
+struct TraceEvent {
+    uint64_t mTime;
+    uint32_t mIndex;
+    uint32_t mSize;
+    uint32_t mCount;
+    TraceOp mOp;
+};
+
+/**
+ * Writes the operations of the lists it is attached to (see
+ * LinkedList::setRecorder) to a binary trace file, to be replayed against
+ * other list implementations with the list_replay tool.
+ *
+ * The file starts with an 8-byte magic string. Each event is then one byte
+ * for the kind followed by three unsigned LEB128 varints: nanoseconds since
+ * the previous event (since the recorder was created for the first one),
+ * the index and the size, and for the kinds that have one a fourth varint
+ * holding the count. A typical event takes 5 to 8 bytes.
+ *
+ * Events are buffered and written in blocks. Recording never throws: if a
+ * write fails, recording stops and the error is reported by the next
+ * flush(). Like LinkedList, a recorder must only be used by one thread at a
+ * time; attaching it to a single list gives a trace that replays exactly.
+ */
+class LinkedListTraceRecorder {
+public:
+    /**
+     * Creates (or truncates) the trace file at path. If it cannot be
+     * created, an std::system_error is thrown.
+     * This operation provides strong exception safety.
+     *
+     * @param path file to write
+     */
+    explicit LinkedListTraceRecorder(const std::string& path);
+
+    LinkedListTraceRecorder(const LinkedListTraceRecorder&) = delete;
+    LinkedListTraceRecorder& operator=(const LinkedListTraceRecorder&) = delete;
+
+    /**
+     * Destructor. Writes the buffered events and closes the file; errors
+     * are ignored (call flush() first to see them).
+     * This operation is a no-throw.
+     */
+    ~LinkedListTraceRecorder() noexcept;
+
+    /**
+     * Appends an event stamped with the current time.
+     * This operation is a no-throw.
+     *
+     * @param op kind of operation
+     * @param index index of the operation (see TraceEvent)
+     * @param size size of the list before the operation
+     * @param count count of the operation (see TraceEvent)
+     */
+    void record(TraceOp op, uint32_t index, uint32_t size, uint32_t count = 0) noexcept;
+
+    /**
+     * Writes the buffered events to the file. If this or an earlier write
+     * failed, an std::system_error is thrown.
+     * This operation provides strong exception safety.
+     */
+    void flush();
+
+    /**
+     * Returns the number of events recorded so far.
+     * This operation is a no-throw.
+     *
+     * @return number of events
+     */
+    uint64_t recorded() const noexcept;
+
+private:
+    /**
+     * Appends value to the buffer as an unsigned LEB128 varint.
+     * This operation is a no-throw.
+     */
+    void put(uint64_t value) noexcept;
+
+    /**
+     * Writes the buffer to the file and empties it, remembering the error
+     * if the write fails.
+     * This operation is a no-throw.
+     */
+    void drain() noexcept;
+
+    std::FILE* mFile;
+    std::vector<unsigned char> mBuffer;
+    std::chrono::steady_clock::time_point mLast;
+    uint64_t mRecorded;
+
+    /**
+     * errno of the first failed write, or 0.
+     */
+    int mError;
+};
+
+/**
+ * Reads back a trace written by LinkedListTraceRecorder.
+ */
+class LinkedListTraceReader {
+public:
+    /**
+     * Opens the trace file at path. If it cannot be opened, an
+     * std::system_error is thrown; if it is not a trace, an
+     * std::invalid_argument exception is thrown with path as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param path file to read
+     */
+    explicit LinkedListTraceReader(const std::string& path);
+
+    LinkedListTraceReader(const LinkedListTraceReader&) = delete;
+    LinkedListTraceReader& operator=(const LinkedListTraceReader&) = delete;
+
+    /**
+     * Destructor. Closes the file.
+     * This operation is a no-throw.
+     */
+    ~LinkedListTraceReader() noexcept;
+
+    /**
+     * Reads the next event into event, with mTime made absolute (since the
+     * recorder was created). Returns false at the end of the trace. If the
+     * trace ends in the middle of an event or holds an unknown kind, an
+     * std::invalid_argument exception is thrown with the path as its
+     * message.
+     * This operation provides basic exception safety.
+     *
+     * @param event receives the event
+     * @return true iff an event was read
+     */
+    bool next(TraceEvent& event);
+
+private:
+    /**
+     * Reads an unsigned LEB128 varint, throwing like next() on a truncated
+     * or overlong one.
+     */
+    uint64_t get();
+
+    std::FILE* mFile;
+    std::string mPath;
+    uint64_t mTime;
+};
+
+#endif // LINKED_LIST_TRACE_H
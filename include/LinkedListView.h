@@ -0,0 +1,208 @@
+// LinkedListView.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef LINKED_LIST_VIEW_H
+#define LINKED_LIST_VIEW_H
+
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Holds the function of a view adaptor inside its iterators. Lambdas that
+ * capture cannot be assigned, but iterators must be, so assignment copies
+ * the new function aside, destroys the held one and moves the copy in its
+ * place. That last step must not fail, so F must be nothrow move
+ * constructible, which a lambda is when all of its captures are.
+ */
+template <typename F> class ViewFunction {
+    static_assert(std::is_nothrow_move_constructible_v<F>,
+        "a view function must be nothrow move constructible");
+
+public:
+    explicit ViewFunction(const F& function);
+    ViewFunction(const ViewFunction<F>& src) = default;
+    ViewFunction<F>& operator=(const ViewFunction<F>& rhs);
+
+    template <typename... Args> decltype(auto) operator()(Args&&... args) const;
+
+private:
+    std::optional<F> mFunction;
+};
+
+// The adaptors take their reference types from what dereferencing the
+// underlying iterator actually yields: LinkedListConstIterator declares T& in
+// its traits but returns const T&.
+
+/**
+ * Iterator of LinkedListView::transformed: dereferencing it calls the
+ * function on the element the underlying iterator points to and yields
+ * the result. When the function returns a reference, the iterator has the
+ * category of the underlying one (so elements may be assigned through it);
+ * otherwise it yields values and is an input iterator.
+ */
+template <typename Iterator, typename F> class TransformIterator {
+public:
+    using reference = std::invoke_result_t<const F&, decltype(*std::declval<const Iterator&>())>;
+    using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+    using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+    using pointer = void;
+    using iterator_category = std::conditional_t<std::is_reference_v<reference>,
+        typename std::iterator_traits<Iterator>::iterator_category, std::input_iterator_tag>;
+
+    TransformIterator(Iterator current, const F& function);
+
+    bool operator==(const TransformIterator<Iterator, F>& rhs) const;
+    bool operator!=(const TransformIterator<Iterator, F>& rhs) const;
+    reference operator*() const;
+    TransformIterator<Iterator, F>& operator++();
+    TransformIterator<Iterator, F> operator++(int);
+    TransformIterator<Iterator, F>& operator--();
+    TransformIterator<Iterator, F> operator--(int);
+
+private:
+    Iterator mCurrent;
+    ViewFunction<F> mFunction;
+};
+
+/**
+ * Iterator of LinkedListView::filtered: steps over the elements for which
+ * the predicate returns false. It is at most a forward iterator; stepping
+ * it evaluates the predicate on the elements it passes, and dereferencing
+ * it does not.
+ */
+template <typename Iterator, typename Predicate> class FilterIterator {
+public:
+    using reference = decltype(*std::declval<const Iterator&>());
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+    using pointer = void;
+    using iterator_category = std::conditional_t<
+        std::is_base_of_v<std::forward_iterator_tag,
+            typename std::iterator_traits<Iterator>::iterator_category>,
+        std::forward_iterator_tag, std::input_iterator_tag>;
+
+    FilterIterator(Iterator current, Iterator last, const Predicate& pred);
+
+    bool operator==(const FilterIterator<Iterator, Predicate>& rhs) const;
+    bool operator!=(const FilterIterator<Iterator, Predicate>& rhs) const;
+    reference operator*() const;
+    FilterIterator<Iterator, Predicate>& operator++();
+    FilterIterator<Iterator, Predicate> operator++(int);
+
+private:
+    /**
+     * Moves mCurrent to the first element from mCurrent on that satisfies
+     * the predicate, or to mLast.
+     */
+    void satisfy();
+
+    Iterator mCurrent;
+    Iterator mLast;
+    ViewFunction<Predicate> mPred;
+};
+
+/**
+ * A non-owning view of the elements in [first, last) of a LinkedList (or of
+ * any other range given by a pair of iterators). A view copies nothing and
+ * allocates nothing: it is a pair of iterators, and iterating it walks the
+ * underlying list. transformed() and filtered() return views over the same
+ * elements that apply a function or skip elements lazily, while being
+ * iterated, so a pipeline such as
+ *
+ *     sublist(list.begin(), list.end()).filtered(isDue).transformed(cost)
+ *
+ * traverses the list once, in a single pass, with no intermediate list.
+ *
+ * A view is invalidated by whatever invalidates its iterators: it must not
+ * outlive the list, and the elements at first and last must not be
+ * removed while it is in use. Creating a filtered view evaluates the
+ * predicate up to the first element that satisfies it (see filtered()).
+ */
+template <typename Iterator> class LinkedListView {
+public:
+    using iterator = Iterator;
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using reference = decltype(*std::declval<const Iterator&>());
+
+    /**
+     * Initializes a view of the elements in [first, last).
+     * This operation provides strong exception safety.
+     *
+     * @param first iterator to the first element
+     * @param last iterator past the last element
+     */
+    LinkedListView(Iterator first, Iterator last);
+
+    /**
+     * Returns an iterator to the first element of this view.
+     * This operation provides strong exception safety.
+     *
+     * @return iterator to the first element
+     */
+    Iterator begin() const;
+
+    /**
+     * Returns an iterator past the last element of this view.
+     * This operation provides strong exception safety.
+     *
+     * @return iterator past the last element
+     */
+    Iterator end() const;
+
+    /**
+     * Returns true if this view has no elements and false otherwise.
+     * This operation provides strong exception safety.
+     *
+     * @return bool True when empty
+     */
+    bool isEmpty() const;
+
+    /**
+     * Returns a view of the results of calling function on each element of
+     * this view. function is called every time an element is dereferenced,
+     * not when the view is created.
+     * This operation provides strong exception safety.
+     *
+     * @param function callable taking this view's reference type
+     * @return transformed view
+     */
+    template <typename F>
+    LinkedListView<TransformIterator<Iterator, F>> transformed(F function) const;
+
+    /**
+     * Returns a view of the elements of this view that satisfy pred, in
+     * order. The view's begin() is found when the view is created, so this
+     * evaluates pred on the elements up to the first that satisfies it; all
+     * other elements are tested while the view is iterated.
+     * This operation provides strong exception safety.
+     *
+     * @param pred predicate taking this view's reference type
+     * @return filtered view
+     */
+    template <typename Predicate>
+    LinkedListView<FilterIterator<Iterator, Predicate>> filtered(Predicate pred) const;
+
+private:
+    Iterator mFirst;
+    Iterator mLast;
+};
+
+/**
+ * Returns a view of the elements in [first, last), typically of a
+ * LinkedList, without copying them.
+ * This operation provides strong exception safety.
+ *
+ * @param first iterator to the first element
+ * @param last iterator past the last element
+ * @return view of the range
+ */
+template <typename Iterator> LinkedListView<Iterator> sublist(Iterator first, Iterator last);
+
+#include "../src/LinkedListView.cpp"
+
+#endif // LINKED_LIST_VIEW_H
@@ -0,0 +1,349 @@
+// RcuLinkedList.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef RCU_LINKED_LIST_H
+#define RCU_LINKED_LIST_H
+
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+/**
+ * A list with one writer thread and any number of concurrent reader threads
+ * that never block each other (read-copy-update).
+ *
+ * Readers open a ReadGuard and iterate through it without taking any lock:
+ * the list is a singly-linked chain of nodes whose links are published with
+ * release stores, and elements are never modified in place. The writer
+ * replaces a node to set an element and unlinks a node to remove one, so a
+ * reader always sees every element either before or after a given update.
+ *
+ * Unlinked nodes are reclaimed with epoch-based reclamation. A ReadGuard
+ * records the global epoch in a reader slot for as long as it is open. Every
+ * node the writer unlinks is tagged with the epoch at which it was retired,
+ * and the epoch is then advanced; a retired node is freed once every open
+ * guard was opened at a later epoch, since such a reader can no longer reach
+ * it. Reclamation is attempted by the writer whenever enough nodes have been
+ * retired and on synchronize().
+ *
+ * Only one thread may call the mutating methods (add, remove, set, clear and
+ * synchronize) and get() at a time; size(), isEmpty() and read() may be called
+ * from any thread. A reader must not keep a guard open while waiting on the
+ * writer, and the list must not be destroyed while a guard is open.
+ */
+template <typename T> class RcuLinkedList {
+private:
+    struct Node;
+
+public:
+    class const_iterator;
+    class ReadGuard;
+
+    // typedefs for interoperability/compatibility with STL containers
+    using value_type = T;
+
+    /**
+     * Initializes an empty RcuLinkedList that supports up to readerSlots
+     * simultaneously open read guards. Opening more guards waits for one to
+     * be closed.
+     * This operation provides strong exception safety.
+     *
+     * @param readerSlots maximum number of simultaneously open guards
+     */
+    explicit RcuLinkedList(uint32_t readerSlots = 128);
+
+    RcuLinkedList(const RcuLinkedList<T>&) = delete;
+    RcuLinkedList<T>& operator=(const RcuLinkedList<T>&) = delete;
+
+    /**
+     * Destructor. Releases all resources held by this RcuLinkedList,
+     * including retired nodes that have not been reclaimed yet.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     */
+    ~RcuLinkedList() noexcept;
+
+    /**
+     * Adds value to the end of this RcuLinkedList in constant time.
+     * This operation provides strong exception safety.
+     *
+     * @param value value to append to this RcuLinkedList
+     */
+    void add(const T& value);
+
+    /**
+     * Inserts value at the specified index. If this RcuLinkedList needs to be
+     * enlarged (index is out of range) default values are used to fill the
+     * gaps; readers see the gap and value appear at once.
+     * This operation provides strong exception safety.
+     *
+     * @param index index at which to insert value
+     * @param value the element to insert
+     */
+    void add(uint32_t index, const T& value);
+
+    /**
+     * Empties this RcuLinkedList. The removed nodes are reclaimed once no
+     * reader can reach them any more.
+     * This operation provides strong exception safety.
+     */
+    void clear();
+
+    /**
+     * Returns a constant reference to the element stored at the provided index
+     * for use by the writer thread. If index is out of bounds, an
+     * std::out_of_range exception is thrown with the index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the element to return
+     * @return constant reference to the element at the index.
+     */
+    const T& get(uint32_t index) const;
+
+    /**
+     * Returns true if this RcuLinkedList is empty and false otherwise.
+     * This operation is a no-throw.
+     *
+     * @return bool True when empty
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * Opens a read guard through which the calling thread may iterate this
+     * RcuLinkedList without locking.
+     * This operation is a no-throw.
+     *
+     * @return the open guard
+     */
+    ReadGuard read() const noexcept;
+
+    /**
+     * Removes the element at the specified index. If index is out of bounds
+     * an std::out_of_range exception is thrown with index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the object to remove.
+     */
+    void remove(uint32_t index);
+
+    /**
+     * Replaces the element at the specified index with a copy of value. If
+     * index is out of bounds, an std::out_of_range exception is thrown with the
+     * index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the object to set
+     * @param value the new value
+     */
+    void set(uint32_t index, const T& value);
+
+    /**
+     * Return the size of this RcuLinkedList.
+     * This operation is a no-throw.
+     *
+     * @return
+     */
+    uint32_t size() const noexcept;
+
+    /**
+     * Blocks until every node retired so far has been freed, i.e. until every
+     * guard that was open when this method was called has been closed.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     */
+    void synchronize() noexcept;
+
+    /**
+     * Returns the number of retired nodes (or chains, for clear()) that are
+     * still waiting to be freed.
+     * This operation is a no-throw.
+     *
+     * @return number of pending retired entries
+     */
+    size_t pending() const noexcept;
+
+    /**
+     * Forward iterator over the elements visible to a ReadGuard.
+     */
+    class const_iterator {
+    public:
+        friend class RcuLinkedList<T>;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = int32_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        bool operator==(const const_iterator& rhs) const noexcept;
+        bool operator!=(const const_iterator& rhs) const noexcept;
+        const T& operator*() const;
+        const T* operator->() const;
+        const_iterator& operator++();
+        const const_iterator operator++(int);
+
+    private:
+        const Node* mPtr;
+        explicit const_iterator(const Node* ptr);
+    };
+
+    /**
+     * Keeps the nodes reachable when it was opened alive until it is closed
+     * (destroyed). Iterators obtained from a guard must not be used after the
+     * guard has been closed.
+     */
+    class ReadGuard {
+    public:
+        friend class RcuLinkedList<T>;
+
+        ReadGuard(ReadGuard&& other) noexcept;
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+        ReadGuard& operator=(ReadGuard&&) = delete;
+
+        /**
+         * Closes the guard.
+         * This operation is a no-throw.
+         */
+        ~ReadGuard() noexcept;
+
+        /**
+         * Returns an iterator to the first element visible to this guard.
+         * This operation is a no-throw.
+         *
+         * @return const_iterator
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * Returns an iterator to the end.
+         * This operation is a no-throw.
+         *
+         * @return const_iterator
+         */
+        const_iterator end() const noexcept;
+
+    private:
+        const RcuLinkedList<T>* mList;
+        uint32_t mSlot;
+        ReadGuard(const RcuLinkedList<T>* list, uint32_t slot) noexcept;
+    };
+
+private:
+    /**
+     * Elements are immutable once published; only mNext changes.
+     */
+    struct Node {
+        T mItem;
+        std::atomic<Node*> mNext;
+
+        explicit Node(const T& item);
+    };
+
+    /**
+     * A reader slot holds the epoch at which its guard was opened, or 0 when
+     * it is free. Slots are padded to a cache line each so that readers do not
+     * share the lines they write.
+     */
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> mEpoch;
+    };
+
+    /**
+     * A node (or, for clear(), a whole nullptr-terminated chain) that has been
+     * unlinked at epoch mEpoch.
+     */
+    struct Retired {
+        Node* mNode;
+        uint64_t mEpoch;
+        bool mChain;
+    };
+
+    /**
+     * Number of retired entries after which the writer tries to reclaim.
+     */
+    static constexpr size_t kReclaimThreshold = 64;
+
+    /**
+     * Given an index, this method throws an std::out_of_range with the index as
+     * its message if index is out of bounds or is a no-op otherwise.
+     * This operation provides strong exception safety.
+     *
+     * @param index index to check
+     */
+    void rangeCheck(uint32_t index) const;
+
+    /**
+     * Returns the link that points at the element at index (mHead for 0).
+     * Writer only.
+     * This operation is a no-throw.
+     *
+     * @param index index of the element, at most size()
+     * @return the link in front of the element
+     */
+    std::atomic<Node*>& linkBefore(uint32_t index) noexcept;
+
+    /**
+     * Queues an unlinked node or chain for reclamation and advances the epoch.
+     * The caller must have reserved room in mRetired.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     */
+    void retire(Node* node, bool chain) noexcept;
+
+    /**
+     * Frees every retired entry that no open guard can reach.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     */
+    void reclaim() noexcept;
+
+    /**
+     * Claims a reader slot for the current epoch and returns its index.
+     * This operation is a no-throw.
+     */
+    uint32_t pin() const noexcept;
+
+    /**
+     * Deletes the nullptr-terminated chain starting at first.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     */
+    static void destroyChain(Node* first) noexcept;
+
+    /**
+     * The first node; readers start here.
+     */
+    std::atomic<Node*> mHead;
+
+    /**
+     * The link that points past the last node (mHead when empty). Writer only.
+     */
+    std::atomic<Node*>* mTailLink;
+
+    /**
+     * Number of elements, readable from any thread.
+     */
+    std::atomic<uint32_t> mSize;
+
+    /**
+     * The global epoch; starts at 1 so that 0 can mark a free reader slot.
+     */
+    std::atomic<uint64_t> mEpoch;
+
+    uint32_t mSlotCount;
+    std::unique_ptr<Slot[]> mSlots;
+
+    /**
+     * Entries in retirement order, hence in non-decreasing epoch order.
+     */
+    std::vector<Retired> mRetired;
+};
+
+#include "../src/RcuLinkedList.cpp"
+
+#endif // RCU_LINKED_LIST_H
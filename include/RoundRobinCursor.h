@@ -0,0 +1,81 @@
+// RoundRobinCursor.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef ROUND_ROBIN_CURSOR_H
+#define ROUND_ROBIN_CURSOR_H
+
+#include "LinkedList.h"
+#include <memory>
+
+/**
+ * A persistent position in a LinkedList that hands out its elements in
+ * round-robin order: next() steps to the following element, wrapping from
+ * the last element back to the first without ever stopping on the dummy
+ * node. It replaces rotating a ready list with remove(0) and add(), which
+ * frees a node, allocates another and copies the element on every step;
+ * stepping the cursor only follows a link.
+ *
+ * The cursor stays valid while elements are added, moved (see
+ * LinkedList::moveToBack) or removed, as long as the current element (or,
+ * right after erase(), the element next() is about to return) is only
+ * removed through erase(). The list must outlive the cursor.
+ */
+template <typename T, typename Allocator = std::allocator<T>> class RoundRobinCursor {
+public:
+    using iterator = typename LinkedList<T, Allocator>::iterator;
+
+    /**
+     * Initializes a cursor over list whose first call to next() returns
+     * the first element.
+     * This operation is a no-throw.
+     *
+     * @param list list to cycle through
+     */
+    explicit RoundRobinCursor(LinkedList<T, Allocator>& list) noexcept;
+
+    /**
+     * Steps to the next element, wrapping around at the end of the list,
+     * and returns a reference to it. If the list is empty, an
+     * std::out_of_range exception is thrown with 0 as its message.
+     * This operation provides strong exception safety.
+     *
+     * @return reference to the new current element
+     */
+    T& next();
+
+    /**
+     * Removes the current element from the list, so that the following
+     * call to next() returns the element that came after it. Does nothing
+     * if there is no current element.
+     * This operation is no-throw under the assumption that the
+     * parameterizing type's destructor is no-throw.
+     */
+    void erase() noexcept;
+
+    /**
+     * Returns an iterator to the current element, or the end() of the list
+     * if next() has not been called since the cursor was created or
+     * erase() was last called.
+     * This operation is a no-throw.
+     *
+     * @return iterator to the current element
+     */
+    iterator position() const noexcept;
+
+private:
+    LinkedList<T, Allocator>* mList;
+    iterator mCurrent;
+
+    /**
+     * False when mCurrent already is the element next() must return, which
+     * is the case after erase().
+     */
+    bool mStep;
+};
+
+#include "../src/RoundRobinCursor.cpp"
+
+#endif // ROUND_ROBIN_CURSOR_H
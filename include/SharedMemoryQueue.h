@@ -0,0 +1,308 @@
+// SharedMemoryQueue.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef SHARED_MEMORY_QUEUE_H
+#define SHARED_MEMORY_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <pthread.h>
+#include <string>
+#include <type_traits>
+
+/**
+ * A bounded FIFO queue of trivially copyable records in a POSIX shared
+ * memory object, for passing records between processes on one machine.
+ *
+ * The object holds a control block followed by capacity nodes. Like
+ * LinkedListNode, every node has a previous and a next link and the queue is
+ * a circular doubly-linked chain through a dummy node (in the control
+ * block), but the links are byte offsets from the start of the object rather
+ * than pointers, so each process may map it at a different address. Unused
+ * nodes form a free list threaded through their next links.
+ *
+ * All operations take a process-shared, robust mutex. Blocking push() and
+ * pop() sleep on a futex word outside the mutex and are woken by the
+ * process that makes room or adds a record. If a process dies while holding
+ * the mutex, the next process to lock it repairs the chain before going on:
+ * every change to the chain is ordered so that following next links from
+ * the dummy node always yields exactly the queued records, so the repair
+ * walks that chain, recomputes the previous links and the size and returns
+ * every other node to the free list. A record being popped by the process
+ * that died may be lost; a record being pushed is either queued or not.
+ * The counts of sleeping processes may include processes that died while
+ * waiting; they are reset, and every sleeper woken to register again, by
+ * the repair and whenever a wake-up finds nobody asleep.
+ *
+ * create() makes a new object, open() attaches to one made by create() (in
+ * this or another process) and unlink() removes its name. A
+ * SharedMemoryQueue handle unmaps the object when destroyed, but does not
+ * remove it. Failing system calls throw std::system_error.
+ */
+template <typename T> class SharedMemoryQueue {
+public:
+    static_assert(std::is_trivially_copyable_v<T>, "records are copied as raw bytes");
+
+    /**
+     * Creates the shared memory object name (which must not exist yet)
+     * holding an empty queue of capacity records and maps it.
+     * This operation provides strong exception safety.
+     *
+     * @param name POSIX shared memory name, e.g. "/records"
+     * @param capacity maximum number of queued records
+     * @return handle to the new queue
+     */
+    static SharedMemoryQueue<T> create(const std::string& name, uint32_t capacity);
+
+    /**
+     * Maps the existing queue name. If it was not made by create() for
+     * records of this size, an std::invalid_argument exception is thrown
+     * with the name as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param name POSIX shared memory name
+     * @return handle to the queue
+     */
+    static SharedMemoryQueue<T> open(const std::string& name);
+
+    /**
+     * Removes the name of a shared memory object. Mapped handles keep
+     * working. A name that does not exist is ignored.
+     * This operation is a no-throw.
+     *
+     * @param name POSIX shared memory name
+     */
+    static void unlink(const std::string& name) noexcept;
+
+    SharedMemoryQueue(SharedMemoryQueue<T>&& other) noexcept;
+    SharedMemoryQueue(const SharedMemoryQueue<T>&) = delete;
+    SharedMemoryQueue<T>& operator=(const SharedMemoryQueue<T>&) = delete;
+    SharedMemoryQueue<T>& operator=(SharedMemoryQueue<T>&&) = delete;
+
+    /**
+     * Destructor. Unmaps the queue.
+     * This operation is a no-throw.
+     */
+    ~SharedMemoryQueue() noexcept;
+
+    /**
+     * Appends record, waiting while the queue is full.
+     * This operation provides strong exception safety.
+     *
+     * @param record record to append
+     */
+    void push(const T& record);
+
+    /**
+     * Appends record if the queue is not full.
+     * This operation provides strong exception safety.
+     *
+     * @param record record to append
+     * @return true iff the record was appended
+     */
+    bool tryPush(const T& record);
+
+    /**
+     * Removes and returns the oldest record, waiting while the queue is
+     * empty.
+     * This operation provides strong exception safety.
+     *
+     * @return the oldest record
+     */
+    T pop();
+
+    /**
+     * Removes the oldest record into record if the queue is not empty.
+     * This operation provides strong exception safety.
+     *
+     * @param record receives the oldest record
+     * @return true iff a record was removed
+     */
+    bool tryPop(T& record);
+
+    /**
+     * Returns the number of queued records.
+     * This operation provides strong exception safety.
+     *
+     * @return number of queued records
+     */
+    uint32_t size();
+
+    /**
+     * Returns the maximum number of queued records.
+     * This operation is a no-throw.
+     *
+     * @return capacity
+     */
+    uint32_t capacity() const noexcept;
+
+    /**
+     * Returns how many times a process found the mutex abandoned by a dead
+     * owner and repaired the queue, over the lifetime of the object.
+     * This operation provides strong exception safety.
+     *
+     * @return number of repairs
+     */
+    uint64_t recoveries();
+
+private:
+    /**
+     * A queue node. Links are byte offsets from the start of the mapping.
+     */
+    struct Node {
+        uint64_t mPrev;
+        uint64_t mNext;
+        T mItem;
+    };
+
+    /**
+     * Stored in Control::mMagic once create() has initialized the object.
+     */
+    static constexpr uint64_t kMagic = 0x324d485351534c4c;
+
+    /**
+     * The start of the shared memory object.
+     */
+    struct Control {
+        std::atomic<uint64_t> mMagic;
+        uint64_t mNodeSize;
+        uint32_t mCapacity;
+        uint32_t mSize;
+        pthread_mutex_t mMutex;
+
+        /**
+         * Futex words, bumped whenever a record is added (mAdded) or
+         * removed (mRemoved) and when the waiters are reset, and the number
+         * of processes sleeping on each. A process only takes itself off a
+         * count it joined in the current mWaiterEpoch.
+         */
+        std::atomic<uint32_t> mAdded;
+        std::atomic<uint32_t> mRemoved;
+        uint32_t mPoppers;
+        uint32_t mPushers;
+        uint32_t mWaiterEpoch;
+
+        /**
+         * Offset of the first free node, 0 if there is none.
+         */
+        uint64_t mFree;
+        uint64_t mRecoveries;
+        Node mDummy;
+    };
+
+    /**
+     * Locks the queue for the lifetime of the guard, repairing it first if
+     * the previous owner died.
+     */
+    class Lock {
+    public:
+        explicit Lock(SharedMemoryQueue<T>& queue);
+        ~Lock() noexcept;
+        Lock(const Lock&) = delete;
+        Lock& operator=(const Lock&) = delete;
+
+    private:
+        Control* mControl;
+    };
+
+    SharedMemoryQueue(unsigned char* base, size_t bytes) noexcept;
+
+    /**
+     * Returns the size of an object holding capacity nodes.
+     * This operation is a no-throw.
+     */
+    static size_t bytesFor(uint32_t capacity) noexcept;
+
+    /**
+     * Maps the object open as fd, of bytes bytes, and closes fd.
+     * This operation provides strong exception safety.
+     */
+    static unsigned char* map(int fd, size_t bytes);
+
+    /**
+     * Converts between nodes and their offsets.
+     * This operation is a no-throw.
+     */
+    Node* at(uint64_t offset) const noexcept;
+    uint64_t offsetOf(const Node* node) const noexcept;
+
+    /**
+     * Returns true if offset is the offset of one of the capacity nodes.
+     * This operation is a no-throw.
+     */
+    bool isNode(uint64_t offset) const noexcept;
+
+    /**
+     * Links a free node holding record before the dummy node.
+     * This operation is a no-throw.
+     *
+     * @pre the queue is locked and not full
+     * @return true if a process is waiting for a record to be added
+     */
+    bool append(const T& record) noexcept;
+
+    /**
+     * Unlinks the first node, copies its record into record and returns the
+     * node to the free list.
+     * This operation is a no-throw.
+     *
+     * @pre the queue is locked and not empty
+     * @return true if a process is waiting for a record to be removed
+     */
+    bool takeFirst(T& record) noexcept;
+
+    /**
+     * Rebuilds the previous links, the size and the free list from the
+     * chain of next links (see the class description), and resets the
+     * waiters, which may include the process that died.
+     * This operation is a no-throw.
+     *
+     * @pre the queue is locked
+     */
+    void repair() noexcept;
+
+    /**
+     * Forgets the sleeping processes: zeroes both counts, starts a new
+     * waiter epoch and wakes every sleeper, so that those still alive
+     * register again.
+     * This operation is a no-throw.
+     *
+     * @pre the queue is locked
+     */
+    void resetWaiters() noexcept;
+
+    /**
+     * Wakes the processes sleeping on word, which the counts say exist. If
+     * none was asleep, the count includes processes that died while
+     * waiting, and the waiters are reset.
+     * This operation is a no-throw.
+     *
+     * @pre the queue is not locked by this process
+     */
+    void notify(std::atomic<uint32_t>& word) noexcept;
+
+    /**
+     * Sleeps until word differs from expected (or a spurious wake-up).
+     * This operation is a no-throw.
+     */
+    static void wait(std::atomic<uint32_t>& word, uint32_t expected) noexcept;
+
+    /**
+     * Wakes the processes sleeping on word and returns true iff there were
+     * any (or the call failed).
+     * This operation is a no-throw.
+     */
+    static bool wake(std::atomic<uint32_t>& word) noexcept;
+
+    unsigned char* mBase;
+    size_t mBytes;
+    Control* mControl;
+};
+
+#include "../src/SharedMemoryQueue.cpp"
+
+#endif // SHARED_MEMORY_QUEUE_H
@@ -0,0 +1,248 @@
+// SmallLinkedList.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef SMALL_LINKED_LIST_H
+#define SMALL_LINKED_LIST_H
+
+#include "LinkedList.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * A fixed number of equally sized slots that a SmallBufferAllocator hands
+ * out before it falls back to the heap. Bit i of mFree is set while slot i
+ * is unused.
+ */
+struct SmallBufferArena {
+    unsigned char* mBegin;
+    size_t mSlotSize;
+    size_t mSlotAlign;
+    uint32_t mSlots;
+    uint64_t mFree;
+};
+
+/**
+ * An allocator that serves single-object requests from the slots of a
+ * SmallBufferArena while there are free ones that fit, and from the heap
+ * otherwise. Two allocators are equal when they use the same arena.
+ *
+ * Copies of a container obtained through select_on_container_copy_construction
+ * get an allocator without an arena, so that a copy never depends on the
+ * storage of the container it was copied from.
+ */
+template <typename T> class SmallBufferAllocator {
+public:
+    using value_type = T;
+
+    /**
+     * Initializes an allocator that uses arena, or only the heap if arena is
+     * nullptr.
+     * This operation is a no-throw.
+     *
+     * @param arena arena to allocate from first
+     */
+    explicit SmallBufferAllocator(SmallBufferArena* arena) noexcept;
+
+    /**
+     * Initializes an allocator that uses the same arena as other.
+     * This operation is a no-throw.
+     *
+     * @param other allocator to rebind
+     */
+    template <typename U> SmallBufferAllocator(const SmallBufferAllocator<U>& other) noexcept;
+
+    /**
+     * Returns storage for n objects of type T: a free arena slot if n is 1
+     * and one fits, heap memory otherwise.
+     * This operation provides strong exception safety.
+     *
+     * @param n number of objects
+     * @return pointer to the storage
+     */
+    T* allocate(size_t n);
+
+    /**
+     * Returns storage obtained from allocate(n) to the arena or the heap.
+     * This operation is a no-throw.
+     *
+     * @param p pointer to the storage
+     * @param n number of objects
+     */
+    void deallocate(T* p, size_t n) noexcept;
+
+    /**
+     * Returns an allocator without an arena (see the class description).
+     * This operation is a no-throw.
+     *
+     * @return heap-only allocator
+     */
+    SmallBufferAllocator<T> select_on_container_copy_construction() const noexcept;
+
+    template <typename U> bool operator==(const SmallBufferAllocator<U>& rhs) const noexcept;
+    template <typename U> bool operator!=(const SmallBufferAllocator<U>& rhs) const noexcept;
+
+private:
+    template <typename U> friend class SmallBufferAllocator;
+
+    SmallBufferArena* mArena;
+};
+
+/**
+ * The inline node storage of a SmallLinkedList: room for K + 1 nodes (the
+ * dummy node and K elements) and the arena describing it. It is a base
+ * class of SmallLinkedList so that it is constructed before, and destroyed
+ * after, the LinkedList that allocates from it.
+ */
+template <typename T, uint32_t K> class SmallLinkedListStorage {
+protected:
+    static_assert(K < 63, "the arena tracks at most 63 slots");
+
+    SmallLinkedListStorage() noexcept;
+    SmallLinkedListStorage(const SmallLinkedListStorage<T, K>&) = delete;
+    SmallLinkedListStorage<T, K>& operator=(const SmallLinkedListStorage<T, K>&) = delete;
+
+    alignas(LinkedListNode<T>) unsigned char mSlots[(K + 1) * sizeof(LinkedListNode<T>)];
+    SmallBufferArena mArena;
+};
+
+/**
+ * A LinkedList that keeps its dummy node and its first K nodes inside the
+ * object and only allocates heap nodes beyond that. A list that never holds
+ * more than K elements at a time never touches the heap.
+ *
+ * SmallLinkedList is a LinkedList with a SmallBufferAllocator that uses the
+ * object's own slots, so it has the same interface, iterators and exception
+ * guarantees. Nodes of removed elements return to the inline slots, which
+ * are handed out again before the heap is used. Gaps are filled with
+ * ordinary nodes (see LinkedList); the temporary lists LinkedList builds for
+ * that and for copy assignment draw on the same slots while they exist.
+ *
+ * Because the nodes may live inside the object, they must never be handed
+ * to another list. Moves, copies and swaps therefore copy the elements
+ * instead of exchanging nodes, and the LinkedList base is private, so its
+ * node-exchanging move operations, swap() and splice() cannot be reached;
+ * the rest of its interface is re-exported unchanged. Elements are moved
+ * within one list with rotate(), moveToFront() and moveToBack().
+ */
+template <typename T, uint32_t K = 8>
+class SmallLinkedList : private SmallLinkedListStorage<T, K>,
+                        private LinkedList<T, SmallBufferAllocator<T>> {
+    using Base = LinkedList<T, SmallBufferAllocator<T>>;
+
+public:
+    using typename Base::allocator_type;
+    using typename Base::const_iterator;
+    using typename Base::iterator;
+    using typename Base::value_type;
+
+    using Base::add;
+    using Base::apply;
+    using Base::begin;
+    using Base::clear;
+    using Base::dropIndex;
+    using Base::end;
+    using Base::erase;
+    using Base::find;
+    using Base::findIf;
+    using Base::get;
+    using Base::getAllocator;
+    using Base::indexMemory;
+    using Base::isEmpty;
+    using Base::moveToBack;
+    using Base::moveToFront;
+    using Base::remove;
+    using Base::rotate;
+    using Base::set;
+    using Base::setIndexed;
+    using Base::setReclaimer;
+    using Base::setRecorder;
+    using Base::size;
+
+    /**
+     * Initializes an empty SmallLinkedList. The dummy node is placed in the
+     * inline storage.
+     * This operation provides strong exception safety.
+     */
+    SmallLinkedList();
+
+    /**
+     * Initializes the SmallLinkedList to be a copy of src, in its own inline
+     * storage.
+     * This operation provides strong exception safety.
+     *
+     * @param src SmallLinkedList to copy
+     */
+    SmallLinkedList(const SmallLinkedList<T, K>& src);
+
+    /**
+     * Initializes the SmallLinkedList to be a copy of src, in its own inline
+     * storage. The nodes of src cannot be taken over, so the elements are
+     * copied and src is left unchanged.
+     * This operation provides strong exception safety.
+     *
+     * @param src SmallLinkedList to copy
+     */
+    SmallLinkedList(SmallLinkedList<T, K>&& src);
+
+    /**
+     * Makes this object a copy of rhs. Note that calling this method on
+     * yourself (l = l;) is equivalent to a no-op.
+     * This operation provides strong exception safety.
+     *
+     * @param rhs SmallLinkedList to copy
+     * @return *this, used for chaining.
+     */
+    SmallLinkedList<T, K>& operator=(const SmallLinkedList<T, K>& rhs);
+
+    /**
+     * Makes this object a copy of rhs, which is left unchanged (see the move
+     * constructor).
+     * This operation provides strong exception safety.
+     *
+     * @param rhs SmallLinkedList to copy
+     * @return *this, used for chaining.
+     */
+    SmallLinkedList<T, K>& operator=(SmallLinkedList<T, K>&& rhs);
+
+    /**
+     * Exchanges the contents of this SmallLinkedList and other by copying
+     * the elements, in time proportional to their sizes.
+     * This operation provides basic exception safety.
+     *
+     * @param other the SmallLinkedList to swap with
+     */
+    void swap(SmallLinkedList<T, K>& other);
+
+    /**
+     * Returns true if rhs holds equal elements in the same order.
+     * This operation provides strong exception safety.
+     *
+     * @param rhs SmallLinkedList to compare with
+     * @return bool True when equal
+     */
+    bool operator==(const SmallLinkedList<T, K>& rhs) const;
+
+    /**
+     * Returns the negation of operator==.
+     * This operation provides strong exception safety.
+     *
+     * @param rhs SmallLinkedList to compare with
+     * @return bool True when not equal
+     */
+    bool operator!=(const SmallLinkedList<T, K>& rhs) const;
+
+    /**
+     * Returns the number of elements that fit in the inline storage, K.
+     * This operation is a no-throw.
+     *
+     * @return inline capacity
+     */
+    static constexpr uint32_t inlineCapacity() noexcept;
+};
+
+#include "../src/SmallLinkedList.cpp"
+
+#endif // SMALL_LINKED_LIST_H
@@ -0,0 +1,309 @@
+// SpillingLinkedList.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef SPILLING_LINKED_LIST_H
+#define SPILLING_LINKED_LIST_H
+
+#include "LinkedList.h"
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+
+/**
+ * I/O counters of a SpillingLinkedList. An access is a get(), set() or an
+ * iterator entering a segment; it hits when the segment is resident.
+ */
+struct SpillStats {
+    uint64_t mHits;
+    uint64_t mMisses;
+    uint64_t mSegmentsRead;
+    uint64_t mSegmentsWritten;
+    uint64_t mBytesRead;
+    uint64_t mBytesWritten;
+};
+
+/**
+ * A list that keeps at most a given number of bytes of nodes in memory and
+ * spills the rest to an unnamed temporary file, for batch jobs that build
+ * lists larger than the memory they are given.
+ *
+ * The elements are grouped in segments of segmentSize consecutive elements.
+ * A resident segment is a LinkedList<T>. When a segment must be loaded and
+ * the budget is used up, the least recently used full segment is evicted:
+ * if it changed since it was last read, its items are written to its slot in
+ * the file (segment i at byte i * segmentSize * sizeof(T)), then its nodes
+ * are freed. The last segment is never evicted while it is still filling up.
+ * Spilled segments are read back on the next get(), set() or iteration that
+ * reaches them. A miss on the segment right after the previously accessed
+ * one is taken to be part of a sequential scan and also reads up to
+ * readahead following spilled segments, with a single read.
+ *
+ * Items are written as their object representation, so T must be trivially
+ * copyable. The budget counts nodes (segmentSize + 1 of them per resident
+ * segment, the dummy included) and must hold at least two segments.
+ *
+ * Elements can only be appended; the list has no insertion or removal in
+ * the middle. Since any access may page segments in and out, references and
+ * iterators are invalidated by every access other than advancing that same
+ * iterator, and even get() is not const. If the spill file cannot be created,
+ * read or written, an std::system_error is thrown and the list is left
+ * unchanged.
+ */
+template <typename T> class SpillingLinkedList {
+public:
+    static_assert(std::is_trivially_copyable_v<T>, "spilled items are written as raw bytes");
+
+    class const_iterator;
+    using value_type = T;
+
+    /**
+     * Initializes an empty SpillingLinkedList that keeps at most
+     * memoryBudget bytes of nodes in memory. If the budget does not hold
+     * two segments, an std::invalid_argument exception is thrown with the
+     * budget as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param memoryBudget bytes of nodes that may be resident
+     * @param segmentSize number of elements per segment
+     */
+    explicit SpillingLinkedList(size_t memoryBudget, uint32_t segmentSize = 256);
+
+    SpillingLinkedList(const SpillingLinkedList<T>&) = delete;
+    SpillingLinkedList<T>& operator=(const SpillingLinkedList<T>&) = delete;
+
+    /**
+     * Destructor. Frees the nodes and closes (and so deletes) the spill file.
+     * This operation is a no-throw.
+     */
+    ~SpillingLinkedList() noexcept;
+
+    /**
+     * Adds value to the end of this SpillingLinkedList. Starting a new
+     * segment may evict another one first.
+     * This operation provides strong exception safety.
+     *
+     * @param value value to append
+     */
+    void add(const T& value);
+
+    /**
+     * Empties this SpillingLinkedList. The spill file keeps its size but its
+     * contents are no longer used. The counters are not reset.
+     * This operation is a no-throw.
+     */
+    void clear() noexcept;
+
+    /**
+     * Returns a constant reference to the element stored at the provided
+     * index, paging its segment in if necessary. The reference is valid
+     * until the next access. If index is out of bounds, an std::out_of_range
+     * exception is thrown with the index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the element to return
+     * @return constant reference to the element at the index
+     */
+    const T& get(uint32_t index);
+
+    /**
+     * Sets the element at the specified index to the provided value, paging
+     * its segment in if necessary. If index is out of bounds, an
+     * std::out_of_range exception is thrown with the index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the object to set
+     * @param value the new value
+     */
+    void set(uint32_t index, const T& value);
+
+    /**
+     * Returns an iterator to the beginning, paging the first segment in.
+     * This operation provides strong exception safety.
+     *
+     * @return const_iterator
+     */
+    const_iterator begin();
+
+    /**
+     * Returns an iterator to the end.
+     * This operation is a no-throw.
+     *
+     * @return const_iterator
+     */
+    const_iterator end() noexcept;
+
+    /**
+     * Sets how many spilled segments a sequential miss reads ahead.
+     * This operation is a no-throw.
+     *
+     * @param segments number of segments to read ahead (0 to disable)
+     */
+    void setReadahead(uint32_t segments) noexcept;
+
+    /**
+     * Returns the I/O counters.
+     * This operation is a no-throw.
+     *
+     * @return counters since construction
+     */
+    SpillStats stats() const noexcept;
+
+    /**
+     * Returns the number of bytes of nodes currently in memory, at most the
+     * budget.
+     * This operation is a no-throw.
+     *
+     * @return resident bytes
+     */
+    size_t residentBytes() const noexcept;
+
+    /**
+     * Returns true if this SpillingLinkedList is empty and false otherwise.
+     * This operation is a no-throw.
+     *
+     * @return bool True when empty
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * Return the size of this SpillingLinkedList.
+     * This operation is a no-throw.
+     *
+     * @return
+     */
+    uint32_t size() const noexcept;
+
+    /**
+     * Forward iterator that pages segments in as it reaches them, as a
+     * sequential scan (see the class description).
+     */
+    class const_iterator {
+    public:
+        friend class SpillingLinkedList<T>;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = int32_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        bool operator==(const const_iterator& rhs) const noexcept;
+        bool operator!=(const const_iterator& rhs) const noexcept;
+        const T& operator*() const noexcept;
+        const T* operator->() const noexcept;
+        const_iterator& operator++();
+        const const_iterator operator++(int);
+
+    private:
+        SpillingLinkedList<T>* mList;
+        uint32_t mIndex;
+        std::optional<LinkedListConstIterator<T>> mCurrent;
+        const_iterator(SpillingLinkedList<T>* list, uint32_t index);
+
+        /**
+         * Pages in the segment starting at element index and positions
+         * mCurrent on that element. mIndex is left to the caller.
+         */
+        void enterSegment(uint32_t index);
+    };
+
+private:
+    /**
+     * A run of consecutive elements. Its nodes are empty while it is spilled.
+     */
+    struct Segment {
+        LinkedList<T> mNodes;
+        uint32_t mCount;
+        bool mResident;
+        bool mDirty;
+        uint64_t mLastUse;
+    };
+
+    /**
+     * Given an index, this method throws an std::out_of_range with the index as
+     * its message if index is out of bounds or is a no-op otherwise.
+     * This operation provides strong exception safety.
+     *
+     * @param index index to check
+     */
+    void rangeCheck(uint32_t index) const;
+
+    /**
+     * Makes segment resident, reading ahead if the access is sequential,
+     * counts the access and returns the segment.
+     * This operation provides strong exception safety.
+     *
+     * @param segment position of the segment
+     * @param sequential whether the access belongs to a sequential scan
+     * @return the resident segment
+     */
+    Segment& acquire(uint32_t segment, bool sequential);
+
+    /**
+     * Evicts least recently used segments until count more fit in the
+     * budget, or no more segment can be evicted. Returns how many fit.
+     * This operation provides strong exception safety.
+     *
+     * @param count number of segments about to be loaded
+     * @return number of segments that fit (at most count)
+     */
+    uint32_t makeRoom(uint32_t count);
+
+    /**
+     * Writes segment to the spill file if it is dirty and frees its nodes.
+     * This operation provides strong exception safety.
+     *
+     * @param segment position of a resident, full segment
+     */
+    void evict(uint32_t segment);
+
+    /**
+     * Reads count consecutive spilled segments starting at first with one
+     * read and makes them resident.
+     * This operation provides strong exception safety.
+     *
+     * @param first position of the first segment
+     * @param count number of segments
+     */
+    void load(uint32_t first, uint32_t count);
+
+    /**
+     * Transfers bytes between the spill file at offset and buffer, throwing
+     * std::system_error on failure.
+     *
+     * @param buffer memory to read into or write from
+     * @param bytes number of bytes
+     * @param offset position in the file
+     * @param write true to write, false to read
+     */
+    void transfer(void* buffer, size_t bytes, uint64_t offset, bool write);
+
+    std::deque<Segment> mSegments;
+    FILE* mFile;
+    uint32_t mSegmentSize;
+    uint32_t mMaxResident;
+    uint32_t mResident;
+    uint32_t mReadahead;
+    uint32_t mSize;
+
+    /**
+     * Position of the most recently accessed segment, or UINT32_MAX.
+     */
+    uint32_t mLastAccess;
+
+    /**
+     * Access counter whose value stamps Segment::mLastUse.
+     */
+    uint64_t mClock;
+
+    SpillStats mStats;
+};
+
+#include "../src/SpillingLinkedList.cpp"
+
+#endif // SPILLING_LINKED_LIST_H
@@ -0,0 +1,361 @@
+// SplitLinkedList.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef SPLIT_LINKED_LIST_H
+#define SPLIT_LINKED_LIST_H
+
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+template <typename T> class SplitLinkedListIterator;
+template <typename T> class SplitLinkedListConstIterator;
+
+/**
+ * A circular doubly-linked list with the same interface and exception
+ * guarantees as LinkedList, but with a hot/cold split storage layout.
+ *
+ * LinkedList keeps the links of a node next to its item, so every step of a
+ * traversal pulls (part of) the item into the cache even when the traversal
+ * only needs to reach a position. SplitLinkedList instead stores the links of
+ * all elements in one dense array of 8-byte entries (eight to a cache line)
+ * and keeps the items in a separate, stable-address slot array. Index seeks
+ * and structural operations touch only the link array; an item is only read
+ * when it is actually accessed.
+ *
+ * Elements are identified by slot numbers. Slot 0 is the dummy element that
+ * closes the circle (it has no item), exactly like LinkedList's dummy node.
+ * Slots of removed elements are recycled through a free list threaded through
+ * the link array, so the arrays only ever grow to the peak size of the list.
+ *
+ * As with LinkedList, modifying the list while iterating over it invalidates
+ * all current iterators. Gaps filled by add(index, value) are materialized
+ * eagerly.
+ */
+template <typename T> class SplitLinkedList {
+public:
+    // typedefs for interoperability/compatibility with STL containers
+    using value_type = T;
+    using iterator = SplitLinkedListIterator<T>;
+    using const_iterator = SplitLinkedListConstIterator<T>;
+
+    /**
+     * Initializes an empty SplitLinkedList.
+     * This operation provides strong exception safety.
+     */
+    SplitLinkedList();
+
+    /**
+     * Initializes the SplitLinkedList to be a copy of src.
+     * This operation provides strong exception safety.
+     *
+     * @param src SplitLinkedList to copy
+     */
+    SplitLinkedList(const SplitLinkedList<T>& src);
+
+    /**
+     * Makes this object a copy of rhs. Note that calling this method on
+     * yourself (l = l;) is equivalent to a no-op.
+     * This operation provides strong exception safety.
+     *
+     * @param rhs SplitLinkedList to copy
+     * @return *this, used for chaining.
+     */
+    SplitLinkedList<T>& operator=(const SplitLinkedList<T>& rhs);
+
+    /**
+     * Destructor. Releases all resources held by this SplitLinkedList.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     */
+    ~SplitLinkedList() noexcept;
+
+    /**
+     * Adds value to the end of this SplitLinkedList in amortized constant
+     * time.
+     * This operation provides strong exception safety.
+     *
+     * @param value value to append to this SplitLinkedList
+     */
+    void add(const T& value);
+
+    /**
+     * Inserts value at the specified index. All elements at or to the right of
+     * index are shifted down by one spot. If this SplitLinkedList needs to be
+     * enlarged (index is out of range) default values are used to fill the
+     * gaps.
+     * This operation provides strong exception safety.
+     *
+     * @param index index at which to insert value
+     * @param value the element to insert
+     */
+    void add(uint32_t index, const T& value);
+
+    /**
+     * Empties this SplitLinkedList returning it to the same state as the
+     * default constructor.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     */
+    void clear() noexcept;
+
+    /**
+     * Returns a constant reference to the element stored at the provided index.
+     * If index is out of bounds, an std::out_of_range exception is thrown with
+     * the index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the element to return
+     * @return constant reference to the element at the index.
+     */
+    const T& get(uint32_t index) const;
+
+    /**
+     * Returns a reference to the element stored at the provided index. If index
+     * is out of bounds, an std::out_of_range exception is thrown with the index
+     * as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the element to return
+     * @return reference to the element at the index.
+     */
+    T& get(uint32_t index);
+
+    /**
+     * Returns true if and only if this SplitLinkedList is logically equivalent
+     * to rhs, i.e. the size and contents are equal.
+     * This operation provides strong exception safety.
+     *
+     * @param rhs the SplitLinkedList being compared to
+     * @return true iff logically equivalent
+     */
+    bool operator==(const SplitLinkedList<T>& rhs) const;
+
+    /**
+     * Returns false if this SplitLinkedList is equal to rhs and true otherwise.
+     * This operation provides strong exception safety.
+     *
+     * @param rhs the SplitLinkedList being compared to
+     * @return true iff not logically equivalent
+     */
+    bool operator!=(const SplitLinkedList<T>& rhs) const;
+
+    /**
+     * Returns a constant iterator to the beginning.
+     * This operation is a no-throw.
+     *
+     * @return const_iterator
+     */
+    const_iterator begin() const noexcept;
+
+    /**
+     * Returns an iterator to the beginning.
+     * This operation is a no-throw.
+     *
+     * @return iterator
+     */
+    iterator begin() noexcept;
+
+    /**
+     * Returns a constant iterator to the end.
+     * This operation is a no-throw.
+     *
+     * @return const_iterator
+     */
+    const_iterator end() const noexcept;
+
+    /**
+     * Returns an iterator to the end.
+     * This operation is a no-throw.
+     *
+     * @return iterator
+     */
+    iterator end() noexcept;
+
+    /**
+     * Returns true if this SplitLinkedList is empty and false otherwise.
+     * This operation is a no-throw.
+     *
+     * @return bool True when empty
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * Removes the element at the specified index. If index is out of bounds
+     * an std::out_of_range exception is thrown with index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the object to remove.
+     */
+    void remove(uint32_t index);
+
+    /**
+     * Sets the element at the specified index to the provided value. If index
+     * is out of bounds, an std::out_of_range exception is thrown with the index
+     * as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the object to set
+     * @param value the new value
+     */
+    void set(uint32_t index, const T& value);
+
+    /**
+     * Return the size of this SplitLinkedList.
+     * This operation is a no-throw.
+     *
+     * @return
+     */
+    uint32_t size() const noexcept;
+
+private:
+    friend class SplitLinkedListIterator<T>;
+    friend class SplitLinkedListConstIterator<T>;
+
+    /**
+     * The hot part of an element: the slots of its neighbors.
+     */
+    struct Link {
+        uint32_t mPrev;
+        uint32_t mNext;
+    };
+
+    /**
+     * Given an index, this method throws an std::out_of_range with the index as
+     * its message if index is out of bounds or is a no-op otherwise.
+     * This operation provides strong exception safety.
+     *
+     * @param index index to check
+     */
+    void rangeCheck(uint32_t index) const;
+
+    /**
+     * Returns the slot of the element at index, or of the dummy if index is
+     * size(), walking the link array only.
+     * This operation is a no-throw.
+     *
+     * @param index index of the element
+     * @return slot of the element
+     */
+    uint32_t seek(uint32_t index) const noexcept;
+
+    /**
+     * Stores value in an unused slot and links it right before slot next.
+     * This operation provides strong exception safety.
+     *
+     * @param next slot of the element that will follow the new one
+     * @param value value to store
+     */
+    void insertBefore(uint32_t next, const T& value);
+
+    /**
+     * Unlinks the element in slot, destroys its item and puts the slot on the
+     * free list.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     *
+     * @param slot slot of the element to release
+     */
+    void release(uint32_t slot) noexcept;
+
+    /**
+     * Establishes the proper linkage between the provided slots.
+     * This operation is a no-throw.
+     */
+    void link(uint32_t first, uint32_t second) noexcept;
+
+    /**
+     * Swaps the contents of this SplitLinkedList with that of other in
+     * constant time.
+     * This operation is a no-throw.
+     *
+     * @param other the SplitLinkedList to swap with
+     */
+    void swap(SplitLinkedList<T>& other) noexcept;
+
+    /**
+     * The logical size of the list. This does not include the dummy slot
+     */
+    uint32_t mSize;
+
+    /**
+     * Head of the free slot list (threaded through Link::mNext), 0 if empty.
+     */
+    uint32_t mFree;
+
+    /**
+     * Links of every slot; mLinks[0] belongs to the dummy.
+     */
+    std::vector<Link> mLinks;
+
+    /**
+     * Items of every slot; empty for the dummy and for free slots. A deque
+     * never relocates its elements when it grows.
+     */
+    std::deque<std::optional<T>> mItems;
+};
+
+/**
+ * Iterators for SplitLinkedList. They mirror LinkedListIterator and
+ * LinkedListConstIterator, but designate an element by its slot.
+ */
+template <typename T> class SplitLinkedListIterator {
+public:
+    friend class SplitLinkedList<T>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = int32_t;
+    using pointer = T*;
+    using reference = T&;
+
+    SplitLinkedListIterator() = delete;
+
+    bool operator==(const SplitLinkedListIterator<T>& rhs) const noexcept;
+    bool operator!=(const SplitLinkedListIterator<T>& rhs) const noexcept;
+    value_type& operator*() const;
+    value_type* operator->() const;
+    SplitLinkedListIterator<T>& operator++();
+    const SplitLinkedListIterator<T> operator++(int);
+    SplitLinkedListIterator<T>& operator--();
+    const SplitLinkedListIterator<T> operator--(int);
+
+private:
+    SplitLinkedList<T>* mList;
+    uint32_t mSlot;
+    SplitLinkedListIterator(SplitLinkedList<T>* list, uint32_t slot);
+};
+
+template <typename T> class SplitLinkedListConstIterator {
+public:
+    friend class SplitLinkedList<T>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = int32_t;
+    using pointer = T*;
+    using reference = T&;
+
+    SplitLinkedListConstIterator() = delete;
+
+    bool operator==(const SplitLinkedListConstIterator<T>& rhs) const noexcept;
+    bool operator!=(const SplitLinkedListConstIterator<T>& rhs) const noexcept;
+    const value_type& operator*() const;
+    const value_type* operator->() const;
+    SplitLinkedListConstIterator<T>& operator++();
+    const SplitLinkedListConstIterator<T> operator++(int);
+    SplitLinkedListConstIterator<T>& operator--();
+    const SplitLinkedListConstIterator<T> operator--(int);
+
+private:
+    const SplitLinkedList<T>* mList;
+    uint32_t mSlot;
+    SplitLinkedListConstIterator(const SplitLinkedList<T>* list, uint32_t slot);
+};
+
+#include "../src/SplitLinkedList.cpp"
+
+#endif // SPLIT_LINKED_LIST_H
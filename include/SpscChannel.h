@@ -0,0 +1,159 @@
+// SpscChannel.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef SPSC_CHANNEL_H
+#define SPSC_CHANNEL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * An unbounded first-in first-out channel between exactly one producer thread
+ * and exactly one consumer thread that never takes a lock.
+ *
+ * The channel is a singly-linked chain of nodes. The consumer owns the
+ * front of the chain: the node it consumed last acts as a dummy, and popping
+ * an element makes the next node the new dummy. The producer owns the back of
+ * the chain and publishes new nodes with a single release store. Nodes the
+ * consumer has moved past stay in the chain in front of the dummy and form
+ * the producer's free list, so once the channel has reached its working size
+ * no more memory is allocated or freed. The producer only reads the
+ * consumer's position when its cached copy of it says the free list is empty.
+ *
+ * pushBatch() links a whole batch of nodes privately and publishes it with one
+ * store, and popBatch() consumes up to a given number of elements and
+ * publishes its new position once, so both sides synchronize once per batch
+ * rather than once per element.
+ *
+ * The push methods may only be called by the producer thread, tryPop(),
+ * popBatch() and isEmpty() only by the consumer thread.
+ */
+template <typename T> class SpscChannel {
+public:
+    // typedefs for interoperability/compatibility with STL containers
+    using value_type = T;
+
+    /**
+     * Initializes an empty SpscChannel.
+     * This operation provides strong exception safety.
+     */
+    SpscChannel();
+
+    SpscChannel(const SpscChannel<T>&) = delete;
+    SpscChannel<T>& operator=(const SpscChannel<T>&) = delete;
+
+    /**
+     * Destructor. Destroys the elements that have not been consumed and
+     * releases every node. Neither thread may be using the channel.
+     * This operation is no-throw under the assumption that the parameterizing
+     * type's destructor is no-throw.
+     */
+    ~SpscChannel() noexcept;
+
+    /**
+     * Appends a copy of value. Producer only.
+     * This operation provides strong exception safety.
+     *
+     * @param value value to send
+     */
+    void push(const T& value);
+
+    /**
+     * Appends copies of the elements of [first, last) and makes them visible
+     * to the consumer at once. Producer only.
+     * This operation provides strong exception safety.
+     *
+     * @param first iterator to the first element to send
+     * @param last iterator past the last element to send
+     */
+    template <typename InputIterator> void pushBatch(InputIterator first, InputIterator last);
+
+    /**
+     * Moves the oldest element into value if there is one. Consumer only.
+     * This operation provides strong exception safety, provided T's move
+     * assignment does.
+     *
+     * @param value receives the element
+     * @return true iff an element was received
+     */
+    bool tryPop(T& value);
+
+    /**
+     * Moves up to max of the oldest elements to out, in order. Consumer only.
+     * If moving an element throws, the elements moved before it are consumed
+     * and the rest stay in the channel.
+     * This operation provides basic exception safety.
+     *
+     * @param out output iterator receiving the elements
+     * @param max maximum number of elements to receive
+     * @return number of elements received
+     */
+    template <typename OutputIterator> size_t popBatch(OutputIterator out, size_t max);
+
+    /**
+     * Returns true if the consumer has nothing to receive right now. Consumer
+     * only.
+     * This operation is a no-throw.
+     *
+     * @return bool True when empty
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * Returns the number of nodes the producer has allocated so far, which
+     * stops growing once drained nodes are being reused.
+     * This operation is a no-throw.
+     *
+     * @return number of allocated nodes
+     */
+    size_t nodeCount() const noexcept;
+
+private:
+    /**
+     * A node holds an element only between being pushed and being popped.
+     */
+    struct Node {
+        std::atomic<Node*> mNext;
+        alignas(T) unsigned char mStorage[sizeof(T)];
+
+        Node() noexcept;
+        T* item() noexcept;
+    };
+
+    /**
+     * Returns a node from the free list or a new one. The node's mNext is
+     * unspecified. Producer only.
+     * This operation provides strong exception safety.
+     */
+    Node* acquire();
+
+    /**
+     * Puts a node obtained from acquire() back at the front of the free
+     * list. Producer only.
+     * This operation is a no-throw.
+     */
+    void recycle(Node* node) noexcept;
+
+    /**
+     * Consumer side: the dummy node; its successor holds the oldest element.
+     * Kept on its own cache line.
+     */
+    alignas(64) std::atomic<Node*> mFront;
+
+    /**
+     * Producer side: the newest node, the oldest free node, and the
+     * producer's last reading of mFront (nodes before it are free).
+     */
+    alignas(64) Node* mBack;
+    Node* mFree;
+    Node* mFrontCopy;
+    size_t mNodeCount;
+};
+
+#include "../src/SpscChannel.cpp"
+
+#endif // SPSC_CHANNEL_H
@@ -0,0 +1,378 @@
+// StaticLinkedList.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef STATIC_LINKED_LIST_H
+#define STATIC_LINKED_LIST_H
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+
+template <typename T, uint32_t N> class StaticLinkedListIterator;
+template <typename T, uint32_t N> class StaticLinkedListConstIterator;
+
+/**
+ * A circular doubly-linked list of at most N elements that never touches the
+ * heap. It offers the interface of LinkedList, but all of its storage is
+ * inline: the links of the elements live in one array and their items in
+ * another, both sized for N elements when the list is created.
+ *
+ * Elements are identified by slot numbers. Slot 0 is the dummy element that
+ * closes the circle (it has no item), exactly like LinkedList's dummy node.
+ * Slots that were never used are handed out in order; slots of removed
+ * elements are recycled through a free list threaded through the link array.
+ * Adding to a full list throws std::length_error, without changing the list;
+ * capacity() and isFull() tell in advance.
+ *
+ * Every operation is constexpr, so for a literal T (e.g. an arithmetic type
+ * or an aggregate of them) a StaticLinkedList can be filled in a constexpr
+ * function and used as a compile-time constant, e.g. a lookup table with no
+ * startup cost.
+ *
+ * The items of removed elements are not destroyed; a slot's item is only
+ * overwritten when the slot is used again, and all of them are destroyed
+ * with the list. Gaps filled by add(index, value) are materialized eagerly.
+ * As with LinkedList, modifying the list while iterating over it invalidates
+ * all current iterators.
+ */
+template <typename T, uint32_t N> class StaticLinkedList {
+public:
+    // typedefs for interoperability/compatibility with STL containers
+    using value_type = T;
+    using iterator = StaticLinkedListIterator<T, N>;
+    using const_iterator = StaticLinkedListConstIterator<T, N>;
+
+    /**
+     * Initializes an empty StaticLinkedList. Every item slot is
+     * default-constructed.
+     * This operation provides strong exception safety.
+     */
+    constexpr StaticLinkedList();
+
+    /**
+     * Adds value to the end of this StaticLinkedList in constant time. If the
+     * list is full, an std::length_error exception is thrown.
+     * This operation provides strong exception safety.
+     *
+     * @param value value to append to this StaticLinkedList
+     */
+    constexpr void add(const T& value);
+
+    /**
+     * Inserts value at the specified index. All elements at or to the right of
+     * index are shifted down by one spot. If this StaticLinkedList needs to be
+     * enlarged (index is out of range) default values are used to fill the
+     * gap. If the elements do not fit, an std::length_error exception is
+     * thrown.
+     * This operation provides strong exception safety.
+     *
+     * @param index index at which to insert value
+     * @param value the element to insert
+     */
+    constexpr void add(uint32_t index, const T& value);
+
+    /**
+     * Empties this StaticLinkedList in constant time, returning it to the same
+     * state as the default constructor (except for the item values left in
+     * the slots).
+     * This operation is a no-throw.
+     */
+    constexpr void clear() noexcept;
+
+    /**
+     * Returns a constant reference to the element stored at the provided index.
+     * If index is out of bounds, an std::out_of_range exception is thrown with
+     * the index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the element to return
+     * @return constant reference to the element at the index.
+     */
+    constexpr const T& get(uint32_t index) const;
+
+    /**
+     * Returns a reference to the element stored at the provided index. If index
+     * is out of bounds, an std::out_of_range exception is thrown with the index
+     * as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the element to return
+     * @return reference to the element at the index.
+     */
+    constexpr T& get(uint32_t index);
+
+    /**
+     * Returns true if and only if this StaticLinkedList is logically
+     * equivalent to rhs, i.e. the size and contents are equal.
+     * This operation provides strong exception safety.
+     *
+     * @param rhs the StaticLinkedList being compared to
+     * @return true iff logically equivalent
+     */
+    constexpr bool operator==(const StaticLinkedList<T, N>& rhs) const;
+
+    /**
+     * Returns false if this StaticLinkedList is equal to rhs and true
+     * otherwise.
+     * This operation provides strong exception safety.
+     *
+     * @param rhs the StaticLinkedList being compared to
+     * @return true iff not logically equivalent
+     */
+    constexpr bool operator!=(const StaticLinkedList<T, N>& rhs) const;
+
+    /**
+     * Returns a constant iterator to the beginning.
+     * This operation is a no-throw.
+     *
+     * @return const_iterator
+     */
+    constexpr const_iterator begin() const noexcept;
+
+    /**
+     * Returns an iterator to the beginning.
+     * This operation is a no-throw.
+     *
+     * @return iterator
+     */
+    constexpr iterator begin() noexcept;
+
+    /**
+     * Returns a constant iterator to the end.
+     * This operation is a no-throw.
+     *
+     * @return const_iterator
+     */
+    constexpr const_iterator end() const noexcept;
+
+    /**
+     * Returns an iterator to the end.
+     * This operation is a no-throw.
+     *
+     * @return iterator
+     */
+    constexpr iterator end() noexcept;
+
+    /**
+     * Returns true if this StaticLinkedList is empty and false otherwise.
+     * This operation is a no-throw.
+     *
+     * @return bool True when empty
+     */
+    constexpr bool isEmpty() const noexcept;
+
+    /**
+     * Returns true if this StaticLinkedList holds capacity() elements, so that
+     * adding another one would throw.
+     * This operation is a no-throw.
+     *
+     * @return bool True when full
+     */
+    constexpr bool isFull() const noexcept;
+
+    /**
+     * Removes the element at the specified index. If index is out of bounds
+     * an std::out_of_range exception is thrown with index as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the object to remove.
+     */
+    constexpr void remove(uint32_t index);
+
+    /**
+     * Sets the element at the specified index to the provided value. If index
+     * is out of bounds, an std::out_of_range exception is thrown with the index
+     * as its message.
+     * This operation provides strong exception safety.
+     *
+     * @param index index of the object to set
+     * @param value the new value
+     */
+    constexpr void set(uint32_t index, const T& value);
+
+    /**
+     * Return the size of this StaticLinkedList.
+     * This operation is a no-throw.
+     *
+     * @return
+     */
+    constexpr uint32_t size() const noexcept;
+
+    /**
+     * Returns the maximum number of elements, N.
+     * This operation is a no-throw.
+     *
+     * @return capacity
+     */
+    static constexpr uint32_t capacity() noexcept;
+
+private:
+    friend class StaticLinkedListIterator<T, N>;
+    friend class StaticLinkedListConstIterator<T, N>;
+
+    /**
+     * The slots of an element's neighbors.
+     */
+    struct Link {
+        uint32_t mPrev;
+        uint32_t mNext;
+    };
+
+    /**
+     * Given an index, this method throws an std::out_of_range with the index as
+     * its message if index is out of bounds or is a no-op otherwise.
+     * This operation provides strong exception safety.
+     *
+     * @param index index to check
+     */
+    constexpr void rangeCheck(uint32_t index) const;
+
+    /**
+     * Throws an std::length_error with the capacity as its message unless
+     * count more elements fit.
+     * This operation provides strong exception safety.
+     *
+     * @param count number of elements about to be added
+     */
+    constexpr void capacityCheck(uint64_t count) const;
+
+    /**
+     * Returns the slot of the element at index, or of the dummy if index is
+     * size(), walking from whichever end of the list is closer.
+     * This operation is a no-throw.
+     *
+     * @param index index of the element
+     * @return slot of the element
+     */
+    constexpr uint32_t seek(uint32_t index) const noexcept;
+
+    /**
+     * Stores value in an unused slot and links it right before slot next. If
+     * the list is full, an std::length_error exception is thrown.
+     * This operation provides strong exception safety.
+     *
+     * @param next slot of the element that will follow the new one
+     * @param value value to store
+     */
+    constexpr void insertBefore(uint32_t next, const T& value);
+
+    /**
+     * Returns the slot the next call to acquire() will return, without
+     * taking it.
+     * This operation is a no-throw.
+     *
+     * @pre !isFull()
+     */
+    constexpr uint32_t peek() const noexcept;
+
+    /**
+     * Takes an unused slot, from the free list if possible.
+     * This operation is a no-throw.
+     *
+     * @pre !isFull()
+     */
+    constexpr uint32_t acquire() noexcept;
+
+    /**
+     * Establishes the proper linkage between the provided slots.
+     * This operation is a no-throw.
+     */
+    constexpr void link(uint32_t first, uint32_t second) noexcept;
+
+    /**
+     * Returns the item of slot (which must not be the dummy).
+     * This operation is a no-throw.
+     */
+    constexpr T& item(uint32_t slot) noexcept;
+    constexpr const T& item(uint32_t slot) const noexcept;
+
+    /**
+     * The logical size of the list. This does not include the dummy slot
+     */
+    uint32_t mSize;
+
+    /**
+     * Head of the free slot list (threaded through Link::mNext), 0 if empty.
+     */
+    uint32_t mFree;
+
+    /**
+     * Slots 1 to mUsed have been handed out at least once; the others have
+     * never been used and are not on the free list.
+     */
+    uint32_t mUsed;
+
+    /**
+     * Links of every slot; mLinks[0] belongs to the dummy.
+     */
+    std::array<Link, N + 1> mLinks;
+
+    /**
+     * Items of slots 1 to N (the dummy has none).
+     */
+    std::array<T, N> mItems;
+};
+
+/**
+ * Iterators for StaticLinkedList. They mirror LinkedListIterator and
+ * LinkedListConstIterator, but designate an element by its slot.
+ */
+template <typename T, uint32_t N> class StaticLinkedListIterator {
+public:
+    friend class StaticLinkedList<T, N>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = int32_t;
+    using pointer = T*;
+    using reference = T&;
+
+    StaticLinkedListIterator() = delete;
+
+    constexpr bool operator==(const StaticLinkedListIterator<T, N>& rhs) const noexcept;
+    constexpr bool operator!=(const StaticLinkedListIterator<T, N>& rhs) const noexcept;
+    constexpr value_type& operator*() const noexcept;
+    constexpr value_type* operator->() const noexcept;
+    constexpr StaticLinkedListIterator<T, N>& operator++() noexcept;
+    constexpr const StaticLinkedListIterator<T, N> operator++(int) noexcept;
+    constexpr StaticLinkedListIterator<T, N>& operator--() noexcept;
+    constexpr const StaticLinkedListIterator<T, N> operator--(int) noexcept;
+
+private:
+    StaticLinkedList<T, N>* mList;
+    uint32_t mSlot;
+    constexpr StaticLinkedListIterator(StaticLinkedList<T, N>* list, uint32_t slot) noexcept;
+};
+
+template <typename T, uint32_t N> class StaticLinkedListConstIterator {
+public:
+    friend class StaticLinkedList<T, N>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = int32_t;
+    using pointer = T*;
+    using reference = T&;
+
+    StaticLinkedListConstIterator() = delete;
+
+    constexpr bool operator==(const StaticLinkedListConstIterator<T, N>& rhs) const noexcept;
+    constexpr bool operator!=(const StaticLinkedListConstIterator<T, N>& rhs) const noexcept;
+    constexpr const value_type& operator*() const noexcept;
+    constexpr const value_type* operator->() const noexcept;
+    constexpr StaticLinkedListConstIterator<T, N>& operator++() noexcept;
+    constexpr const StaticLinkedListConstIterator<T, N> operator++(int) noexcept;
+    constexpr StaticLinkedListConstIterator<T, N>& operator--() noexcept;
+    constexpr const StaticLinkedListConstIterator<T, N> operator--(int) noexcept;
+
+private:
+    const StaticLinkedList<T, N>* mList;
+    uint32_t mSlot;
+    constexpr StaticLinkedListConstIterator(
+        const StaticLinkedList<T, N>* list, uint32_t slot) noexcept;
+};
+
+#include "../src/StaticLinkedList.cpp"
+
+#endif // STATIC_LINKED_LIST_H
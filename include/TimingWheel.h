@@ -0,0 +1,224 @@
+// TimingWheel.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+#include "LinkedList.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * A hierarchical hashed timing wheel: a set of pending timers, each an item
+ * of type T with an integral deadline in ticks, that expires them as the
+ * wheel's clock is advanced. Scheduling and cancelling a timer take constant
+ * time however many timers are pending, where a sorted list needs time
+ * proportional to their number.
+ *
+ * The wheel has kLevels levels of kSlots buckets. Level l resolves deadlines
+ * to kSlots^l ticks: a timer sits at the lowest level whose span covers the
+ * distance to its deadline, in the slot picked by the matching digit (base
+ * kSlots) of the deadline. Every bucket is a circular LinkedList, and moving
+ * a timer never copies it: when the clock reaches the start of a slot of a
+ * higher level, the timers of that slot are spliced one by one into the
+ * level below (cascading), and on every tick the level-0 bucket due is
+ * spliced as a whole onto the list of expired timers.
+ *
+ * A timer is identified by the Handle returned when it is scheduled, which
+ * stays valid until the timer expires or is cancelled; the node holding the
+ * timer is relinked between buckets rather than reallocated. Like LinkedList,
+ * a TimingWheel is not thread-safe, and T must have a default constructor
+ * (the dummy node of every bucket stores a default-constructed timer).
+ */
+template <typename T> class TimingWheel {
+private:
+    /**
+     * A pending timer.
+     */
+    struct Timer {
+        uint64_t mDeadline;
+        T mItem;
+    };
+
+public:
+    /**
+     * Identifies a scheduled timer for cancel().
+     */
+    class Handle {
+    private:
+        friend class TimingWheel<T>;
+
+        explicit Handle(LinkedListIterator<Timer> timer) noexcept;
+
+        LinkedListIterator<Timer> mTimer;
+    };
+
+    /**
+     * Number of bits of a deadline resolved by one level.
+     */
+    static constexpr unsigned kSlotBits = 6;
+
+    /**
+     * Number of buckets of a level.
+     */
+    static constexpr uint64_t kSlots = uint64_t(1) << kSlotBits;
+
+    /**
+     * Number of levels, enough for every uint64_t deadline.
+     */
+    static constexpr unsigned kLevels = (64 + kSlotBits - 1) / kSlotBits;
+
+    /**
+     * Initializes an empty TimingWheel whose clock reads now.
+     * This operation provides strong exception safety.
+     *
+     * @param now initial value of the clock, in ticks
+     */
+    explicit TimingWheel(uint64_t now = 0);
+
+    TimingWheel(const TimingWheel<T>&) = delete;
+    TimingWheel<T>& operator=(const TimingWheel<T>&) = delete;
+
+    /**
+     * Schedules item to expire once the clock reaches deadline and returns
+     * a handle to the timer. A deadline that has already passed expires on
+     * the next tick. This operation completes in constant time.
+     * This operation provides strong exception safety.
+     *
+     * @param deadline tick at which to expire the timer
+     * @param item item to hand to the expiry callback
+     * @return handle to the timer, for cancel()
+     */
+    Handle schedule(uint64_t deadline, const T& item);
+
+    /**
+     * Cancels the timer timer refers to in constant time, so that it never
+     * expires. timer must refer to a timer of this TimingWheel that has not
+     * expired nor been cancelled; a timer may however cancel itself, or any
+     * other timer, from its expiry callback.
+     * This operation is no-throw under the assumption that the
+     * parameterizing type's destructor is no-throw.
+     *
+     * @param timer handle returned by schedule()
+     */
+    void cancel(Handle timer) noexcept;
+
+    /**
+     * Moves the clock forward to now, one tick at a time, and calls expire
+     * with a reference to the item of every timer whose deadline is reached,
+     * in order of deadline (timers that share a deadline expire in an
+     * unspecified order). expire may schedule and cancel timers but must not
+     * advance this TimingWheel. Stretches of ticks in which no timer can
+     * expire are skipped. Nothing happens if now is not ahead of the clock.
+     * This operation provides basic exception safety: if expire throws, the
+     * timer it was called for is discarded, the clock stays at its deadline
+     * and the other timers due then expire on the next call.
+     *
+     * @param now new value of the clock, in ticks
+     * @param expire callable taking a T&
+     */
+    template <typename Expire> void advance(uint64_t now, Expire expire);
+
+    /**
+     * Returns the current value of the clock, in ticks.
+     * This operation is a no-throw.
+     *
+     * @return current tick
+     */
+    uint64_t now() const noexcept;
+
+    /**
+     * Returns the number of timers that have neither expired nor been
+     * cancelled.
+     * This operation is a no-throw.
+     *
+     * @return number of pending timers
+     */
+    size_t size() const noexcept;
+
+    /**
+     * Returns true if no timer is pending and false otherwise.
+     * This operation is a no-throw.
+     *
+     * @return bool True when empty
+     */
+    bool isEmpty() const noexcept;
+
+private:
+    /**
+     * Returns the level at which a timer with the given deadline, which
+     * must be ahead of the clock, belongs: the position of the highest
+     * digit in which the deadline and the clock differ.
+     * This operation is a no-throw.
+     *
+     * @param deadline deadline of the timer
+     * @return level of the timer
+     */
+    unsigned levelOf(uint64_t deadline) const noexcept;
+
+    /**
+     * Returns the bucket of level holding timers with the given deadline.
+     * This operation is a no-throw.
+     *
+     * @param level level of the bucket
+     * @param deadline deadline of the timers
+     * @return bucket
+     */
+    LinkedList<Timer>& bucket(unsigned level, uint64_t deadline) noexcept;
+
+    /**
+     * Moves the clock forward by one tick: cascades the buckets whose slot
+     * starts at the new tick, from the highest level down, and appends the
+     * level-0 bucket due to mExpired.
+     * This operation is a no-throw.
+     */
+    void tick() noexcept;
+
+    /**
+     * Redistributes the timers of the bucket of level whose slot starts at
+     * the current tick over the levels below it.
+     * This operation is a no-throw.
+     *
+     * @param level level to cascade (at least 1)
+     */
+    void cascade(unsigned level) noexcept;
+
+    /**
+     * Clock, in ticks.
+     */
+    uint64_t mNow;
+
+    /**
+     * Number of pending timers, including those in mExpired.
+     */
+    size_t mSize;
+
+    /**
+     * Number of timers in the buckets of each level.
+     */
+    size_t mPending[kLevels];
+
+    /**
+     * kLevels * kSlots buckets, level by level.
+     */
+    std::vector<LinkedList<Timer>> mBuckets;
+
+    /**
+     * Timers whose deadline has been reached and whose callback has not
+     * been called yet.
+     */
+    LinkedList<Timer> mExpired;
+
+    /**
+     * The timer whose callback is running, if any.
+     */
+    LinkedList<Timer> mFiring;
+};
+
+#include "../src/TimingWheel.cpp"
+
+#endif // TIMING_WHEEL_H
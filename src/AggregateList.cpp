@@ -0,0 +1,523 @@
+// AggregateList.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef AGGREGATE_LIST_CPP
+#define AGGREGATE_LIST_CPP
+#include <AggregateList.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+template <typename T, typename Monoid>
+AggregateList<T, Monoid>::Node::Node(const T& item, uint32_t priority)
+    : LinkedListNode<T>(item)
+    , mAgg()
+    , mLeft(nullptr)
+    , mRight(nullptr)
+    , mWeight(1)
+    , mPriority(priority)
+    , mStale(true)
+{
+}
+
+/**
+ * Initializes an empty AggregateList.
+ * This operation provides strong exception safety.
+ */
+template <typename T, typename Monoid>
+AggregateList<T, Monoid>::AggregateList()
+    : mTail(std::make_unique<LinkedListNode<T>>())
+    , mRoot(nullptr)
+    , mSeed(0x9E3779B9U)
+{
+}
+
+/**
+ * Initializes the AggregateList to be a copy of src.
+ * This operation provides strong exception safety.
+ *
+ * @param src AggregateList to copy
+ */
+template <typename T, typename Monoid>
+AggregateList<T, Monoid>::AggregateList(const AggregateList<T, Monoid>& src)
+    : AggregateList()
+{
+    // The delegating constructor has completed, so the destructor releases
+    // the partial copy if an add() throws.
+    for (const_iterator iter = src.begin(); iter != src.end(); ++iter) {
+        add(*iter);
+    }
+}
+
+/**
+ * Makes this object a copy of rhs. Note that calling this method on
+ * yourself (l = l;) is equivalent to a no-op.
+ * This operation provides strong exception safety.
+ *
+ * @param rhs AggregateList to copy
+ * @return *this, used for chaining.
+ */
+template <typename T, typename Monoid>
+AggregateList<T, Monoid>& AggregateList<T, Monoid>::operator=(const AggregateList<T, Monoid>& rhs)
+{
+    if (this != &rhs) {
+        AggregateList<T, Monoid> tmp(rhs);
+        swap(tmp);
+    }
+    return *this;
+}
+
+/**
+ * Destructor. Releases all resources held by this AggregateList.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ */
+template <typename T, typename Monoid> AggregateList<T, Monoid>::~AggregateList() noexcept
+{
+    clear();
+}
+
+/**
+ * Adds value to the end of this AggregateList in expected logarithmic
+ * time.
+ * This operation provides strong exception safety.
+ *
+ * @param value value to append to this AggregateList
+ */
+template <typename T, typename Monoid> void AggregateList<T, Monoid>::add(const T& value)
+{
+    insertNode(size(), makeNode(value).release());
+}
+
+/**
+ * Inserts value at the specified index. All elements at or to the right of
+ * index are shifted down by one spot. If this AggregateList needs to be
+ * enlarged (index is out of range) default values are used to fill the
+ * gaps, as in LinkedList.
+ * This operation provides strong exception safety.
+ *
+ * @param index index at which to insert value
+ * @param value the element to insert
+ */
+template <typename T, typename Monoid>
+void AggregateList<T, Monoid>::add(uint32_t index, const T& value)
+{
+    if (index <= size()) {
+        insertNode(index, makeNode(value).release());
+        return;
+    }
+    // Create every node before touching the list so that a failure leaves it
+    // unchanged; linking them in afterwards cannot throw.
+    std::vector<std::unique_ptr<Node>> nodes;
+    nodes.reserve(index - size() + 1);
+    while (nodes.size() < index - size()) {
+        nodes.push_back(makeNode(T()));
+    }
+    nodes.push_back(makeNode(value));
+    for (std::unique_ptr<Node>& node : nodes) {
+        insertNode(size(), node.release());
+    }
+}
+
+/**
+ * Empties this AggregateList returning it to the same state as the default
+ * constructor.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ */
+template <typename T, typename Monoid> void AggregateList<T, Monoid>::clear() noexcept
+{
+    while (mTail->mNext != mTail.get()) {
+        delete static_cast<Node*>(mTail->mNext);
+    }
+    mRoot = nullptr;
+}
+
+/**
+ * Returns a constant reference to the element stored at the provided index
+ * in expected logarithmic time. If index is out of bounds, an
+ * std::out_of_range exception is thrown with the index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the element to return
+ * @return constant reference to the element at the index.
+ */
+template <typename T, typename Monoid> const T& AggregateList<T, Monoid>::get(uint32_t index) const
+{
+    rangeCheck(index);
+    return nodeAt(index)->mItem;
+}
+
+/**
+ * Sets the element at the specified index to the provided value and
+ * updates the aggregates that cover it. If index is out of bounds, an
+ * std::out_of_range exception is thrown with the index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the object to set
+ * @param value the new value
+ */
+template <typename T, typename Monoid>
+void AggregateList<T, Monoid>::set(uint32_t index, const T& value)
+{
+    rangeCheck(index);
+    // The only step that can throw comes first
+    nodeAt(index)->mItem = value;
+    touch(mRoot, index);
+}
+
+/**
+ * Removes the element at the specified index. If index is out of bounds
+ * an std::out_of_range exception is thrown with index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the object to remove.
+ */
+template <typename T, typename Monoid> void AggregateList<T, Monoid>::remove(uint32_t index)
+{
+    rangeCheck(index);
+    Node* before = nullptr;
+    Node* rest = nullptr;
+    Node* removed = nullptr;
+    Node* after = nullptr;
+    split(mRoot, index, before, rest);
+    split(rest, 1, removed, after);
+    mRoot = merge(before, after);
+    // Deleting the node unlinks it from the list layer
+    delete removed;
+}
+
+/**
+ * Returns the aggregate of all elements in list order, or the identity of
+ * the monoid if this AggregateList is empty. Constant time, unless the
+ * list was modified since the last call, which first recomputes the
+ * stale aggregates (expected logarithmic time per modification).
+ * This operation provides strong exception safety.
+ *
+ * @return aggregate of the whole list
+ */
+template <typename T, typename Monoid> T AggregateList<T, Monoid>::aggregate() const
+{
+    if (mRoot == nullptr) {
+        return Monoid::identity();
+    }
+    refresh(mRoot);
+    return mRoot->mAgg;
+}
+
+/**
+ * Returns the aggregate of the elements with indices in [first, last) in
+ * expected logarithmic time. An empty range yields the identity. If
+ * first > last or last > size(), an std::out_of_range exception is thrown
+ * with the offending index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param first index of the first element of the range
+ * @param last index one past the last element of the range
+ * @return aggregate of the range
+ */
+template <typename T, typename Monoid>
+T AggregateList<T, Monoid>::aggregate(uint32_t first, uint32_t last) const
+{
+    if (last > size()) {
+        throw std::out_of_range(std::to_string(last));
+    }
+    if (first > last) {
+        throw std::out_of_range(std::to_string(first));
+    }
+    refresh(mRoot);
+    return query(mRoot, first, last);
+}
+
+/**
+ * Returns a constant iterator to the beginning.
+ * This operation is a no-throw.
+ *
+ * @return const_iterator
+ */
+template <typename T, typename Monoid>
+LinkedListConstIterator<T> AggregateList<T, Monoid>::begin() const noexcept
+{
+    return const_iterator(mTail->next());
+}
+
+/**
+ * Returns a constant iterator to the end.
+ * This operation is a no-throw.
+ *
+ * @return const_iterator
+ */
+template <typename T, typename Monoid>
+LinkedListConstIterator<T> AggregateList<T, Monoid>::end() const noexcept
+{
+    return const_iterator(mTail.get());
+}
+
+/**
+ * Returns true if this AggregateList is empty and false otherwise.
+ * This operation is a no-throw.
+ *
+ * @return bool True when empty
+ */
+template <typename T, typename Monoid> bool AggregateList<T, Monoid>::isEmpty() const noexcept
+{
+    return mRoot == nullptr;
+}
+
+/**
+ * Return the size of this AggregateList.
+ * This operation is a no-throw.
+ *
+ * @return
+ */
+template <typename T, typename Monoid> uint32_t AggregateList<T, Monoid>::size() const noexcept
+{
+    return weight(mRoot);
+}
+
+/**
+ * Given an index, this method throws an std::out_of_range with the index as
+ * its message if index is out of bounds or is a no-op otherwise.
+ * This operation provides strong exception safety.
+ *
+ * @param index index to check
+ */
+template <typename T, typename Monoid>
+void AggregateList<T, Monoid>::rangeCheck(uint32_t index) const
+{
+    if (index >= size()) {
+        throw std::out_of_range(std::to_string(index));
+    }
+}
+
+/**
+ * Returns the node at the given (valid) index.
+ * This operation is a no-throw.
+ *
+ * @param index index of the node
+ * @return node at index
+ */
+template <typename T, typename Monoid>
+typename AggregateList<T, Monoid>::Node* AggregateList<T, Monoid>::nodeAt(
+    uint32_t index) const noexcept
+{
+    Node* node = mRoot;
+    while (index != weight(node->mLeft)) {
+        if (index < weight(node->mLeft)) {
+            node = node->mLeft;
+        } else {
+            index -= weight(node->mLeft) + 1;
+            node = node->mRight;
+        }
+    }
+    return node;
+}
+
+/**
+ * Creates an unlinked node holding value with a fresh random priority.
+ * This operation provides strong exception safety.
+ *
+ * @param value value to store
+ * @return the new node
+ */
+template <typename T, typename Monoid>
+std::unique_ptr<typename AggregateList<T, Monoid>::Node> AggregateList<T, Monoid>::makeNode(
+    const T& value)
+{
+    return std::make_unique<Node>(value, nextPriority());
+}
+
+/**
+ * Links node into both layers so that it ends up at index.
+ * This operation is a no-throw.
+ *
+ * @param index index of the inserted node, at most size()
+ * @param node unlinked node to insert
+ */
+template <typename T, typename Monoid>
+void AggregateList<T, Monoid>::insertNode(uint32_t index, Node* node) noexcept
+{
+    LinkedListNode<T>* next = index == size() ? mTail.get() : nodeAt(index);
+    LinkedListNodeBase::insertBefore(node, next);
+    Node* before = nullptr;
+    Node* after = nullptr;
+    split(mRoot, index, before, after);
+    mRoot = merge(merge(before, node), after);
+}
+
+/**
+ * Returns the number of elements in the subtree rooted at node.
+ * This operation is a no-throw.
+ */
+template <typename T, typename Monoid>
+uint32_t AggregateList<T, Monoid>::weight(const Node* node) noexcept
+{
+    return node == nullptr ? 0 : node->mWeight;
+}
+
+/**
+ * Recomputes the cached weight of node from its children and marks its
+ * aggregate stale.
+ * This operation is a no-throw.
+ */
+template <typename T, typename Monoid> void AggregateList<T, Monoid>::pull(Node* node) noexcept
+{
+    node->mWeight = 1 + weight(node->mLeft) + weight(node->mRight);
+    node->mStale = true;
+}
+
+/**
+ * Recomputes the stale aggregates in the subtree rooted at node. A
+ * vertex is only unmarked once its aggregate has been stored, so an
+ * exception leaves the remaining ones marked.
+ * This operation provides strong exception safety.
+ */
+template <typename T, typename Monoid> void AggregateList<T, Monoid>::refresh(Node* node)
+{
+    // Every ancestor of a stale vertex is stale, so clean subtrees are skipped
+    if (node == nullptr || !node->mStale) {
+        return;
+    }
+    refresh(node->mLeft);
+    refresh(node->mRight);
+    T agg = node->mItem;
+    if (node->mLeft != nullptr) {
+        agg = Monoid::combine(node->mLeft->mAgg, agg);
+    }
+    if (node->mRight != nullptr) {
+        agg = Monoid::combine(agg, node->mRight->mAgg);
+    }
+    node->mAgg = agg;
+    node->mStale = false;
+}
+
+/**
+ * Splits the treap rooted at node into the first count elements (left)
+ * and the rest (right).
+ * This operation is a no-throw.
+ */
+template <typename T, typename Monoid>
+void AggregateList<T, Monoid>::split(Node* node, uint32_t count, Node*& left, Node*& right) noexcept
+{
+    if (node == nullptr) {
+        left = nullptr;
+        right = nullptr;
+    } else if (count <= weight(node->mLeft)) {
+        split(node->mLeft, count, left, node->mLeft);
+        pull(node);
+        right = node;
+    } else {
+        split(node->mRight, count - weight(node->mLeft) - 1, node->mRight, right);
+        pull(node);
+        left = node;
+    }
+}
+
+/**
+ * Concatenates the treaps rooted at left and right and returns the root.
+ * This operation is a no-throw.
+ */
+template <typename T, typename Monoid>
+typename AggregateList<T, Monoid>::Node* AggregateList<T, Monoid>::merge(
+    Node* left, Node* right) noexcept
+{
+    if (left == nullptr) {
+        return right;
+    }
+    if (right == nullptr) {
+        return left;
+    }
+    if (left->mPriority > right->mPriority) {
+        left->mRight = merge(left->mRight, right);
+        pull(left);
+        return left;
+    }
+    right->mLeft = merge(left, right->mLeft);
+    pull(right);
+    return right;
+}
+
+/**
+ * Marks the aggregates on the path from node down to the element at
+ * index stale.
+ * This operation is a no-throw.
+ */
+template <typename T, typename Monoid>
+void AggregateList<T, Monoid>::touch(Node* node, uint32_t index) noexcept
+{
+    while (true) {
+        node->mStale = true;
+        uint32_t leftWeight = weight(node->mLeft);
+        if (index == leftWeight) {
+            return;
+        }
+        if (index < leftWeight) {
+            node = node->mLeft;
+        } else {
+            index -= leftWeight + 1;
+            node = node->mRight;
+        }
+    }
+}
+
+/**
+ * Returns the aggregate of the elements with indices in [first, last) of
+ * the subtree rooted at node, whose aggregates must be up to date.
+ */
+template <typename T, typename Monoid>
+T AggregateList<T, Monoid>::query(const Node* node, uint32_t first, uint32_t last)
+{
+    if (node == nullptr || first >= last) {
+        return Monoid::identity();
+    }
+    if (first == 0 && last == node->mWeight) {
+        return node->mAgg;
+    }
+    // Only one of the two recursive calls can be partial on each side, which
+    // keeps the number of visited vertices proportional to the tree height.
+    uint32_t leftWeight = weight(node->mLeft);
+    T result = Monoid::identity();
+    if (first < leftWeight) {
+        result = query(node->mLeft, first, std::min(last, leftWeight));
+    }
+    if (first <= leftWeight && leftWeight < last) {
+        result = Monoid::combine(result, node->mItem);
+    }
+    if (last > leftWeight + 1) {
+        uint32_t offset = leftWeight + 1;
+        result = Monoid::combine(
+            result, query(node->mRight, std::max(first, offset) - offset, last - offset));
+    }
+    return result;
+}
+
+/**
+ * Returns the next pseudo-random treap priority.
+ * This operation is a no-throw.
+ */
+template <typename T, typename Monoid> uint32_t AggregateList<T, Monoid>::nextPriority() noexcept
+{
+    mSeed ^= mSeed << 13;
+    mSeed ^= mSeed >> 17;
+    mSeed ^= mSeed << 5;
+    return mSeed;
+}
+
+/**
+ * Swaps the contents of this AggregateList with that of other in constant
+ * time.
+ * This operation is a no-throw.
+ *
+ * @param other the AggregateList to swap with
+ */
+template <typename T, typename Monoid>
+void AggregateList<T, Monoid>::swap(AggregateList<T, Monoid>& other) noexcept
+{
+    mTail.swap(other.mTail);
+    std::swap(mRoot, other.mRoot);
+    std::swap(mSeed, other.mSeed);
+}
+#endif
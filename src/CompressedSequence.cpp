@@ -0,0 +1,435 @@
+// CompressedSequence.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef COMPRESSED_SEQUENCE_CPP
+#define COMPRESSED_SEQUENCE_CPP
+#include <CompressedSequence.h>
+#include <stdexcept>
+#include <string>
+
+/**
+ * Initializes an empty CompressedSequence.
+ * This operation is a no-throw.
+ */
+template <typename T, uint32_t B>
+CompressedSequence<T, B>::CompressedSequence() noexcept
+    : mBlocks()
+    , mSize(0)
+{
+}
+
+/**
+ * Adds value to the end of this CompressedSequence in constant time.
+ * This operation provides strong exception safety.
+ *
+ * @param value value to append
+ */
+template <typename T, uint32_t B> void CompressedSequence<T, B>::add(T value)
+{
+    uint8_t bytes[kMaxVarint];
+    if (mBlocks.empty() || mBlocks.back().mCount == B) {
+        if (!mBlocks.empty()) {
+            // A full block never grows again
+            mBlocks.back().mBytes.shrink_to_fit();
+        }
+        size_t length = encode(T(), value, bytes);
+        mBlocks.push_back(Block { std::vector<uint8_t>(bytes, bytes + length), value, 1 });
+    } else {
+        Block& block = mBlocks.back();
+        size_t length = encode(block.mLast, value, bytes);
+        // Inserting at the end of a vector either succeeds or has no effect
+        block.mBytes.insert(block.mBytes.end(), bytes, bytes + length);
+        block.mLast = value;
+        ++block.mCount;
+    }
+    ++mSize;
+}
+
+/**
+ * Inserts value at the specified index, shifting the elements at or to the
+ * right of index down by one spot. Only the block holding index is
+ * decoded and re-encoded. If index is greater than size(), an
+ * std::out_of_range exception is thrown with the index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index at which to insert value
+ * @param value the element to insert
+ */
+template <typename T, uint32_t B> void CompressedSequence<T, B>::add(uint32_t index, T value)
+{
+    if (index == mSize) {
+        add(value);
+        return;
+    }
+    rangeCheck(index);
+    uint32_t offset = index;
+    size_t position = seek(offset);
+    std::vector<T> values = unpack(mBlocks[position]);
+    values.insert(values.begin() + offset, value);
+    if (values.size() <= B) {
+        Block block = pack(values.data(), values.data() + values.size());
+        std::swap(mBlocks[position], block);
+    } else {
+        // Split the block in half; the second half is inserted first, since
+        // that is the step that may throw
+        size_t half = values.size() / 2;
+        Block first = pack(values.data(), values.data() + half);
+        Block second = pack(values.data() + half, values.data() + values.size());
+        mBlocks.insert(mBlocks.begin() + static_cast<std::ptrdiff_t>(position + 1),
+            std::move(second));
+        std::swap(mBlocks[position], first);
+    }
+    ++mSize;
+}
+
+/**
+ * Empties this CompressedSequence and frees its blocks.
+ * This operation is a no-throw.
+ */
+template <typename T, uint32_t B> void CompressedSequence<T, B>::clear() noexcept
+{
+    std::vector<Block>().swap(mBlocks);
+    mSize = 0;
+}
+
+/**
+ * Returns the element stored at the provided index. If index is out of
+ * bounds, an std::out_of_range exception is thrown with the index as its
+ * message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the element to return
+ * @return the element at the index
+ */
+template <typename T, uint32_t B> T CompressedSequence<T, B>::get(uint32_t index) const
+{
+    rangeCheck(index);
+    uint32_t offset = index;
+    const Block& block = mBlocks[seek(offset)];
+    if (offset == block.mCount - 1) {
+        return block.mLast;
+    }
+    const uint8_t* cursor = block.mBytes.data();
+    T value = decode(T(), cursor);
+    for (uint32_t i = 0; i < offset; ++i) {
+        value = decode(value, cursor);
+    }
+    return value;
+}
+
+/**
+ * Removes the element at the specified index. Only the block holding it
+ * is decoded and re-encoded. If index is out of bounds an
+ * std::out_of_range exception is thrown with index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the element to remove
+ */
+template <typename T, uint32_t B> void CompressedSequence<T, B>::remove(uint32_t index)
+{
+    rangeCheck(index);
+    uint32_t offset = index;
+    size_t position = seek(offset);
+    if (mBlocks[position].mCount == 1) {
+        mBlocks.erase(mBlocks.begin() + static_cast<std::ptrdiff_t>(position));
+    } else {
+        std::vector<T> values = unpack(mBlocks[position]);
+        values.erase(values.begin() + offset);
+        Block block = pack(values.data(), values.data() + values.size());
+        std::swap(mBlocks[position], block);
+    }
+    --mSize;
+}
+
+/**
+ * Returns true if and only if this CompressedSequence holds the same
+ * elements as rhs, in the same order.
+ * This operation is a no-throw.
+ *
+ * @param rhs the CompressedSequence being compared to
+ * @return true iff logically equivalent
+ */
+template <typename T, uint32_t B>
+bool CompressedSequence<T, B>::operator==(const CompressedSequence<T, B>& rhs) const noexcept
+{
+    if (mSize != rhs.mSize) {
+        return false;
+    }
+    for (const_iterator left = begin(), right = rhs.begin(); left != end(); ++left, ++right) {
+        if (*left != *right) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Returns false if this CompressedSequence is equal to rhs and true
+ * otherwise.
+ * This operation is a no-throw.
+ *
+ * @param rhs the CompressedSequence being compared to
+ * @return true iff not logically equivalent
+ */
+template <typename T, uint32_t B>
+bool CompressedSequence<T, B>::operator!=(const CompressedSequence<T, B>& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+/**
+ * Returns an iterator to the beginning.
+ * This operation is a no-throw.
+ *
+ * @return const_iterator
+ */
+template <typename T, uint32_t B>
+CompressedSequenceIterator<T, B> CompressedSequence<T, B>::begin() const noexcept
+{
+    return const_iterator(this, 0);
+}
+
+/**
+ * Returns an iterator to the end.
+ * This operation is a no-throw.
+ *
+ * @return const_iterator
+ */
+template <typename T, uint32_t B>
+CompressedSequenceIterator<T, B> CompressedSequence<T, B>::end() const noexcept
+{
+    return const_iterator(this, mBlocks.size());
+}
+
+/**
+ * Returns true if this CompressedSequence is empty and false otherwise.
+ * This operation is a no-throw.
+ *
+ * @return bool True when empty
+ */
+template <typename T, uint32_t B> bool CompressedSequence<T, B>::isEmpty() const noexcept
+{
+    return mSize == 0;
+}
+
+/**
+ * Return the size of this CompressedSequence.
+ * This operation is a no-throw.
+ *
+ * @return
+ */
+template <typename T, uint32_t B> uint32_t CompressedSequence<T, B>::size() const noexcept
+{
+    return mSize;
+}
+
+/**
+ * Returns the number of bytes this CompressedSequence occupies, itself
+ * and the capacity of everything it allocated included.
+ * This operation is a no-throw.
+ *
+ * @return bytes in use
+ */
+template <typename T, uint32_t B> size_t CompressedSequence<T, B>::memoryUsage() const noexcept
+{
+    size_t bytes = sizeof(*this) + mBlocks.capacity() * sizeof(Block);
+    for (const Block& block : mBlocks) {
+        bytes += block.mBytes.capacity();
+    }
+    return bytes;
+}
+
+/**
+ * Writes the varint of the zigzag-mapped difference value - prev to out
+ * and returns the number of bytes written.
+ * This operation is a no-throw.
+ *
+ * @param prev preceding element (0 for the first element of a block)
+ * @param value element to encode
+ * @param out buffer of at least kMaxVarint bytes
+ * @return bytes written
+ */
+template <typename T, uint32_t B>
+size_t CompressedSequence<T, B>::encode(T prev, T value, uint8_t* out) noexcept
+{
+    // The difference is taken modulo 2^64, so it is exact for every T
+    uint64_t delta = static_cast<uint64_t>(value) - static_cast<uint64_t>(prev);
+    uint64_t zigzag = (delta << 1) ^ (0 - (delta >> 63));
+    size_t length = 0;
+    while (zigzag >= 0x80) {
+        out[length++] = static_cast<uint8_t>(zigzag | 0x80);
+        zigzag >>= 7;
+    }
+    out[length++] = static_cast<uint8_t>(zigzag);
+    return length;
+}
+
+/**
+ * Reads the element following prev at cursor and advances cursor past it.
+ * This operation is a no-throw.
+ *
+ * @param prev preceding element (0 for the first element of a block)
+ * @param cursor position of the element's varint
+ * @return the element
+ */
+template <typename T, uint32_t B>
+T CompressedSequence<T, B>::decode(T prev, const uint8_t*& cursor) noexcept
+{
+    uint64_t zigzag = 0;
+    for (uint32_t shift = 0;; shift += 7) {
+        uint8_t byte = *cursor++;
+        zigzag |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            break;
+        }
+    }
+    uint64_t delta = (zigzag >> 1) ^ (0 - (zigzag & 1));
+    return static_cast<T>(static_cast<uint64_t>(prev) + delta);
+}
+
+/**
+ * Returns the elements of block.
+ * This operation provides strong exception safety.
+ *
+ * @param block block to decode
+ * @return its elements in order
+ */
+template <typename T, uint32_t B>
+std::vector<T> CompressedSequence<T, B>::unpack(const Block& block)
+{
+    std::vector<T> values;
+    values.reserve(block.mCount + 1);
+    const uint8_t* cursor = block.mBytes.data();
+    T value = T();
+    for (uint32_t i = 0; i < block.mCount; ++i) {
+        value = decode(value, cursor);
+        values.push_back(value);
+    }
+    return values;
+}
+
+/**
+ * Returns a block holding the elements [first, last).
+ * This operation provides strong exception safety.
+ *
+ * @param first first element
+ * @param last one past the last element
+ * @return the encoded block
+ */
+template <typename T, uint32_t B>
+typename CompressedSequence<T, B>::Block CompressedSequence<T, B>::pack(
+    const T* first, const T* last)
+{
+    Block block { std::vector<uint8_t>(), T(), 0 };
+    uint8_t bytes[kMaxVarint];
+    for (; first != last; ++first) {
+        size_t length = encode(block.mLast, *first, bytes);
+        block.mBytes.insert(block.mBytes.end(), bytes, bytes + length);
+        block.mLast = *first;
+        ++block.mCount;
+    }
+    block.mBytes.shrink_to_fit();
+    return block;
+}
+
+/**
+ * Returns the position of the block holding the element at index and
+ * reduces index to the element's offset within that block.
+ * This operation is a no-throw.
+ *
+ * @pre index < size()
+ * @param index index of the element; receives its offset in the block
+ * @return position of the block in mBlocks
+ */
+template <typename T, uint32_t B>
+size_t CompressedSequence<T, B>::seek(uint32_t& index) const noexcept
+{
+    size_t position = 0;
+    while (index >= mBlocks[position].mCount) {
+        index -= mBlocks[position].mCount;
+        ++position;
+    }
+    return position;
+}
+
+/**
+ * Given an index, this method throws an std::out_of_range with the index as
+ * its message if index is out of bounds or is a no-op otherwise.
+ * This operation provides strong exception safety.
+ *
+ * @param index index to check
+ */
+template <typename T, uint32_t B>
+void CompressedSequence<T, B>::rangeCheck(uint32_t index) const
+{
+    if (index >= mSize) {
+        throw std::out_of_range(std::to_string(index));
+    }
+}
+
+template <typename T, uint32_t B>
+bool CompressedSequenceIterator<T, B>::operator==(
+    const CompressedSequenceIterator<T, B>& rhs) const noexcept
+{
+    return mBlock == rhs.mBlock && mOffset == rhs.mOffset;
+}
+
+template <typename T, uint32_t B>
+bool CompressedSequenceIterator<T, B>::operator!=(
+    const CompressedSequenceIterator<T, B>& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+template <typename T, uint32_t B> T CompressedSequenceIterator<T, B>::operator*() const noexcept
+{
+    return mValue;
+}
+
+template <typename T, uint32_t B>
+CompressedSequenceIterator<T, B>& CompressedSequenceIterator<T, B>::operator++() noexcept
+{
+    if (++mOffset < mSequence->mBlocks[mBlock].mCount) {
+        mValue = CompressedSequence<T, B>::decode(mValue, mCursor);
+    } else {
+        ++mBlock;
+        mOffset = 0;
+        enterBlock();
+    }
+    return *this;
+}
+
+template <typename T, uint32_t B>
+const CompressedSequenceIterator<T, B> CompressedSequenceIterator<T, B>::operator++(int) noexcept
+{
+    CompressedSequenceIterator<T, B> previous(*this);
+    ++*this;
+    return previous;
+}
+
+template <typename T, uint32_t B>
+CompressedSequenceIterator<T, B>::CompressedSequenceIterator(
+    const CompressedSequence<T, B>* sequence, size_t block) noexcept
+    : mSequence(sequence)
+    , mBlock(block)
+    , mOffset(0)
+    , mCursor(nullptr)
+    , mValue()
+{
+    enterBlock();
+}
+
+/**
+ * Decodes the first element of mBlock, if there is such a block.
+ */
+template <typename T, uint32_t B> void CompressedSequenceIterator<T, B>::enterBlock() noexcept
+{
+    if (mBlock < mSequence->mBlocks.size()) {
+        mCursor = mSequence->mBlocks[mBlock].mBytes.data();
+        mValue = CompressedSequence<T, B>::decode(T(), mCursor);
+    }
+}
+#endif
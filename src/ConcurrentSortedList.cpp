@@ -0,0 +1,230 @@
+// ConcurrentSortedList.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef CONCURRENT_SORTED_LIST_CPP
+#define CONCURRENT_SORTED_LIST_CPP
+#include <ConcurrentSortedList.h>
+#include <memory>
+
+/**
+ * Initializes an empty ConcurrentSortedList.
+ * This operation provides strong exception safety.
+ *
+ * @param compare strict weak ordering of the values
+ */
+template <typename T, typename Compare>
+ConcurrentSortedList<T, Compare>::ConcurrentSortedList(const Compare& compare)
+    : mCompare(compare)
+    , mHead()
+    , mTail()
+    , mSize(0)
+{
+    LinkedListNode<T>::link(&mHead, &mTail);
+}
+
+/**
+ * Destructor. Releases all resources held by this ConcurrentSortedList.
+ * No other thread may be using the list.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ */
+template <typename T, typename Compare>
+ConcurrentSortedList<T, Compare>::~ConcurrentSortedList() noexcept
+{
+    Node* node = mHead.next();
+    while (node != &mTail) {
+        Node* next = node->next();
+        // Point the node at itself so that the destructor's unlink stays local
+        node->mPrev = node;
+        node->mNext = node;
+        delete node;
+        node = next;
+    }
+    LinkedListNode<T>::link(&mHead, &mHead);
+    LinkedListNode<T>::link(&mTail, &mTail);
+}
+
+/**
+ * Inserts value at its sorted position unless an equivalent value is
+ * already present.
+ * This operation provides strong exception safety.
+ *
+ * @param value the value to insert
+ * @return true iff value was inserted
+ */
+template <typename T, typename Compare>
+bool ConcurrentSortedList<T, Compare>::insert(const T& value)
+{
+    // Allocate before taking any lock so that nothing can throw while locked
+    std::unique_ptr<Node> node(new Node(value));
+    Node* pred = nullptr;
+    Node* curr = find(value, pred);
+    bool inserted = !matches(curr, value);
+    if (inserted) {
+        LinkedListNode<T>::link(pred, node.get());
+        LinkedListNode<T>::link(node.release(), curr);
+        mSize.fetch_add(1, std::memory_order_relaxed);
+    }
+    curr->mLock.unlock();
+    pred->mLock.unlock();
+    return inserted;
+}
+
+/**
+ * Removes the value equivalent to value, if any.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ *
+ * @param value the value to remove
+ * @return true iff a value was removed
+ */
+template <typename T, typename Compare>
+bool ConcurrentSortedList<T, Compare>::erase(const T& value) noexcept
+{
+    Node* pred = nullptr;
+    Node* curr = find(value, pred);
+    if (!matches(curr, value)) {
+        curr->mLock.unlock();
+        pred->mLock.unlock();
+        return false;
+    }
+    // curr's successor's mPrev is guarded by curr's lock, which is held
+    LinkedListNode<T>::link(pred, curr->next());
+    curr->mPrev = curr;
+    curr->mNext = curr;
+    mSize.fetch_sub(1, std::memory_order_relaxed);
+    curr->mLock.unlock();
+    pred->mLock.unlock();
+    // Nobody can reach curr any more, nor be waiting for its lock
+    delete curr;
+    return true;
+}
+
+/**
+ * Returns true iff a value equivalent to value is present.
+ * This operation is a no-throw.
+ *
+ * @param value the value to look for
+ * @return true iff present
+ */
+template <typename T, typename Compare>
+bool ConcurrentSortedList<T, Compare>::contains(const T& value) const noexcept
+{
+    Node* pred = nullptr;
+    Node* curr = find(value, pred);
+    bool found = matches(curr, value);
+    curr->mLock.unlock();
+    pred->mLock.unlock();
+    return found;
+}
+
+/**
+ * Calls function with every value in sorted order. The walk is hand over
+ * hand, so concurrent operations on the part of the list that has already
+ * been visited (or not yet reached) are not held up. function runs while
+ * the lock of the visited node is held and must not use this list. If
+ * function throws, the walk stops and the exception is propagated.
+ * This operation provides strong exception safety, provided function does.
+ *
+ * @param function callable taking a const T&
+ */
+template <typename T, typename Compare>
+template <typename Function>
+void ConcurrentSortedList<T, Compare>::forEach(Function function) const
+{
+    Node* curr = &mHead;
+    curr->mLock.lock();
+    Node* next = curr->next();
+    while (next != &mTail) {
+        next->mLock.lock();
+        curr->mLock.unlock();
+        curr = next;
+        try {
+            function(static_cast<const T&>(curr->mItem));
+        } catch (...) {
+            curr->mLock.unlock();
+            throw;
+        }
+        next = curr->next();
+    }
+    curr->mLock.unlock();
+}
+
+/**
+ * Returns true if this ConcurrentSortedList is empty and false otherwise.
+ * This operation is a no-throw.
+ *
+ * @return bool True when empty
+ */
+template <typename T, typename Compare>
+bool ConcurrentSortedList<T, Compare>::isEmpty() const noexcept
+{
+    return size() == 0;
+}
+
+/**
+ * Return the number of values in this ConcurrentSortedList.
+ * This operation is a no-throw.
+ *
+ * @return
+ */
+template <typename T, typename Compare>
+uint32_t ConcurrentSortedList<T, Compare>::size() const noexcept
+{
+    return mSize.load(std::memory_order_relaxed);
+}
+
+/**
+ * Walks the list hand over hand and returns the first node whose value is
+ * not less than value (the tail if there is none), locked together with
+ * its predecessor, which is stored in pred.
+ * This operation is a no-throw.
+ *
+ * @param value the value to look for
+ * @param pred receives the locked predecessor
+ * @return the locked node
+ */
+template <typename T, typename Compare>
+typename ConcurrentSortedList<T, Compare>::Node* ConcurrentSortedList<T, Compare>::find(
+    const T& value, Node*& pred) const noexcept
+{
+    pred = &mHead;
+    pred->mLock.lock();
+    Node* curr = pred->next();
+    curr->mLock.lock();
+    while (curr != &mTail && mCompare(curr->mItem, value)) {
+        pred->mLock.unlock();
+        pred = curr;
+        curr = curr->next();
+        curr->mLock.lock();
+    }
+    return curr;
+}
+
+/**
+ * Returns true iff node is a real node holding a value equivalent to value.
+ * This operation is a no-throw.
+ */
+template <typename T, typename Compare>
+bool ConcurrentSortedList<T, Compare>::matches(const Node* node, const T& value) const noexcept
+{
+    return node != &mTail && !mCompare(value, node->mItem);
+}
+
+template <typename T, typename Compare>
+ConcurrentSortedList<T, Compare>::Node::Node(const T& item)
+    : LinkedListNode<T>(item)
+    , mLock()
+{
+}
+
+template <typename T, typename Compare>
+typename ConcurrentSortedList<T, Compare>::Node*
+ConcurrentSortedList<T, Compare>::Node::next() const noexcept
+{
+    return static_cast<Node*>(this->mNext);
+}
+#endif
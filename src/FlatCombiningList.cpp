@@ -0,0 +1,279 @@
+// FlatCombiningList.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef FLAT_COMBINING_LIST_CPP
+#define FLAT_COMBINING_LIST_CPP
+#include <FlatCombiningList.h>
+#include <algorithm>
+#include <thread>
+
+/**
+ * Initializes an empty FlatCombiningList with the given number of request
+ * slots. More threads than slots may use the list; a thread that finds
+ * every slot taken serves its own requests under the combiner lock until
+ * a slot is free.
+ * This operation provides strong exception safety.
+ *
+ * @param slots number of request slots
+ */
+template <typename T>
+FlatCombiningList<T>::FlatCombiningList(uint32_t slots)
+    : mCombiner()
+    , mList()
+    , mBatch()
+    , mSize(0)
+    , mSlotCount(slots == 0 ? 1 : slots)
+    , mSlotsUsed(0)
+    , mSlots(new Slot[mSlotCount])
+{
+    for (uint32_t i = 0; i < mSlotCount; ++i) {
+        mSlots[i].mState.store(kFree, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Appends a copy of value to the back of the list.
+ * This operation provides strong exception safety.
+ *
+ * @param value value to append
+ */
+template <typename T> void FlatCombiningList<T>::add(const T& value)
+{
+    submit(kAdd, &value, nullptr);
+}
+
+/**
+ * Removes the front element and assigns it to value if the list is not
+ * empty.
+ * This operation provides strong exception safety.
+ *
+ * @param value receives the removed element
+ * @return true iff an element was removed
+ */
+template <typename T> bool FlatCombiningList<T>::removeFront(T& value)
+{
+    return submit(kRemove, nullptr, &value);
+}
+
+/**
+ * Calls function with the underlying LinkedList while no request is being
+ * served, and returns what it returns.
+ * This operation provides the same exception safety as function.
+ *
+ * @param function callable taking a LinkedList<T>&
+ * @return result of function
+ */
+template <typename T>
+template <typename Function>
+auto FlatCombiningList<T>::withList(Function function)
+{
+    std::lock_guard<std::mutex> lock(mCombiner);
+    // Keep size() accurate however function changes the list
+    struct SizeUpdate {
+        FlatCombiningList<T>& mOwner;
+        ~SizeUpdate()
+        {
+            mOwner.mSize.store(mOwner.mList.size(), std::memory_order_relaxed);
+        }
+    } update { *this };
+    return function(mList);
+}
+
+/**
+ * Returns true if this FlatCombiningList was empty after the last pass.
+ * This operation is a no-throw.
+ *
+ * @return bool True when empty
+ */
+template <typename T> bool FlatCombiningList<T>::isEmpty() const noexcept
+{
+    return size() == 0;
+}
+
+/**
+ * Return the size of this FlatCombiningList as of the last pass.
+ * This operation is a no-throw.
+ *
+ * @return
+ */
+template <typename T> uint32_t FlatCombiningList<T>::size() const noexcept
+{
+    return mSize.load(std::memory_order_relaxed);
+}
+
+/**
+ * Publishes a request in a free slot and waits until it has been served,
+ * combining if possible. Rethrows the exception the request raised.
+ * Returns mFound of the slot.
+ */
+template <typename T> bool FlatCombiningList<T>::submit(State kind, const T* value, T* out)
+{
+    Slot* own = ownSlot();
+    if (own == nullptr) {
+        return serveAlone(kind, value, out);
+    }
+    Slot& slot = *own;
+    slot.mValue = value;
+    slot.mOut = out;
+    slot.mFound = false;
+    slot.mState.store(kind, std::memory_order_release);
+    while (slot.mState.load(std::memory_order_acquire) != kDone) {
+        if (mCombiner.try_lock()) {
+            combine();
+            mCombiner.unlock();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    bool found = slot.mFound;
+    std::exception_ptr error = slot.mError;
+    slot.mError = nullptr;
+    slot.mState.store(kClaimed, std::memory_order_relaxed);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return found;
+}
+
+/**
+ * Serves a request of the calling thread alone under mCombiner, for a
+ * thread that has no slot. Returns true iff an element was removed.
+ */
+template <typename T> bool FlatCombiningList<T>::serveAlone(State kind, const T* value, T* out)
+{
+    std::lock_guard<std::mutex> lock(mCombiner);
+    bool found = false;
+    if (kind == kAdd) {
+        mList.add(*value);
+    } else if (!mList.isEmpty()) {
+        *out = mList.get(0);
+        mList.remove(0);
+        found = true;
+    }
+    mSize.store(mList.size(), std::memory_order_relaxed);
+    return found;
+}
+
+/**
+ * Serves every published request. Must be called with mCombiner held.
+ * This operation is a no-throw.
+ */
+template <typename T> void FlatCombiningList<T>::combine() noexcept
+{
+    bool served = false;
+    uint32_t used = mSlotsUsed.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < used; ++i) {
+        Slot& slot = mSlots[i];
+        uint32_t state = slot.mState.load(std::memory_order_acquire);
+        if (state != kAdd && state != kRemove) {
+            continue;
+        }
+        try {
+            if (state == kAdd) {
+                mBatch.add(*slot.mValue);
+            } else if (!mList.isEmpty()) {
+                *slot.mOut = mList.get(0);
+                mList.remove(0);
+                slot.mFound = true;
+            } else if (!mBatch.isEmpty()) {
+                *slot.mOut = mBatch.get(0);
+                mBatch.remove(0);
+                slot.mFound = true;
+            }
+        } catch (...) {
+            slot.mError = std::current_exception();
+        }
+        // Not done yet: appended values are not in the list before the splice
+        slot.mState.store(kServed, std::memory_order_relaxed);
+        served = true;
+    }
+    if (!served) {
+        return;
+    }
+    mList.splice(mList.end(), mBatch);
+    mSize.store(mList.size(), std::memory_order_relaxed);
+    for (uint32_t i = 0; i < used; ++i) {
+        if (mSlots[i].mState.load(std::memory_order_relaxed) == kServed) {
+            mSlots[i].mState.store(kDone, std::memory_order_release);
+        }
+    }
+}
+
+/**
+ * Returns the slot the calling thread holds in this list, claiming one
+ * on its first request, or nullptr if every slot is taken.
+ */
+template <typename T> typename FlatCombiningList<T>::Slot* FlatCombiningList<T>::ownSlot()
+{
+    std::vector<Registration>& entries = registry().mEntries;
+    for (const Registration& entry : entries) {
+        if (!entry.mSlots.owner_before(mSlots) && !mSlots.owner_before(entry.mSlots)) {
+            return &mSlots[entry.mIndex];
+        }
+    }
+    // Forget the lists that are gone, and make room before claiming so that
+    // a failure cannot leak the slot
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                      [](const Registration& entry) { return entry.mSlots.expired(); }),
+        entries.end());
+    entries.reserve(entries.size() + 1);
+    uint32_t index = claim();
+    if (index == mSlotCount) {
+        return nullptr;
+    }
+    entries.push_back(Registration { mSlots, index });
+    return &mSlots[index];
+}
+
+/**
+ * Claims the lowest free slot and returns its index, or mSlotCount if
+ * every slot is taken.
+ * This operation is a no-throw.
+ */
+template <typename T> uint32_t FlatCombiningList<T>::claim() noexcept
+{
+    // Take the lowest free slot so that the slots in use stay packed at the
+    // front, where the combiner looks for them
+    for (uint32_t index = 0; index < mSlotCount; ++index) {
+        uint32_t expected = kFree;
+        if (mSlots[index].mState.load(std::memory_order_relaxed) == kFree
+            && mSlots[index].mState.compare_exchange_strong(
+                expected, kClaimed, std::memory_order_acquire, std::memory_order_relaxed)) {
+            uint32_t used = mSlotsUsed.load(std::memory_order_relaxed);
+            while (used <= index
+                && !mSlotsUsed.compare_exchange_weak(
+                    used, index + 1, std::memory_order_release, std::memory_order_relaxed)) {
+            }
+            return index;
+        }
+    }
+    return mSlotCount;
+}
+
+/**
+ * Returns the Registry of the calling thread.
+ * This operation is a no-throw.
+ */
+template <typename T>
+typename FlatCombiningList<T>::Registry& FlatCombiningList<T>::registry() noexcept
+{
+    thread_local Registry registry;
+    return registry;
+}
+
+/**
+ * Frees the slots the exiting thread holds in the lists that still exist.
+ * This operation is a no-throw.
+ */
+template <typename T> FlatCombiningList<T>::Registry::~Registry()
+{
+    for (const Registration& entry : mEntries) {
+        if (std::shared_ptr<Slot[]> slots = entry.mSlots.lock()) {
+            slots[entry.mIndex].mState.store(kFree, std::memory_order_release);
+        }
+    }
+}
+#endif
@@ -0,0 +1,437 @@
+// LinkedHashMap.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef LINKED_HASH_MAP_CPP
+#define LINKED_HASH_MAP_CPP
+#include <LinkedHashMap.h>
+#include <stdexcept>
+
+/**
+ * Initializes an empty LinkedHashMap.
+ * This operation provides strong exception safety.
+ */
+template <typename K, typename V>
+LinkedHashMap<K, V>::LinkedHashMap()
+    : mSize(0)
+    , mTail(std::make_unique<LinkedListNode<value_type>>())
+    , mSlots()
+{
+}
+
+/**
+ * Initializes the LinkedHashMap to be a copy of src, preserving the
+ * insertion order of src.
+ * This operation provides strong exception safety.
+ *
+ * @param src LinkedHashMap to copy
+ */
+template <typename K, typename V>
+LinkedHashMap<K, V>::LinkedHashMap(const LinkedHashMap<K, V>& src)
+    : LinkedHashMap()
+{
+    mSlots.assign(src.mSlots.size(), nullptr);
+    // The constructor is complete at this point, so the destructor releases
+    // whatever has been copied if a later copy throws.
+    for (const_iterator iter = src.begin(); iter != src.end(); ++iter) {
+        LinkedListNode<value_type>* node
+            = new LinkedListNode<value_type>(*iter, mTail->prev(), mTail.get());
+        mSlots[probe(node->mItem.first)] = node;
+        ++mSize;
+    }
+}
+
+/**
+ * Makes this object a copy of rhs using the same guidelines as the copy
+ * constructor. Note that calling this method on yourself (m = m;) is
+ * equivalent to a no-op.
+ * This operation provides strong exception safety.
+ *
+ * @param rhs LinkedHashMap to copy
+ * @return *this, used for chaining.
+ */
+template <typename K, typename V>
+LinkedHashMap<K, V>& LinkedHashMap<K, V>::operator=(const LinkedHashMap<K, V>& rhs)
+{
+    if (this != &rhs) {
+        LinkedHashMap<K, V> tmp(rhs);
+        swap(tmp);
+    }
+    return *this;
+}
+
+/**
+ * Destructor. Releases all resources held by this LinkedHashMap.
+ * This operation is no-throw under the assumption that the parameterizing
+ * types' destructors are no-throw.
+ */
+template <typename K, typename V> LinkedHashMap<K, V>::~LinkedHashMap() noexcept
+{
+    clear();
+}
+
+/**
+ * Inserts the entry (key, value) at the end of the iteration order if key
+ * is not already present. An existing entry is left untouched.
+ * This operation provides strong exception safety.
+ *
+ * @param key key of the entry
+ * @param value value of the entry
+ * @return iterator to the entry with the given key and true iff the entry
+ *         was inserted by this call.
+ */
+template <typename K, typename V>
+std::pair<LinkedListIterator<std::pair<const K, V>>, bool> LinkedHashMap<K, V>::insert(
+    const K& key, const V& value)
+{
+    LinkedListNode<value_type>* existing = lookup(key);
+    if (existing != nullptr) {
+        return std::make_pair(iterator(existing), false);
+    }
+    // Growing the table and creating the node may throw; neither is
+    // observable until the node is linked and recorded below.
+    reserveOne();
+    LinkedListNode<value_type>* node
+        = new LinkedListNode<value_type>(value_type(key, value), mTail->prev(), mTail.get());
+    mSlots[probe(key)] = node;
+    ++mSize;
+    return std::make_pair(iterator(node), true);
+}
+
+/**
+ * Returns a reference to the value mapped to key, inserting a default
+ * constructed value at the end of the iteration order if key is absent.
+ * This operation provides strong exception safety.
+ *
+ * @param key key to look up
+ * @return reference to the mapped value
+ */
+template <typename K, typename V> V& LinkedHashMap<K, V>::operator[](const K& key)
+{
+    return insert(key, V()).first->second;
+}
+
+/**
+ * Returns a constant reference to the value mapped to key. If key is not
+ * present, an std::out_of_range exception is thrown.
+ * This operation provides strong exception safety.
+ *
+ * @param key key to look up
+ * @return constant reference to the mapped value
+ */
+template <typename K, typename V> const V& LinkedHashMap<K, V>::at(const K& key) const
+{
+    LinkedListNode<value_type>* node = lookup(key);
+    if (node == nullptr) {
+        throw std::out_of_range("LinkedHashMap::at");
+    }
+    return node->mItem.second;
+}
+
+/**
+ * Returns a reference to the value mapped to key. If key is not present,
+ * an std::out_of_range exception is thrown.
+ * This operation provides strong exception safety.
+ *
+ * @param key key to look up
+ * @return reference to the mapped value
+ */
+template <typename K, typename V> V& LinkedHashMap<K, V>::at(const K& key)
+{
+    return const_cast<V&>(const_cast<const LinkedHashMap&>(*this).at(key));
+}
+
+/**
+ * Returns a constant iterator to the entry with the given key, or end() if
+ * there is no such entry.
+ * This operation is a no-throw.
+ *
+ * @param key key to look up
+ * @return const_iterator
+ */
+template <typename K, typename V>
+LinkedListConstIterator<std::pair<const K, V>> LinkedHashMap<K, V>::find(
+    const K& key) const noexcept
+{
+    LinkedListNode<value_type>* node = lookup(key);
+    return const_iterator(node == nullptr ? mTail.get() : node);
+}
+
+/**
+ * Returns an iterator to the entry with the given key, or end() if there
+ * is no such entry.
+ * This operation is a no-throw.
+ *
+ * @param key key to look up
+ * @return iterator
+ */
+template <typename K, typename V>
+LinkedListIterator<std::pair<const K, V>> LinkedHashMap<K, V>::find(const K& key) noexcept
+{
+    LinkedListNode<value_type>* node = lookup(key);
+    return iterator(node == nullptr ? mTail.get() : node);
+}
+
+/**
+ * Returns true if and only if an entry with the given key is present.
+ * This operation is a no-throw.
+ *
+ * @param key key to look up
+ * @return true iff present
+ */
+template <typename K, typename V> bool LinkedHashMap<K, V>::contains(const K& key) const noexcept
+{
+    return lookup(key) != nullptr;
+}
+
+/**
+ * Removes the entry with the given key, if present.
+ * This operation is no-throw under the assumption that the parameterizing
+ * types' destructors are no-throw.
+ *
+ * @param key key of the entry to remove
+ * @return true iff an entry was removed
+ */
+template <typename K, typename V> bool LinkedHashMap<K, V>::erase(const K& key) noexcept
+{
+    if (mSize == 0) {
+        return false;
+    }
+    uint32_t slot = probe(key);
+    LinkedListNode<value_type>* node = mSlots[slot];
+    if (node == nullptr) {
+        return false;
+    }
+    eraseSlot(slot);
+    delete node;
+    --mSize;
+    return true;
+}
+
+/**
+ * Removes the entry pointed to by iter and returns an iterator to the entry
+ * that followed it in iteration order. Other iterators stay valid.
+ * This operation is no-throw under the assumption that the parameterizing
+ * types' destructors are no-throw.
+ *
+ * @pre iter must point to an entry (not end) within this map
+ * @param iter iterator pointing to the entry that should be removed
+ * @return iterator to the next entry
+ */
+template <typename K, typename V>
+LinkedListIterator<std::pair<const K, V>> LinkedHashMap<K, V>::erase(iterator iter) noexcept
+{
+    LinkedListNode<value_type>* node = iter.mPtr;
+    iterator next(node->next());
+    eraseSlot(probe(node->mItem.first));
+    delete node;
+    --mSize;
+    return next;
+}
+
+/**
+ * Empties this LinkedHashMap returning it to the same state as the default
+ * constructor.
+ * This operation is no-throw under the assumption that the parameterizing
+ * types' destructors are no-throw.
+ */
+template <typename K, typename V> void LinkedHashMap<K, V>::clear() noexcept
+{
+    if (mSize != 0) {
+        LinkedListNode<value_type>* first = mTail->next();
+        LinkedListNodeBase::detachFrom(first, mTail.get());
+        LinkedListNode<value_type>::destroyChain(first);
+    }
+    mSize = 0;
+    mSlots.clear();
+}
+
+/**
+ * Returns a constant iterator to the oldest entry.
+ * This operation is a no-throw.
+ *
+ * @return const_iterator
+ */
+template <typename K, typename V>
+LinkedListConstIterator<std::pair<const K, V>> LinkedHashMap<K, V>::begin() const noexcept
+{
+    return const_iterator(mTail->next());
+}
+
+/**
+ * Returns an iterator to the oldest entry.
+ * This operation is a no-throw.
+ *
+ * @return iterator
+ */
+template <typename K, typename V>
+LinkedListIterator<std::pair<const K, V>> LinkedHashMap<K, V>::begin() noexcept
+{
+    return iterator(mTail->next());
+}
+
+/**
+ * Returns a constant iterator to the end.
+ * This operation is a no-throw.
+ *
+ * @return const_iterator
+ */
+template <typename K, typename V>
+LinkedListConstIterator<std::pair<const K, V>> LinkedHashMap<K, V>::end() const noexcept
+{
+    return const_iterator(mTail.get());
+}
+
+/**
+ * Returns an iterator to the end.
+ * This operation is a no-throw.
+ *
+ * @return iterator
+ */
+template <typename K, typename V>
+LinkedListIterator<std::pair<const K, V>> LinkedHashMap<K, V>::end() noexcept
+{
+    return iterator(mTail.get());
+}
+
+/**
+ * Returns true if this LinkedHashMap is empty and false otherwise.
+ * This operation is a no-throw.
+ *
+ * @return bool True when empty
+ */
+template <typename K, typename V> bool LinkedHashMap<K, V>::isEmpty() const noexcept
+{
+    return mSize == 0;
+}
+
+/**
+ * Return the number of entries in this LinkedHashMap.
+ * This operation is a no-throw.
+ *
+ * @return
+ */
+template <typename K, typename V> uint32_t LinkedHashMap<K, V>::size() const noexcept
+{
+    return mSize;
+}
+
+/**
+ * Returns the index of the slot that holds key or, if key is absent, of the
+ * empty slot at which the probe sequence for key ends.
+ * This operation is a no-throw.
+ *
+ * @pre the table has at least one empty slot
+ * @param key key to look up
+ * @return slot index
+ */
+template <typename K, typename V> uint32_t LinkedHashMap<K, V>::probe(const K& key) const noexcept
+{
+    uint32_t mask = static_cast<uint32_t>(mSlots.size()) - 1;
+    uint32_t slot = home(key);
+    while (mSlots[slot] != nullptr && !(mSlots[slot]->mItem.first == key)) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+/**
+ * Returns the node holding key, or nullptr if key is absent.
+ * This operation is a no-throw.
+ *
+ * @param key key to look up
+ * @return pointer to the node
+ */
+template <typename K, typename V>
+LinkedListNode<std::pair<const K, V>>* LinkedHashMap<K, V>::lookup(const K& key) const noexcept
+{
+    if (mSize == 0) {
+        return nullptr;
+    }
+    return mSlots[probe(key)];
+}
+
+/**
+ * Makes sure that one more entry can be added without exceeding the maximum
+ * load factor, rehashing into a table twice as big if necessary.
+ * This operation provides strong exception safety.
+ */
+template <typename K, typename V> void LinkedHashMap<K, V>::reserveOne()
+{
+    // Keep the load factor at or below 3/4 so that probe runs stay short.
+    uint64_t capacity = mSlots.size();
+    if ((static_cast<uint64_t>(mSize) + 1) * 4 > capacity * 3) {
+        rehash(capacity == 0 ? 8 : static_cast<uint32_t>(capacity * 2));
+    }
+}
+
+/**
+ * Rebuilds the slot table with the given (power of two) capacity.
+ * This operation provides strong exception safety.
+ *
+ * @param capacity new number of slots
+ */
+template <typename K, typename V> void LinkedHashMap<K, V>::rehash(uint32_t capacity)
+{
+    std::vector<LinkedListNode<value_type>*> slots(capacity, nullptr);
+    mSlots.swap(slots);
+    for (LinkedListNode<value_type>* node = mTail->next(); node != mTail.get();
+         node = node->next()) {
+        mSlots[probe(node->mItem.first)] = node;
+    }
+}
+
+/**
+ * Empties the given slot and shifts back the entries of its probe run so
+ * that no tombstones are necessary.
+ * This operation is a no-throw.
+ *
+ * @param slot index of the slot to empty
+ */
+template <typename K, typename V> void LinkedHashMap<K, V>::eraseSlot(uint32_t slot) noexcept
+{
+    uint32_t mask = static_cast<uint32_t>(mSlots.size()) - 1;
+    uint32_t hole = slot;
+    for (uint32_t next = (hole + 1) & mask; mSlots[next] != nullptr; next = (next + 1) & mask) {
+        // An entry may fill the hole only if the hole lies between its
+        // preferred slot and its current slot (cyclically).
+        uint32_t preferred = home(mSlots[next]->mItem.first);
+        if (((next - preferred) & mask) >= ((next - hole) & mask)) {
+            mSlots[hole] = mSlots[next];
+            hole = next;
+        }
+    }
+    mSlots[hole] = nullptr;
+}
+
+/**
+ * Returns the preferred slot of key in the current table.
+ * This operation is a no-throw.
+ *
+ * @param key key to hash
+ * @return slot index
+ */
+template <typename K, typename V> uint32_t LinkedHashMap<K, V>::home(const K& key) const noexcept
+{
+    // Fold the upper bits in so that hashes that only differ there (such as
+    // the identity hash of aligned pointers) still spread over small tables.
+    uint64_t hash = static_cast<uint64_t>(std::hash<K>()(key)) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<uint32_t>(hash >> 32) & (static_cast<uint32_t>(mSlots.size()) - 1);
+}
+
+/**
+ * Swaps the contents of this LinkedHashMap with that of other in constant
+ * time.
+ * This operation is a no-throw.
+ *
+ * @param other the LinkedHashMap to swap with
+ */
+template <typename K, typename V> void LinkedHashMap<K, V>::swap(LinkedHashMap<K, V>& other) noexcept
+{
+    mTail.swap(other.mTail);
+    mSlots.swap(other.mSlots);
+    std::swap(mSize, other.mSize);
+}
+#endif
@@ -8,54 +8,152 @@
 #define LINKEDLIST_CPP
 #include <LinkedList.h>
 #include <cstddef>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 /**
- * Initializes an empty LinkedList.
+ * Initializes an empty LinkedList using a default-constructed allocator.
  * This operation provides strong exception safety.
  */
-template <typename T>
-LinkedList<T>::LinkedList()
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList()
+    : LinkedList(Allocator())
+{
+}
+
+/**
+ * Initializes an empty LinkedList that allocates its nodes with allocator.
+ * This operation provides strong exception safety.
+ *
+ * @param allocator allocator to use
+ */
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(const Allocator& allocator)
     : mSize(0)
-    , mTail(std::make_unique<LinkedListNode<T>>())
+    , mAllocator(allocator)
+    , mTail(createNode(T()))
+    , mReclaimer(nullptr)
+    , mRecorder(nullptr)
+    , mIndex(IndexAllocator(allocator))
+    , mIndexState(IndexState::Off)
 {
 }
 
 /**
- * Initializes the LinkedList to be a copy of src.
+ * Initializes the LinkedList to be a copy of src. The allocator is
+ * obtained from src's through select_on_container_copy_construction.
  * This operation provides strong exception safety.
  *
  * @param src LinkedList to copy
  */
-template <typename T>
-LinkedList<T>::LinkedList(const LinkedList<T>& src)
-    : mSize(0)
-    , mTail(std::make_unique<LinkedListNode<T>>())
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(const LinkedList<T, Allocator>& src)
+    : LinkedList(
+        src, AllocatorTraits::select_on_container_copy_construction(src.getAllocator()))
+{
+}
+
+/**
+ * Initializes the LinkedList to be a copy of src that allocates its nodes
+ * with allocator.
+ * This operation provides strong exception safety.
+ *
+ * @param src LinkedList to copy
+ * @param allocator allocator to use
+ */
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(const LinkedList<T, Allocator>& src, const Allocator& allocator)
+    : LinkedList(allocator)
 {
-    uint32_t otherSize = src.mSize;
-    std::unique_ptr<LinkedList<T>> tmp(std::make_unique<LinkedList<T>>());
-    LinkedListConstIterator<T> iter = src.begin();
-    for (uint32_t i = 0; i < otherSize; ++i) {
-        tmp->add(*iter);
-        ++iter;
+    // This object is fully constructed here, so if a copy throws the
+    // destructor releases the nodes copied so far.
+    // Copy node by node so that runs of default values stay compressed
+    for (LinkedListNode<T>* node = src.mTail->next(); node != src.mTail; node = node->next()) {
+        createNode(node->mItem, mTail)->mCount = node->mCount;
+        mSize += node->mCount;
     }
-    swap(*tmp);
+}
+
+/**
+ * Initializes the LinkedList with the elements and the allocator of src,
+ * leaving src empty. The elements are not copied, but a dummy node is
+ * allocated.
+ * This operation provides strong exception safety.
+ *
+ * @param src LinkedList to move from
+ */
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(LinkedList<T, Allocator>&& src)
+    : LinkedList(src.getAllocator())
+{
+    transfer(end(), src);
 }
 
 /**
  * Makes this object a copy of rhs using the same guidelines as the copy
  * constructor. Note that calling this method on yourself (l = l;) is
- * equivalent to a no-op.
+ * equivalent to a no-op. The allocator of rhs is adopted if the
+ * allocator's propagate_on_container_copy_assignment is true. If
+ * the allocator stays the same and copying T cannot throw, the existing
+ * nodes are assigned to instead of building a copy and swapping with it.
  * This operation provides strong exception safety.
  *
  * @param rhs LinkedList to copy
  * @return *this, used for chaining.
  */
-template <typename T> LinkedList<T>& LinkedList<T>::operator=(const LinkedList<T>& rhs)
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(const LinkedList<T, Allocator>& rhs)
 {
     if (this != &rhs) {
-        std::unique_ptr<LinkedList<T>> tmp(std::make_unique<LinkedList<T>>(rhs));
-        swap(*tmp);
+        constexpr bool propagate = NodeTraits::propagate_on_container_copy_assignment::value;
+        if constexpr (kReuseNodes) {
+            if (!propagate || mAllocator == rhs.mAllocator) {
+                assignNodes(rhs);
+                return *this;
+            }
+        }
+        LinkedList<T, Allocator> tmp(rhs, propagate ? rhs.getAllocator() : getAllocator());
+        // Our old nodes end up in tmp; release them the way we would have
+        tmp.mReclaimer = mReclaimer;
+        if constexpr (propagate) {
+            std::swap(mAllocator, tmp.mAllocator);
+        }
+        swapNodes(tmp);
+    }
+    return *this;
+}
+
+/**
+ * Replaces the contents of this object with those of rhs. The nodes of rhs
+ * are taken over in constant time if the allocator of rhs is adopted
+ * (propagate_on_container_move_assignment) or equal to this object's;
+ * otherwise the elements are copied. rhs is left valid but unspecified.
+ * This operation provides strong exception safety.
+ *
+ * @param rhs LinkedList to move from
+ * @return *this, used for chaining.
+ */
+template <typename T, typename Allocator>
+LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(LinkedList<T, Allocator>&& rhs)
+{
+    if (this == &rhs) {
+        return *this;
+    }
+    if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+        // rhs keeps our dummy node together with the allocator it came from
+        clear();
+        std::swap(mAllocator, rhs.mAllocator);
+        swapNodes(rhs);
+    } else if (mAllocator == rhs.mAllocator) {
+        clear();
+        transfer(end(), rhs);
+    } else {
+        // Our allocator cannot free the nodes of rhs, so they are copied
+        LinkedList<T, Allocator> tmp(rhs, getAllocator());
+        tmp.mReclaimer = mReclaimer;
+        swapNodes(tmp);
     }
     return *this;
 }
@@ -65,9 +163,10 @@ template <typename T> LinkedList<T>& LinkedList<T>::operator=(const LinkedList<T
  * This operation is no-throw under the assumption that the parameterizing
  * type's destructor is no-throw.
  */
-template <typename T> LinkedList<T>::~LinkedList() noexcept
+template <typename T, typename Allocator> LinkedList<T, Allocator>::~LinkedList() noexcept
 {
-    LinkedList<T>::clear();
+    LinkedList<T, Allocator>::clear();
+    destroyNode(mTail);
 }
 
 /**
@@ -77,26 +176,39 @@ template <typename T> LinkedList<T>::~LinkedList() noexcept
  *
  * @param value value to append to this LinkedList
  */
-template <typename T> void LinkedList<T>::add(const T& value)
+template <typename T, typename Allocator> void LinkedList<T, Allocator>::add(const T& value)
 {
-    new LinkedListNode<T>(value, mTail->mPrev, mTail.get());
+    trace(TraceOp::Add, mSize);
+    createNode(value, mTail);
     ++mSize;
+    if (mIndexState == IndexState::Built) {
+        // Patch the index instead of discarding it; it is only a cache, so
+        // running out of memory merely makes it stale
+        try {
+            mIndex.push_back(mTail->mPrev);
+        } catch (...) {
+            mIndexState = IndexState::Stale;
+        }
+    }
 }
 
 /**
  * Inserts value at the specified index. All elements at or to the right of
- * index are shifted down by one spot. Time proportional to the maximum of
- * the size of this LinkedList or index is needed to perform this operation.
- * In particular, note that this operation does not perform the tail
- * insertion optimization that add(const T& value) offers. If this
- * LinkedList needs to be enlarged (index is out of range) default values
- * are used to fill the gaps.
+ * index are shifted down by one spot. Time proportional to index is needed
+ * to perform this operation. In particular, note that this operation does
+ * not perform the tail insertion optimization that add(const T& value)
+ * offers. If this LinkedList needs to be enlarged (index is out of range)
+ * default values are used to fill the gap. The gap is stored as a single
+ * run in constant time and space; its elements are only materialized, one
+ * at a time, when they are written or accessed through a mutable reference
+ * or iterator.
  * This operation provides strong exception safety.
  *
  * @param index index at which to insert value
  * @param value the element to insert
  */
-template <typename T> void LinkedList<T>::add(uint32_t index, const T& value)
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::add(uint32_t index, const T& value)
 {
     // case 1: adding to an empty list (adding to the front of the list)
     // case 2: adding to end of the list (index = mSize)
@@ -107,34 +219,248 @@ template <typename T> void LinkedList<T>::add(uint32_t index, const T& value)
     if (index == mSize) { // case 2
         add(value);
         return;
-    } else if (index < mSize) { // case 1, case 4
-        LinkedListNode<T>* currNode(mTail->mNext);
-        for (uint32_t i = 0; i < index; ++i) {
-            currNode = currNode->mNext;
-        }
-        new LinkedListNode<T>(value, currNode->mPrev, currNode);
+    }
+    trace(TraceOp::Insert, index);
+    if (index < mSize) { // case 1, case 4
+        LinkedListNode<T>* currNode(materialize(index));
+        createNode(value, currNode);
         ++mSize;
+        invalidateIndex();
     } else { // case 3, case 5, case 6
-        uint32_t firstSize = mSize;
-        uint32_t diff = index - firstSize;
-        for (uint32_t i = 0; i < diff; ++i) {
-            add(T());
+        uint32_t diff = index - mSize;
+        LinkedListNode<T>* last = mTail->prev();
+        if (kCompressGaps && last->mCount > 1) {
+            // Extend the run of default values that already ends the list
+            createNode(value, mTail);
+            last->mCount += diff;
+            ++mSize;
+            mSize += diff;
+            invalidateIndex();
+            return;
+        }
+        // Build the gap and the new element in a list of their own, so that
+        // a failure leaves this list untouched, and splice them in at once
+        LinkedList<T, Allocator> tail(getAllocator());
+        if constexpr (kCompressGaps) {
+            tail.add(T());
+            tail.mTail->mNext->mCount = diff;
+            tail.mSize = diff;
+        } else {
+            const T filler = T();
+            for (uint32_t i = 0; i < diff; ++i) {
+                tail.add(filler);
+            }
         }
-        add(value); // add the real value at the indexth index
+        tail.add(value);
+        transfer(end(), tail);
     }
 }
 
+/**
+ * Applies every edit recorded in batch during a single forward traversal
+ * of this LinkedList, with the same result as issuing the recorded calls
+ * one after another. A gap recorded by add() past the end becomes one run
+ * of default values, as it would with add(). All new elements are copied
+ * before the list is
+ * modified and replaced elements are swapped for new nodes rather than
+ * assigned to, so either every edit takes effect or none does. If this
+ * LinkedList does not have the size batch was recorded for, an
+ * std::invalid_argument exception is thrown.
+ * This operation provides strong exception safety.
+ *
+ * @param batch the edits to apply
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::apply(const LinkedListEditBatch<T>& batch)
+{
+    using Edit = typename LinkedListEditBatch<T>::Edit;
+    using Kind = typename LinkedListEditBatch<T>::Kind;
+    if (batch.mBaseSize != mSize) {
+        throw std::invalid_argument(std::to_string(batch.mBaseSize));
+    }
+    const std::vector<Edit> edits = batch.edits();
+    // Phase 1: create every node the batch needs. Nothing is linked yet, so
+    // a failure simply discards them.
+    // A fill is one run of default values, or one node per value if this
+    // list does not keep runs.
+    size_t needed = 0;
+    for (const Edit& edit : edits) {
+        if (edit.mKind != Kind::Remove) {
+            needed += edit.mKind == Kind::Fill && !kCompressGaps ? edit.mCount : 1;
+        }
+    }
+    std::vector<LinkedListNode<T>*> nodes;
+    nodes.reserve(needed);
+    LinkedListNode<T>* cursor = mTail->next();
+    uint32_t origin = 0;
+    try {
+        for (const Edit& edit : edits) {
+            if (edit.mKind == Kind::Fill && kCompressGaps) {
+                nodes.push_back(createNode(T()));
+                nodes.back()->mCount = edit.mCount;
+            } else if (edit.mKind == Kind::Fill) {
+                const T filler = T();
+                for (uint32_t i = 0; i < edit.mCount; ++i) {
+                    nodes.push_back(createNode(filler));
+                }
+            } else if (edit.mKind != Kind::Remove) {
+                nodes.push_back(createNode(batch.mValues[edit.mValue]));
+            }
+        }
+        // Every original element an edit refers to must have a node of its
+        // own. Materializing elements of default runs does not change the
+        // contents of this list, so a failure here still leaves it logically
+        // unchanged.
+        for (const Edit& edit : edits) {
+            if (edit.mOrigin == mSize) {
+                break;
+            }
+            for (; origin + cursor->mCount <= edit.mOrigin; cursor = cursor->next()) {
+                origin += cursor->mCount;
+            }
+            cursor = LinkedListNode<T>::isolate(cursor, edit.mOrigin - origin);
+            origin = edit.mOrigin;
+        }
+    } catch (...) {
+        for (LinkedListNode<T>* node : nodes) {
+            destroyNode(node);
+        }
+        throw;
+    }
+    trace(TraceOp::Apply, batch.mResultSize, static_cast<uint32_t>(edits.size()));
+    // Phase 2: one forward pass that only relinks and deletes nodes.
+    cursor = mTail->next();
+    origin = 0;
+    size_t created = 0;
+    for (const Edit& edit : edits) {
+        for (; origin + cursor->mCount <= edit.mOrigin; cursor = cursor->next()) {
+            origin += cursor->mCount;
+        }
+        if (edit.mKind != Kind::Remove) {
+            uint32_t count = edit.mKind == Kind::Fill && !kCompressGaps ? edit.mCount : 1;
+            for (uint32_t i = 0; i < count; ++i) {
+                LinkedListNodeBase::insertBefore(nodes[created++], cursor);
+            }
+        }
+        if (edit.mKind == Kind::Set || edit.mKind == Kind::Remove) {
+            LinkedListNode<T>* next = cursor->next();
+            destroyNode(cursor);
+            cursor = next;
+            ++origin;
+        }
+    }
+    mSize = batch.mResultSize;
+    invalidateIndex();
+}
+
 /**
  * Empties this LinkedList returning it to the same state as the default
- * constructor.
+ * constructor. The chain of nodes is detached in constant time and then
+ * released without relinking, on the reclaimer thread if this LinkedList
+ * has a reclaimer (see setReclaimer).
  * This operation is no-throw under the assumption that the parameterizing
  * type's destructor is no-throw.
  */
-template <typename T> void LinkedList<T>::clear() noexcept
+template <typename T, typename Allocator> void LinkedList<T, Allocator>::clear() noexcept
 {
-    while (mSize > 0) {
-        LinkedList<T>::removeNode(begin());
+    trace(TraceOp::Clear, 0);
+    if (mSize == 0) {
+        return;
     }
+    // Cut the chain out between the dummy node and itself
+    LinkedListNode<T>* first = mTail->next();
+    LinkedListNodeBase::detachFrom(first, mTail);
+    mSize = 0;
+    invalidateIndex();
+    release(first);
+}
+
+/**
+ * Opts this LinkedList in to (or, given nullptr, out of) deferred
+ * reclamation: from now on clear(), the destructor and assignment hand the
+ * nodes they release to reclaimer instead of freeing them on the calling
+ * thread. The reclaimer must outlive this LinkedList (or be unset before it
+ * is destroyed). The setting belongs to this object and is not copied.
+ * The destructor of T then runs on the reclaimer thread, concurrently with
+ * the caller, so it must be safe to run there: state it shares with other
+ * elements or with the caller needs synchronization, or the caller must
+ * wait for LinkedListReclaimer::flush() before touching it again.
+ * Lists whose allocator cannot be recreated on the reclaimer thread (one
+ * that is not always equal or not default-constructible) keep freeing
+ * their nodes synchronously.
+ * This operation is a no-throw.
+ *
+ * @param reclaimer reclaimer to use, or nullptr to free synchronously
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::setReclaimer(LinkedListReclaimer* reclaimer) noexcept
+{
+    mReclaimer = reclaimer;
+}
+
+/**
+ * Opts this LinkedList in to (or, given nullptr, out of) recording its
+ * operations: from now on add(), get(), set(), remove(), clear(), find(),
+ * findIf(), begin(), erase(), splice(), rotate(), moveToFront(),
+ * moveToBack() and apply() each append an event to recorder (see
+ * TraceOp), and so does the destructor, as a clear(). An event whose
+ * index is a position found through an iterator costs a walk of the list
+ * up to that position. Traversals the library makes
+ * on its own (operator==, toText()) are not recorded. The recorder must
+ * outlive this LinkedList (or be unset before it is destroyed). The
+ * setting belongs to this object and is not copied.
+ * This operation is a no-throw.
+ *
+ * @param recorder recorder to use, or nullptr to stop recording
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::setRecorder(LinkedListTraceRecorder* recorder) noexcept
+{
+    mRecorder = recorder;
+}
+
+/**
+ * Opts this LinkedList in to (or out of) keeping an index of its nodes
+ * (see the class description). Opting out frees the index. The setting
+ * belongs to this object and is not copied.
+ * This operation is a no-throw.
+ *
+ * @param indexed whether to keep an index
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::setIndexed(bool indexed) noexcept
+{
+    if (!indexed) {
+        dropIndex();
+        mIndexState = IndexState::Off;
+    } else if (mIndexState == IndexState::Off) {
+        mIndexState = IndexState::Stale;
+    }
+}
+
+/**
+ * Frees the memory held by the index. If this LinkedList is indexed, the
+ * index is rebuilt on the next indexed access.
+ * This operation is a no-throw.
+ */
+template <typename T, typename Allocator> void LinkedList<T, Allocator>::dropIndex() noexcept
+{
+    std::vector<LinkedListNodeBase*, IndexAllocator>(mIndex.get_allocator()).swap(mIndex);
+    invalidateIndex();
+}
+
+/**
+ * Returns the number of bytes allocated for the index, which is 0 unless
+ * this LinkedList is indexed and has been read by index since the index
+ * was last dropped.
+ * This operation is a no-throw.
+ *
+ * @return bytes held by the index
+ */
+template <typename T, typename Allocator>
+size_t LinkedList<T, Allocator>::indexMemory() const noexcept
+{
+    return mIndex.capacity() * sizeof(LinkedListNodeBase*);
 }
 
 /**
@@ -146,15 +472,14 @@ template <typename T> void LinkedList<T>::clear() noexcept
  * @param index index of the element to return
  * @return constant reference to the element at the index.
  */
-template <typename T> const T& LinkedList<T>::get(uint32_t index) const
+template <typename T, typename Allocator>
+const T& LinkedList<T, Allocator>::get(uint32_t index) const
 {
+    trace(TraceOp::Get, index);
     rangeCheck(index);
-    LinkedListNode<T>* currNode(mTail->mNext);
-    while (index > 0) {
-        currNode = currNode->mNext;
-        --index;
-    }
-    return currNode->mItem;
+    // Elements of a run of default values all share the run's item
+    uint32_t offset = 0;
+    return locate(index, offset)->mItem;
 }
 
 /**
@@ -166,9 +491,11 @@ template <typename T> const T& LinkedList<T>::get(uint32_t index) const
  * @param index index of the element to return
  * @return reference to the element at the index.
  */
-template <typename T> T& LinkedList<T>::get(uint32_t index)
+template <typename T, typename Allocator> T& LinkedList<T, Allocator>::get(uint32_t index)
 {
-    return const_cast<T&>(const_cast<const LinkedList&>(*this).get(index));
+    trace(TraceOp::Get, index);
+    rangeCheck(index);
+    return materialize(index)->mItem;
 }
 
 /**
@@ -179,17 +506,16 @@ template <typename T> T& LinkedList<T>::get(uint32_t index)
  * @param rhs the LinkedList being compared to
  * @return true iff logically equivalent
  */
-template <typename T> bool LinkedList<T>::operator==(const LinkedList<T>& rhs) const
+template <typename T, typename Allocator>
+bool LinkedList<T, Allocator>::operator==(const LinkedList<T, Allocator>& rhs) const
 {
     if (mSize != rhs.mSize) {
         return false;
     }
-    LinkedListNode<T>* tmp(mTail->mNext);
-    LinkedListNode<T>* rhsOne(rhs.mTail->mNext);
-    for (uint32_t i = 0; i < mSize; ++i) {
-        if (tmp->mItem != rhsOne->mItem) {
-            rhsOne = rhsOne->mNext;
-            tmp = tmp->mNext;
+    const_iterator rhsIter = rhs.untracedBegin();
+    for (const_iterator iter = untracedBegin(); iter != end(); ++iter, ++rhsIter) {
+        if (*iter != *rhsIter) {
+            return false;
         }
     }
     return true;
@@ -202,7 +528,8 @@ template <typename T> bool LinkedList<T>::operator==(const LinkedList<T>& rhs) c
  * @param rhs the LinkedList being compared to
  * @return true iff not logically equivalent
  */
-template <typename T> bool LinkedList<T>::operator!=(const LinkedList<T>& rhs) const
+template <typename T, typename Allocator>
+bool LinkedList<T, Allocator>::operator!=(const LinkedList<T, Allocator>& rhs) const
 {
     return !(*this == rhs);
 }
@@ -213,9 +540,11 @@ template <typename T> bool LinkedList<T>::operator!=(const LinkedList<T>& rhs) c
  *
  * @return const_iterator
  */
-template <typename T> LinkedListConstIterator<T> LinkedList<T>::begin() const noexcept
+template <typename T, typename Allocator>
+LinkedListConstIterator<T> LinkedList<T, Allocator>::begin() const noexcept
 {
-    return LinkedListConstIterator<T>(mTail->mNext);
+    trace(TraceOp::Iterate, 0);
+    return LinkedListConstIterator<T>(mTail->next());
 }
 
 /**
@@ -224,9 +553,11 @@ template <typename T> LinkedListConstIterator<T> LinkedList<T>::begin() const no
  *
  * @return iterator
  */
-template <typename T> LinkedListIterator<T> LinkedList<T>::begin() noexcept
+template <typename T, typename Allocator>
+LinkedListIterator<T> LinkedList<T, Allocator>::begin() noexcept
 {
-    return LinkedListIterator<T>(mTail->mNext);
+    trace(TraceOp::Iterate, 0);
+    return LinkedListIterator<T>(mTail->next());
 }
 
 /**
@@ -235,9 +566,10 @@ template <typename T> LinkedListIterator<T> LinkedList<T>::begin() noexcept
  *
  * @return const_iterator
  */
-template <typename T> LinkedListConstIterator<T> LinkedList<T>::end() const noexcept
+template <typename T, typename Allocator>
+LinkedListConstIterator<T> LinkedList<T, Allocator>::end() const noexcept
 {
-    return LinkedListConstIterator<T>(mTail.get());
+    return LinkedListConstIterator<T>(mTail);
 }
 
 /**
@@ -246,9 +578,10 @@ template <typename T> LinkedListConstIterator<T> LinkedList<T>::end() const noex
  *
  * @return iterator
  */
-template <typename T> LinkedListIterator<T> LinkedList<T>::end() noexcept
+template <typename T, typename Allocator>
+LinkedListIterator<T> LinkedList<T, Allocator>::end() noexcept
 {
-    return LinkedListIterator<T>(mTail.get());
+    return LinkedListIterator<T>(mTail);
 }
 
 /**
@@ -257,7 +590,7 @@ template <typename T> LinkedListIterator<T> LinkedList<T>::end() noexcept
  *
  * @return bool True when empty
  */
-template <typename T> bool LinkedList<T>::isEmpty() const noexcept
+template <typename T, typename Allocator> bool LinkedList<T, Allocator>::isEmpty() const noexcept
 {
     return mSize == 0;
 }
@@ -271,14 +604,52 @@ template <typename T> bool LinkedList<T>::isEmpty() const noexcept
  *
  * @param index index of the object to remove.
  */
-template <typename T> void LinkedList<T>::remove(uint32_t index)
+template <typename T, typename Allocator> void LinkedList<T, Allocator>::remove(uint32_t index)
 {
+    trace(TraceOp::Remove, index);
     rangeCheck(index);
-    LinkedListIterator<T> iter = begin();
-    for (uint32_t i = 0; i < index; ++i) {
-        ++iter;
+    uint32_t offset = 0;
+    LinkedListNode<T>* node = locate(index, offset);
+    if (node->mCount > 1) {
+        // Dropping an element of a run of default values only shortens it
+        --node->mCount;
+        --mSize;
+        invalidateIndex();
+        return;
     }
-    LinkedList<T>::removeNode(iter);
+    LinkedList<T, Allocator>::removeNode(iterator(node));
+}
+
+/**
+ * Removes the element position points to in constant time and returns
+ * an iterator to the element after it. Only iterators to the removed
+ * element are invalidated. position must be a dereferenceable iterator
+ * into this LinkedList.
+ * This operation is no-throw under the assumption that the
+ * parameterizing type's destructor is no-throw.
+ *
+ * @param position iterator to the element to remove
+ * @return iterator to the element that followed it
+ */
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::erase(
+    iterator position) noexcept
+{
+    LinkedListNode<T>* node = position.mPtr;
+    if (mRecorder != nullptr) {
+        trace(TraceOp::Erase, positionOf(node));
+    }
+    if (node->mCount > 1) {
+        // position is the first element of a run, and the rest of the run
+        // follows it
+        --node->mCount;
+        --mSize;
+        invalidateIndex();
+        return position;
+    }
+    iterator next(node->next());
+    removeNode(position);
+    return next;
 }
 
 /**
@@ -290,14 +661,271 @@ template <typename T> void LinkedList<T>::remove(uint32_t index)
  * @param index index of the object to set
  * @param value the new value
  */
-template <typename T> void LinkedList<T>::set(uint32_t index, const T& value)
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::set(uint32_t index, const T& value)
 {
+    trace(TraceOp::Set, index);
     rangeCheck(index);
-    LinkedListNode<T>* list(mTail->mNext);
-    for (uint32_t i = 0; i < index; ++i) {
-        list = list->mNext;
+    materialize(index)->mItem = value;
+}
+
+/**
+ * Returns a constant iterator to the first element equal to value, or
+ * end() if there is none. The search takes time proportional to the
+ * position of the element.
+ * This operation provides strong exception safety.
+ *
+ * @param value value to search for
+ * @return const_iterator to the element, or end()
+ */
+template <typename T, typename Allocator>
+LinkedListConstIterator<T> LinkedList<T, Allocator>::find(const T& value) const
+{
+    return findIf([&value](const T& item) { return item == value; });
+}
+
+/**
+ * Returns an iterator to the first element equal to value, or end() if
+ * there is none, and then reorganizes this LinkedList as policy asks (see
+ * SearchPolicy). Reorganizing only relinks the found node, so iterators
+ * stay valid, although the elements they point to may change position.
+ * An element in a run of default values is found but not moved.
+ * This operation provides strong exception safety.
+ *
+ * @param value value to search for
+ * @param policy how to reorganize the list after a hit
+ * @return iterator to the element, or end()
+ */
+template <typename T, typename Allocator>
+LinkedListIterator<T> LinkedList<T, Allocator>::find(const T& value, SearchPolicy policy)
+{
+    return findIf([&value](const T& item) { return item == value; }, policy);
+}
+
+/**
+ * Returns a constant iterator to the first element for which pred
+ * returns true, or end() if there is none.
+ * This operation provides strong exception safety.
+ *
+ * @param pred predicate taking a const T&
+ * @return const_iterator to the element, or end()
+ */
+template <typename T, typename Allocator>
+template <typename Predicate>
+LinkedListConstIterator<T> LinkedList<T, Allocator>::findIf(Predicate pred) const
+{
+    uint32_t position = 0;
+    LinkedListNode<T>* node = search(pred, position);
+    trace(TraceOp::Find, position);
+    return const_iterator(node);
+}
+
+/**
+ * Returns an iterator to the first element for which pred returns true,
+ * or end() if there is none, and then reorganizes this LinkedList as
+ * policy asks, like find().
+ * This operation provides strong exception safety.
+ *
+ * @param pred predicate taking a const T&
+ * @param policy how to reorganize the list after a hit
+ * @return iterator to the element, or end()
+ */
+template <typename T, typename Allocator>
+template <typename Predicate>
+LinkedListIterator<T> LinkedList<T, Allocator>::findIf(Predicate pred, SearchPolicy policy)
+{
+    uint32_t position = 0;
+    LinkedListNode<T>* node = search(pred, position);
+    trace(TraceOp::Find, position);
+    promote(node, policy);
+    return iterator(node);
+}
+
+/**
+ * Moves every element of other in front of position in constant time,
+ * leaving other empty. No element is copied and no node is allocated or
+ * freed. other must not be this LinkedList and its allocator must compare
+ * equal to this LinkedList's.
+ * This operation is a no-throw.
+ *
+ * @param position iterator into this LinkedList (may be end())
+ * @param other the LinkedList whose elements are moved
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::splice(iterator position, LinkedList<T, Allocator>& other) noexcept
+{
+    if (mRecorder != nullptr) {
+        trace(TraceOp::SpliceIn, positionOf(position.mPtr), other.mSize);
+    }
+    other.trace(TraceOp::SpliceOut, 0, other.mSize);
+    transfer(position, other);
+}
+
+/**
+ * Moves every element of other in front of position like
+ * splice(position, other), without recording anything. Used where a
+ * splice is part of another operation.
+ * This operation is a no-throw.
+ *
+ * @param position iterator into this LinkedList (may be end())
+ * @param other the LinkedList whose elements are moved
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::transfer(iterator position, LinkedList<T, Allocator>& other) noexcept
+{
+    if (other.mSize == 0) {
+        return;
+    }
+    // Runs of default values move as they are, so position is a node boundary
+    LinkedListNodeBase::spliceAll(position.mPtr, other.mTail);
+    mSize += other.mSize;
+    other.mSize = 0;
+    invalidateIndex();
+    other.invalidateIndex();
+}
+
+/**
+ * Moves the element element points to from other to the front of
+ * position in constant time. The node itself is relinked, so iterators
+ * to the element stay valid and now refer into this LinkedList. other
+ * may be this LinkedList; otherwise its allocator must compare equal to
+ * this LinkedList's. Moving an element out of a run of default values
+ * first gives it a node of its own, which may throw.
+ * This operation provides strong exception safety.
+ *
+ * @param position iterator into this LinkedList (may be end())
+ * @param other the LinkedList holding the element
+ * @param element dereferenceable iterator into other
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::splice(
+    iterator position, LinkedList<T, Allocator>& other, iterator element)
+{
+    if (&other == this && mRecorder != nullptr) {
+        trace(TraceOp::Move, positionOf(element.mPtr), positionOf(position.mPtr));
+    } else if (&other != this) {
+        if (mRecorder != nullptr) {
+            trace(TraceOp::SpliceIn, positionOf(position.mPtr), 1);
+        }
+        if (other.mRecorder != nullptr) {
+            other.trace(TraceOp::SpliceOut, other.positionOf(element.mPtr), 1);
+        }
+    }
+    if (element.mPtr->mCount > 1) {
+        LinkedListNode<T>::isolate(element.mPtr, 0);
+        other.invalidateIndex();
+    }
+    LinkedListNode<T>* node = element.mPtr;
+    if (node == position.mPtr || node->mNext == position.mPtr) {
+        return;
+    }
+    LinkedListNodeBase::relink(node, position.mPtr);
+    --other.mSize;
+    ++mSize;
+    invalidateIndex();
+    other.invalidateIndex();
+}
+
+/**
+ * Moves the first k elements of this LinkedList, in order, behind the
+ * last one (k is taken modulo size()). Only the dummy node is relinked,
+ * after a walk from whichever end is closer to the new first element, so
+ * this completes in time proportional to min(k, size() - k), or in constant
+ * time if the index is built; a stale index is not rebuilt. No element is
+ * copied and no node is allocated unless the new first element lies
+ * inside a run of default values, which is then split.
+ * This operation provides strong exception safety.
+ *
+ * @param k number of positions to rotate by
+ */
+template <typename T, typename Allocator> void LinkedList<T, Allocator>::rotate(uint32_t k)
+{
+    trace(TraceOp::Rotate, mSize == 0 ? 0 : k % mSize);
+    if (mSize == 0 || (k %= mSize) == 0) {
+        return;
+    }
+    uint32_t offset = 0;
+    LinkedListNode<T>* first = nullptr;
+    if (mIndexState == IndexState::Built) {
+        first = static_cast<LinkedListNode<T>*>(mIndex[k]);
+    } else if (k <= mSize - k) {
+        // Not locate(): rebuilding a stale index would cost O(size())
+        first = static_cast<LinkedListNode<T>*>(LinkedListNodeBase::seek(mTail, k, offset));
+    } else {
+        uint32_t back = mSize - k;
+        first = mTail->prev();
+        while (back > first->mCount) {
+            back -= first->mCount;
+            first = first->prev();
+        }
+        offset = first->mCount - back;
+    }
+    if (offset != 0) {
+        first = LinkedListNode<T>::isolate(first, offset);
+    }
+    LinkedListNodeBase::relink(mTail, first);
+    invalidateIndex();
+}
+
+/**
+ * Moves the element position points to to the front of this LinkedList
+ * in constant time. The node is relinked, so iterators to the element
+ * stay valid. No element is copied and no node is allocated unless the
+ * element is the first of a run of default values, which then gets a
+ * node of its own.
+ * This operation provides strong exception safety.
+ *
+ * @param position dereferenceable iterator into this LinkedList
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::moveToFront(iterator position)
+{
+    splice(iterator(mTail->next()), *this, position);
+}
+
+/**
+ * Moves the element position points to to the back of this LinkedList
+ * in constant time. The node is relinked, so iterators to the element
+ * stay valid. No element is copied and no node is allocated unless the
+ * element is the first of a run of default values, which then gets a
+ * node of its own.
+ * This operation provides strong exception safety.
+ *
+ * @param position dereferenceable iterator into this LinkedList
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::moveToBack(iterator position)
+{
+    splice(end(), *this, position);
+}
+
+/**
+ * Swaps the contents of this LinkedList with that of other in constant
+ * time. The allocators are swapped as well if the allocator's
+ * propagate_on_container_swap is true; otherwise they must compare equal.
+ * This operation is a no-throw.
+ *
+ * @param other the LinkedList to swap with
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::swap(LinkedList<T, Allocator>& other) noexcept
+{
+    if constexpr (NodeTraits::propagate_on_container_swap::value) {
+        std::swap(mAllocator, other.mAllocator);
     }
-    list->mItem = value;
+    swapNodes(other);
+}
+
+/**
+ * Returns a copy of the allocator this LinkedList allocates its nodes with.
+ * This operation is a no-throw.
+ *
+ * @return allocator
+ */
+template <typename T, typename Allocator>
+Allocator LinkedList<T, Allocator>::getAllocator() const noexcept
+{
+    return Allocator(mAllocator);
 }
 
 /**
@@ -306,7 +934,7 @@ template <typename T> void LinkedList<T>::set(uint32_t index, const T& value)
  *
  * @return
  */
-template <typename T> uint32_t LinkedList<T>::size() const noexcept
+template <typename T, typename Allocator> uint32_t LinkedList<T, Allocator>::size() const noexcept
 {
     return mSize;
 }
@@ -318,13 +946,147 @@ template <typename T> uint32_t LinkedList<T>::size() const noexcept
  *
  * @param index index to check
  */
-template <typename T> void LinkedList<T>::rangeCheck(uint32_t index) const
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::rangeCheck(uint32_t index) const
 {
     if (index >= mSize) {
         throw std::out_of_range(std::to_string(index));
     }
 }
 
+/**
+ * Returns the node whose run contains the element at index and stores the
+ * position of that element within the run in offset.
+ * This operation is a no-throw.
+ *
+ * @pre index < size()
+ * @param index index of the element
+ * @param offset receives the offset of the element within the node's run
+ * @return node containing the element
+ */
+template <typename T, typename Allocator>
+LinkedListNode<T>* LinkedList<T, Allocator>::locate(uint32_t index, uint32_t& offset) const noexcept
+{
+    if (mIndexState != IndexState::Off && buildIndex()) {
+        offset = 0;
+        return static_cast<LinkedListNode<T>*>(mIndex[index]);
+    }
+    return static_cast<LinkedListNode<T>*>(LinkedListNodeBase::seek(mTail, index, offset));
+}
+
+/**
+ * Returns the node holding exactly the element at index, first splitting
+ * it out of its run of default values if necessary. The contents of this
+ * LinkedList do not change.
+ * This operation provides strong exception safety.
+ *
+ * @pre index < size()
+ * @param index index of the element
+ * @return node holding the element
+ */
+template <typename T, typename Allocator>
+LinkedListNode<T>* LinkedList<T, Allocator>::materialize(uint32_t index)
+{
+    uint32_t offset = 0;
+    LinkedListNode<T>* node = locate(index, offset);
+    if (node->mCount == 1) {
+        return node;
+    }
+    LinkedListNode<T>* element = LinkedListNode<T>::isolate(node, offset);
+    invalidateIndex();
+    return element;
+}
+
+/**
+ * Makes sure the index is built, if this LinkedList is indexed and an
+ * index can be built. Running out of memory leaves the index stale.
+ * This operation is a no-throw.
+ *
+ * @return true iff mIndex may be used
+ */
+template <typename T, typename Allocator> bool LinkedList<T, Allocator>::buildIndex() const noexcept
+{
+    if (mIndexState != IndexState::Stale) {
+        return mIndexState == IndexState::Built;
+    }
+    mIndex.clear();
+    try {
+        mIndex.reserve(mSize);
+    } catch (...) {
+        return false;
+    }
+    for (LinkedListNodeBase* node = mTail->mNext; node != mTail; node = node->mNext) {
+        if (node->mCount != 1) {
+            std::vector<LinkedListNodeBase*, IndexAllocator>(mIndex.get_allocator()).swap(mIndex);
+            mIndexState = IndexState::Unusable;
+            return false;
+        }
+        mIndex.push_back(node);
+    }
+    mIndexState = IndexState::Built;
+    return true;
+}
+
+/**
+ * Records a structural change: the index, if kept, must be rebuilt.
+ * This operation is a no-throw.
+ */
+template <typename T, typename Allocator> void LinkedList<T, Allocator>::invalidateIndex() noexcept
+{
+    if (mIndexState != IndexState::Off) {
+        mIndexState = IndexState::Stale;
+    }
+}
+
+/**
+ * Records op in the recorder, if this LinkedList has one, with the
+ * current size.
+ * This operation is a no-throw.
+ *
+ * @param op kind of operation
+ * @param index index of the operation (see TraceEvent)
+ * @param count count of the operation (see TraceEvent)
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::trace(TraceOp op, uint32_t index, uint32_t count) const noexcept
+{
+    if (mRecorder != nullptr) {
+        mRecorder->record(op, index, mSize, count);
+    }
+}
+
+/**
+ * Returns the index of the first element node holds, or size() for the
+ * dummy node, by walking from the front. Only used for tracing.
+ * This operation is a no-throw.
+ *
+ * @param node node of this LinkedList
+ * @return index of node
+ */
+template <typename T, typename Allocator>
+uint32_t LinkedList<T, Allocator>::positionOf(const LinkedListNodeBase* node) const noexcept
+{
+    uint32_t index = 0;
+    for (LinkedListNode<T>* cursor = mTail->next(); cursor != node; cursor = cursor->next()) {
+        index += cursor->mCount;
+    }
+    return index;
+}
+
+/**
+ * Returns a constant iterator to the beginning like begin(), without
+ * recording anything. Used by traversals the library makes on its own.
+ * This operation is a no-throw.
+ *
+ * @return const_iterator
+ */
+template <typename T, typename Allocator>
+typename LinkedList<T, Allocator>::const_iterator
+LinkedList<T, Allocator>::untracedBegin() const noexcept
+{
+    return const_iterator(mTail->next());
+}
+
 /**
  * Removes from this LinkedList the node pointed to by iter.
  * This operation is no-throw under the assumption that the parameterizing
@@ -333,23 +1095,242 @@ template <typename T> void LinkedList<T>::rangeCheck(uint32_t index) const
  * @pre the iterator iter must point to an element (or end) within this list
  * @param iter iterator pointing to the node that should be removed.
  */
-template <typename T> void LinkedList<T>::removeNode(LinkedList::iterator iter) noexcept
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::removeNode(LinkedList::iterator iter) noexcept
 {
     if (iter != end()) {
-        delete iter.mPtr;
-        --mSize;
+        mSize -= iter.mPtr->mCount;
+        destroyNode(iter.mPtr);
+        invalidateIndex();
+    }
+}
+
+/**
+ * Returns the first node, in list order, whose item satisfies pred, or
+ * the dummy node if there is none, and stores the index of its (first)
+ * element, or the size, in position.
+ * This operation provides strong exception safety.
+ *
+ * @param pred predicate taking a const T&
+ * @param position receives the index of the node found
+ * @return matching node or mTail
+ */
+template <typename T, typename Allocator>
+template <typename Predicate>
+LinkedListNode<T>* LinkedList<T, Allocator>::search(Predicate& pred, uint32_t& position) const
+{
+    // A run shares one item, so each node is tested once
+    LinkedListNode<T>* node = mTail->next();
+    position = 0;
+    while (node != mTail && !pred(static_cast<const T&>(node->mItem))) {
+        position += node->mCount;
+        node = node->next();
+    }
+    return node;
+}
+
+/**
+ * Relinks node toward the head as policy asks. The dummy node and nodes
+ * standing for a run of default values stay where they are.
+ * This operation is a no-throw.
+ *
+ * @param node node found by a search
+ * @param policy reorganization to perform
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::promote(LinkedListNode<T>* node, SearchPolicy policy) noexcept
+{
+    if (node == mTail || node->mCount != 1 || node->mPrev == mTail) {
+        return;
+    }
+    switch (policy) {
+    case SearchPolicy::Static:
+        break;
+    case SearchPolicy::MoveToFront:
+        LinkedListNodeBase::moveToFront(node, mTail);
+        invalidateIndex();
+        break;
+    case SearchPolicy::Transpose:
+        LinkedListNodeBase::transpose(node);
+        invalidateIndex();
+        break;
+    }
+}
+
+/**
+ * Allocates a node holding a copy of item. The node is linked in front
+ * of next or, if next is nullptr, only to itself.
+ * This operation provides strong exception safety.
+ *
+ * @param item item to store in the node
+ * @param next node to link the new node in front of, or nullptr
+ * @return the new node
+ */
+template <typename T, typename Allocator>
+LinkedListNode<T>* LinkedList<T, Allocator>::createNode(const T& item, LinkedListNode<T>* next)
+{
+    LinkedListNode<T>* node = NodeTraits::allocate(mAllocator, 1);
+    try {
+        NodeTraits::construct(mAllocator, node, item);
+    } catch (...) {
+        NodeTraits::deallocate(mAllocator, node, 1);
+        throw;
+    }
+    if (next != nullptr) {
+        LinkedListNodeBase::insertBefore(node, next);
+    }
+    return node;
+}
+
+/**
+ * Destroys node, which unlinks it from its neighbors, and frees it.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ *
+ * @param node node obtained from createNode
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::destroyNode(LinkedListNode<T>* node) noexcept
+{
+    // Nodes split off a run by LinkedListNode::isolate come from new, which
+    // std::allocator (the only allocator lists with runs use) also calls
+    NodeTraits::destroy(mAllocator, node);
+    NodeTraits::deallocate(mAllocator, node, 1);
+}
+
+/**
+ * Hands a detached, nullptr-terminated chain to the reclaimer or, without
+ * one, frees it right away.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ *
+ * @param first first node of the chain (may be nullptr)
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::release(LinkedListNode<T>* first) noexcept
+{
+    if constexpr (kDeferredReclaim) {
+        if (mReclaimer != nullptr && first != nullptr) {
+            mReclaimer->retire(first, &LinkedList<T, Allocator>::reclaimChain);
+            return;
+        }
     }
+    destroyChain(mAllocator, first);
+}
+
+/**
+ * Makes this LinkedList a copy of rhs by assigning to its existing nodes.
+ * Any nodes missing are created before anything is assigned and surplus
+ * nodes are released afterwards, so with a no-throw copy assignment either
+ * the whole copy succeeds or this list is unchanged.
+ * This operation provides strong exception safety.
+ *
+ * @pre kReuseNodes and rhs is not this LinkedList
+ * @param rhs LinkedList to copy
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::assignNodes(const LinkedList<T, Allocator>& rhs)
+{
+    LinkedListNode<T>* node = mTail->next();
+    const LinkedListNode<T>* from = rhs.mTail->next();
+    while (node != mTail && from != rhs.mTail) {
+        node = node->next();
+        from = from->next();
+    }
+    // Copy the nodes we are short of into a detached chain
+    LinkedListNode<T>* first = nullptr;
+    LinkedListNode<T>* last = nullptr;
+    try {
+        for (; from != rhs.mTail; from = from->next()) {
+            LinkedListNode<T>* copy = createNode(from->mItem);
+            copy->mCount = from->mCount;
+            if (last == nullptr) {
+                first = copy;
+            } else {
+                LinkedListNode<T>::link(last, copy);
+            }
+            last = copy;
+        }
+    } catch (...) {
+        if (last != nullptr) {
+            last->mNext = nullptr;
+        }
+        destroyChain(mAllocator, first);
+        throw;
+    }
+    // Nothing below can throw
+    node = mTail->next();
+    from = rhs.mTail->next();
+    for (; node != mTail && from != rhs.mTail; node = node->next(), from = from->next()) {
+        node->mItem = from->mItem;
+        node->mCount = from->mCount;
+    }
+    if (first != nullptr) {
+        LinkedListNodeBase::insertChain(first, last, mTail);
+    } else {
+        release(static_cast<LinkedListNode<T>*>(LinkedListNodeBase::detachFrom(node, mTail)));
+    }
+    mSize = rhs.mSize;
+    invalidateIndex();
+}
+
+/**
+ * Destroys and frees first and every node reachable from it through
+ * mNext, up to (but not including) nullptr, without relinking their
+ * neighbors (see LinkedListNode::destroyChain). Trivially destructible
+ * elements need no destructor call, so their nodes are only freed.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ *
+ * @param allocator allocator the nodes were obtained from
+ * @param first first node of a nullptr-terminated chain (may be nullptr)
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::destroyChain(
+    NodeAllocator& allocator, LinkedListNode<T>* first) noexcept
+{
+    while (first != nullptr) {
+        LinkedListNode<T>* next = first->next();
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            // Point the node at itself so that the destructor's unlink stays
+            // local
+            first->mPrev = first;
+            first->mNext = first;
+            NodeTraits::destroy(allocator, first);
+        }
+        NodeTraits::deallocate(allocator, first, 1);
+        first = next;
+    }
+}
+
+/**
+ * Type-erased destroyChain for use with LinkedListReclaimer. Only used
+ * when kDeferredReclaim holds.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ *
+ * @param first first node of a nullptr-terminated chain
+ */
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::reclaimChain(void* first) noexcept
+{
+    NodeAllocator allocator;
+    destroyChain(allocator, static_cast<LinkedListNode<T>*>(first));
 }
 
 /**
- * Swaps the contents of this LinkedList with that of other in constant time.
+ * Swaps the nodes and sizes of this LinkedList and other in constant time,
+ * but not their allocators.
  * This operation is a no-throw.
  *
  * @param other the LinkedList to swap with
  */
-template <typename T> void LinkedList<T>::swap(LinkedList<T>& rhs) noexcept
+template <typename T, typename Allocator>
+void LinkedList<T, Allocator>::swapNodes(LinkedList<T, Allocator>& other) noexcept
 {
-    mTail.swap(rhs.mTail);
-    std::swap(rhs.mSize, mSize);
+    std::swap(mTail, other.mTail);
+    std::swap(mSize, other.mSize);
+    invalidateIndex();
+    other.invalidateIndex();
 }
 #endif
@@ -11,12 +11,12 @@
 template <typename T>
 bool LinkedListConstIterator<T>::operator==(const LinkedListConstIterator<T>& rhs) const noexcept
 {
-    return mPtr == rhs.mPtr;
+    return mPtr == rhs.mPtr && mOffset == rhs.mOffset;
 }
 template <typename T>
 bool LinkedListConstIterator<T>::operator!=(const LinkedListConstIterator<T>& rhs) const noexcept
 {
-    return mPtr != rhs.mPtr;
+    return !(*this == rhs);
 }
 template <typename T> const T& LinkedListConstIterator<T>::operator*() const
 {
@@ -28,29 +28,40 @@ template <typename T> const T* LinkedListConstIterator<T>::operator->() const
 }
 template <typename T> LinkedListConstIterator<T>& LinkedListConstIterator<T>::operator++()
 {
-    mPtr = mPtr->mNext;
+    if (mOffset + 1 < mPtr->mCount) {
+        ++mOffset;
+    } else {
+        mPtr = mPtr->next();
+        mOffset = 0;
+    }
     return *this;
 }
 template <typename T> const LinkedListConstIterator<T> LinkedListConstIterator<T>::operator++(int)
 {
-    LinkedListConstIterator<T> temp(mPtr);
-    mPtr = mPtr->mNext;
+    LinkedListConstIterator<T> temp(*this);
+    ++*this;
     return temp;
 }
 template <typename T> LinkedListConstIterator<T>& LinkedListConstIterator<T>::operator--()
 {
-    mPtr = mPtr->mPrev;
+    if (mOffset > 0) {
+        --mOffset;
+    } else {
+        mPtr = mPtr->prev();
+        mOffset = mPtr->mCount - 1;
+    }
     return *this;
 }
 template <typename T> const LinkedListConstIterator<T> LinkedListConstIterator<T>::operator--(int)
 {
-    LinkedListConstIterator<T> temp(mPtr);
-    mPtr = mPtr->mPrev;
+    LinkedListConstIterator<T> temp(*this);
+    --*this;
     return temp;
 }
 template <typename T>
-LinkedListConstIterator<T>::LinkedListConstIterator(LinkedListNode<T>* ptr)
+LinkedListConstIterator<T>::LinkedListConstIterator(LinkedListNode<T>* ptr, uint32_t offset)
     : mPtr(ptr)
+    , mOffset(offset)
 {
 }
 #endif
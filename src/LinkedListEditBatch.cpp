@@ -0,0 +1,433 @@
+// LinkedListEditBatch.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef LINKED_LIST_EDIT_BATCH_CPP
+#define LINKED_LIST_EDIT_BATCH_CPP
+#include <LinkedListEditBatch.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+/**
+ * Initializes an empty batch of edits for list. The batch may only be
+ * applied to a list of the same size as list has now.
+ * This operation is a no-throw.
+ *
+ * @param list the list the edits will be applied to
+ */
+template <typename T>
+template <typename Allocator>
+LinkedListEditBatch<T>::LinkedListEditBatch(const LinkedList<T, Allocator>& list) noexcept
+    : mBaseSize(list.size())
+    , mResultSize(list.size())
+    , mNodes()
+    , mRoot(kNil)
+    , mSeed(2463534242U)
+    , mValues()
+{
+}
+
+/**
+ * Records the insertion of value at index, with the semantics of
+ * LinkedList::add(uint32_t, const T&) (including filling any gap with
+ * default values).
+ * This operation provides strong exception safety.
+ *
+ * @param index index at which to insert value
+ * @param value the element to insert
+ */
+template <typename T> void LinkedListEditBatch<T>::add(uint32_t index, const T& value)
+{
+    if (index <= mResultSize) {
+        record(locate(index), Kind::Insert, store(value));
+        ++mResultSize;
+        return;
+    }
+    // Everything past the current end is appended in order: the gap as one
+    // fill, after the untouched original elements, then value
+    makeRoom(2);
+    uint32_t item = store(value);
+    uint32_t nodes = mRoot == kNil ? 0 : mNodes[mRoot].mNodes;
+    uint32_t untouched = mBaseSize - (mRoot == kNil ? 0 : mNodes[mRoot].mOrigins);
+    const Node pieces[] = { Node { untouched, 0, index - mResultSize, Kind::Fill },
+        Node { 0, item, 1, Kind::Insert } };
+    replace(nodes, 0, pieces, pieces + 2);
+    mResultSize = index + 1;
+}
+
+/**
+ * Records the removal of the element at index. If index is out of bounds
+ * an std::out_of_range exception is thrown with index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the object to remove
+ */
+template <typename T> void LinkedListEditBatch<T>::remove(uint32_t index)
+{
+    rangeCheck(index);
+    record(locate(index), Kind::Remove, 0);
+    --mResultSize;
+}
+
+/**
+ * Records setting the element at index to value. If index is out of
+ * bounds an std::out_of_range exception is thrown with index as its
+ * message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the object to set
+ * @param value the new value
+ */
+template <typename T> void LinkedListEditBatch<T>::set(uint32_t index, const T& value)
+{
+    rangeCheck(index);
+    record(locate(index), Kind::Set, store(value));
+}
+
+/**
+ * Discards every recorded edit.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ */
+template <typename T> void LinkedListEditBatch<T>::clear() noexcept
+{
+    mNodes.clear();
+    mRoot = kNil;
+    mValues.clear();
+    mResultSize = mBaseSize;
+}
+
+/**
+ * Returns true if no edit that changes the list is pending.
+ * This operation is a no-throw.
+ *
+ * @return bool True when empty
+ */
+template <typename T> bool LinkedListEditBatch<T>::isEmpty() const noexcept
+{
+    return mRoot == kNil;
+}
+
+/**
+ * Returns the size the list will have once the batch has been applied.
+ * This operation is a no-throw.
+ *
+ * @return resulting size
+ */
+template <typename T> uint32_t LinkedListEditBatch<T>::resultSize() const noexcept
+{
+    return mResultSize;
+}
+
+/**
+ * Finds the element at the given current index.
+ * This operation is a no-throw.
+ *
+ * @param index current index, at most resultSize()
+ * @return location of the element
+ */
+template <typename T>
+typename LinkedListEditBatch<T>::Location LinkedListEditBatch<T>::locate(
+    uint32_t index) const noexcept
+{
+    // index is relative to the subtree of node, rank counts the nodes before it
+    uint32_t rank = 0;
+    uint32_t node = mRoot;
+    while (node != kNil) {
+        const Node& edit = mNodes[node];
+        if (edit.mLeft != kNil) {
+            if (index < mNodes[edit.mLeft].mLength) {
+                node = edit.mLeft;
+                continue;
+            }
+            index -= mNodes[edit.mLeft].mLength;
+            rank += mNodes[edit.mLeft].mNodes;
+        }
+        if (index < edit.mGap) {
+            return Location { rank, node, index, 0, false };
+        }
+        index -= edit.mGap;
+        uint32_t own = edit.mKind == Kind::Remove ? 0 : edit.mCount;
+        if (index < own) {
+            return Location { rank, node, edit.mGap, index, true };
+        }
+        index -= own;
+        ++rank;
+        node = edit.mRight;
+    }
+    return Location { rank, kNil, index, 0, false };
+}
+
+/**
+ * Records an edit of the given kind for the element at location.
+ * This operation provides strong exception safety.
+ */
+template <typename T>
+void LinkedListEditBatch<T>::record(const Location& location, Kind kind, uint32_t value)
+{
+    makeRoom(3);
+    if (location.mIsEdit && mNodes[location.mNode].mKind == Kind::Fill
+        && (kind != Kind::Insert || location.mOffset != 0)) {
+        recordInFill(location, kind, value);
+        return;
+    }
+    if (!location.mIsEdit || kind == Kind::Insert) {
+        // The new edit takes over the untouched elements in front of the
+        // element, and a set or a removal of an untouched element consumes it
+        Node pieces[] = { Node { location.mBefore, value, 1, kind }, Node {} };
+        if (location.mNode == kNil) {
+            replace(location.mRank, 0, pieces, pieces + 1);
+            return;
+        }
+        pieces[1] = mNodes[location.mNode];
+        pieces[1].mGap -= location.mBefore + (location.mIsEdit || kind == Kind::Insert ? 0 : 1);
+        replace(location.mRank, 1, pieces, pieces + 2);
+        return;
+    }
+    Node edit = mNodes[location.mNode];
+    if (kind == Kind::Set) {
+        // The counts do not depend on the value
+        mNodes[location.mNode].mValue = value;
+    } else if (edit.mKind == Kind::Insert) {
+        // Removing an element that the batch inserted cancels the insertion
+        erase(location.mRank);
+    } else {
+        edit.mKind = Kind::Remove;
+        replace(location.mRank, 1, &edit, &edit + 1);
+    }
+}
+
+/**
+ * Records an edit of the given kind for the element at location, which
+ * lies inside a fill: the fill is split around it.
+ * This operation provides strong exception safety.
+ */
+template <typename T>
+void LinkedListEditBatch<T>::recordInFill(const Location& location, Kind kind, uint32_t value)
+{
+    Node fill = mNodes[location.mNode];
+    if (kind == Kind::Remove) {
+        if (fill.mCount == 1) {
+            erase(location.mRank);
+        } else {
+            --fill.mCount;
+            replace(location.mRank, 1, &fill, &fill + 1);
+        }
+        return;
+    }
+    // The default values before the element, the new one, and those after it
+    // (the element itself is replaced when setting). The first piece keeps
+    // the gap of the fill.
+    uint32_t after = fill.mCount - location.mOffset - (kind == Kind::Set ? 1 : 0);
+    Node pieces[] = { Node { fill.mGap, 0, location.mOffset, Kind::Fill },
+        Node { location.mOffset == 0 ? fill.mGap : 0, value, 1, Kind::Insert },
+        Node { 0, 0, after, Kind::Fill } };
+    const Node* first = location.mOffset == 0 ? pieces + 1 : pieces;
+    const Node* last = after == 0 ? pieces + 2 : pieces + 3;
+    replace(location.mRank, 1, first, last);
+}
+
+/**
+ * Makes sure that count more nodes can be stored without reallocating.
+ * This operation provides strong exception safety.
+ */
+template <typename T> void LinkedListEditBatch<T>::makeRoom(size_t count)
+{
+    if (mNodes.capacity() - mNodes.size() < count) {
+        mNodes.reserve(std::max(2 * mNodes.capacity(), mNodes.size() + count));
+    }
+}
+
+/**
+ * Drops the node at rank, handing its gap on to the node after it.
+ * The caller must have reserved room for two nodes.
+ * This operation is a no-throw.
+ */
+template <typename T> void LinkedListEditBatch<T>::erase(uint32_t rank) noexcept
+{
+    uint32_t gap = mNodes[nodeAt(rank)].mGap;
+    if (rank + 1 == mNodes[mRoot].mNodes) {
+        // The untouched elements after the last edit need no node
+        replace(rank, 1, nullptr, nullptr);
+        return;
+    }
+    Node next = mNodes[nodeAt(rank + 1)];
+    next.mGap += gap;
+    replace(rank, 2, &next, &next + 1);
+}
+
+/**
+ * Replaces the count nodes starting at rank with copies of the nodes in
+ * [first, last). The caller must have reserved room for them.
+ * This operation is a no-throw.
+ */
+template <typename T>
+void LinkedListEditBatch<T>::replace(
+    uint32_t rank, uint32_t count, const Node* first, const Node* last) noexcept
+{
+    uint32_t left = kNil;
+    uint32_t middle = kNil;
+    uint32_t right = kNil;
+    split(mRoot, rank, left, right);
+    split(right, count, middle, right);
+    // The nodes in middle are left behind in mNodes until clear()
+    for (; first != last; ++first) {
+        uint32_t node = static_cast<uint32_t>(mNodes.size());
+        mNodes.push_back(*first);
+        mSeed ^= mSeed << 13;
+        mSeed ^= mSeed >> 17;
+        mSeed ^= mSeed << 5;
+        mNodes[node].mPriority = mSeed;
+        mNodes[node].mLeft = kNil;
+        mNodes[node].mRight = kNil;
+        update(node);
+        left = merge(left, node);
+    }
+    mRoot = merge(left, right);
+}
+
+/**
+ * Returns the node at rank.
+ * This operation is a no-throw.
+ */
+template <typename T> uint32_t LinkedListEditBatch<T>::nodeAt(uint32_t rank) const noexcept
+{
+    uint32_t node = mRoot;
+    for (;;) {
+        uint32_t before = mNodes[node].mLeft == kNil ? 0 : mNodes[mNodes[node].mLeft].mNodes;
+        if (rank == before) {
+            return node;
+        }
+        if (rank < before) {
+            node = mNodes[node].mLeft;
+        } else {
+            rank -= before + 1;
+            node = mNodes[node].mRight;
+        }
+    }
+}
+
+/**
+ * Splits the treap rooted at root into its first rank nodes and the
+ * rest.
+ * This operation is a no-throw.
+ */
+template <typename T>
+void LinkedListEditBatch<T>::split(
+    uint32_t root, uint32_t rank, uint32_t& left, uint32_t& right) noexcept
+{
+    if (root == kNil) {
+        left = kNil;
+        right = kNil;
+        return;
+    }
+    uint32_t before = mNodes[root].mLeft == kNil ? 0 : mNodes[mNodes[root].mLeft].mNodes;
+    if (rank <= before) {
+        split(mNodes[root].mLeft, rank, left, mNodes[root].mLeft);
+        right = root;
+    } else {
+        split(mNodes[root].mRight, rank - before - 1, mNodes[root].mRight, right);
+        left = root;
+    }
+    update(root);
+}
+
+/**
+ * Joins two treaps, every node of left preceding every node of right,
+ * and returns the root.
+ * This operation is a no-throw.
+ */
+template <typename T> uint32_t LinkedListEditBatch<T>::merge(uint32_t left, uint32_t right) noexcept
+{
+    if (left == kNil) {
+        return right;
+    }
+    if (right == kNil) {
+        return left;
+    }
+    if (mNodes[left].mPriority > mNodes[right].mPriority) {
+        uint32_t joined = merge(mNodes[left].mRight, right);
+        mNodes[left].mRight = joined;
+        update(left);
+        return left;
+    }
+    uint32_t joined = merge(left, mNodes[right].mLeft);
+    mNodes[right].mLeft = joined;
+    update(right);
+    return right;
+}
+
+/**
+ * Recomputes the counts of node from its own edit and its children.
+ * This operation is a no-throw.
+ */
+template <typename T> void LinkedListEditBatch<T>::update(uint32_t node) noexcept
+{
+    Node& edit = mNodes[node];
+    edit.mNodes = 1;
+    edit.mLength = edit.mGap + (edit.mKind == Kind::Remove ? 0 : edit.mCount);
+    edit.mOrigins = edit.mGap + (edit.mKind == Kind::Set || edit.mKind == Kind::Remove ? 1 : 0);
+    for (uint32_t child : { edit.mLeft, edit.mRight }) {
+        if (child != kNil) {
+            edit.mNodes += mNodes[child].mNodes;
+            edit.mLength += mNodes[child].mLength;
+            edit.mOrigins += mNodes[child].mOrigins;
+        }
+    }
+}
+
+/**
+ * Returns the nodes of the treap in list order as normalized edits.
+ * This operation provides strong exception safety.
+ */
+template <typename T>
+std::vector<typename LinkedListEditBatch<T>::Edit> LinkedListEditBatch<T>::edits() const
+{
+    std::vector<Edit> edits;
+    std::vector<uint32_t> path;
+    edits.reserve(mRoot == kNil ? 0 : mNodes[mRoot].mNodes);
+    uint32_t origin = 0;
+    uint32_t node = mRoot;
+    while (node != kNil || !path.empty()) {
+        for (; node != kNil; node = mNodes[node].mLeft) {
+            path.push_back(node);
+        }
+        const Node& edit = mNodes[path.back()];
+        path.pop_back();
+        origin += edit.mGap;
+        edits.push_back(Edit { origin, edit.mValue, edit.mCount, edit.mKind });
+        if (edit.mKind == Kind::Set || edit.mKind == Kind::Remove) {
+            ++origin;
+        }
+        node = edit.mRight;
+    }
+    return edits;
+}
+
+/**
+ * Appends value to the value store and returns its index.
+ * This operation provides strong exception safety.
+ */
+template <typename T> uint32_t LinkedListEditBatch<T>::store(const T& value)
+{
+    mValues.push_back(value);
+    return static_cast<uint32_t>(mValues.size() - 1);
+}
+
+/**
+ * Given an index, this method throws an std::out_of_range with the index as
+ * its message if index is out of bounds or is a no-op otherwise.
+ * This operation provides strong exception safety.
+ *
+ * @param index index to check
+ */
+template <typename T> void LinkedListEditBatch<T>::rangeCheck(uint32_t index) const
+{
+    if (index >= mResultSize) {
+        throw std::out_of_range(std::to_string(index));
+    }
+}
+#endif
@@ -19,34 +19,36 @@ bool LinkedListIterator<T>::operator!=(const LinkedListIterator<T>& rhs) const n
     return mPtr != rhs.mPtr;
 }
 
+// A mutable iterator always points at the first element of its node's run, so
+// materializing that element keeps mPtr in place.
 template <typename T> T& LinkedListIterator<T>::operator*() const
 {
-    return mPtr->mItem;
+    return LinkedListNode<T>::isolate(mPtr, 0)->mItem;
 }
 template <typename T> T* LinkedListIterator<T>::operator->() const
 {
-    return &mPtr->mItem;
+    return &LinkedListNode<T>::isolate(mPtr, 0)->mItem;
 }
 template <typename T> LinkedListIterator<T>& LinkedListIterator<T>::operator++()
 {
-    mPtr = mPtr->mNext;
+    mPtr = LinkedListNode<T>::isolate(mPtr, 0)->next();
     return *this;
 }
 template <typename T> const LinkedListIterator<T> LinkedListIterator<T>::operator++(int)
 {
     LinkedListIterator<T> temp(mPtr);
-    mPtr = mPtr->mNext;
+    ++*this;
     return temp;
 }
 template <typename T> LinkedListIterator<T>& LinkedListIterator<T>::operator--()
 {
-    mPtr = mPtr->mPrev;
+    mPtr = LinkedListNode<T>::isolate(mPtr->prev(), mPtr->mPrev->mCount - 1);
     return *this;
 }
 template <typename T> const LinkedListIterator<T> LinkedListIterator<T>::operator--(int)
 {
     LinkedListIterator<T> temp(mPtr);
-    mPtr = mPtr->mPrev;
+    --*this;
     return temp;
 }
 template <typename T>
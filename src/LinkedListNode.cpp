@@ -6,6 +6,7 @@
 // nor received any unauthorized aid on this assignment
 #ifndef LINKED_LIST_NODE_CPP
 #define LINKED_LIST_NODE_CPP
+#include <memory>
 
 /**
  * Initializes this node to store the provided item. The next and previous
@@ -16,9 +17,8 @@
  */
 template <typename T>
 LinkedListNode<T>::LinkedListNode(const T& item)
-    : mItem(item)
-    , mPrev(this)
-    , mNext(this)
+    : LinkedListNodeBase()
+    , mItem(item)
 {
 }
 
@@ -28,7 +28,7 @@ LinkedListNode<T>::LinkedListNode(const T& item)
  */
 template <typename T> LinkedListNode<T>::~LinkedListNode() noexcept
 {
-    link(mPrev, mNext);
+    // ~LinkedListNodeBase does the unlinking
 }
 
 /**
@@ -44,26 +44,99 @@ template <typename T> LinkedListNode<T>::~LinkedListNode() noexcept
  */
 template <typename T>
 LinkedListNode<T>::LinkedListNode(const T& item, LinkedListNode<T>* prev, LinkedListNode<T>* next)
-    : mItem(item)
-    , mPrev(prev)
-    , mNext(next)
+    : LinkedListNodeBase()
+    , mItem(item)
 {
+    // Linked only once the item is copied, so a throwing copy leaves prev
+    // and next untouched
     link(prev, this);
     link(this, next);
 }
 
 /**
- * Establishes the proper linkage between the provided nodes.  First and
- * second should never be nullptr, so don't bother checking for that.
+ * Returns the previous node.
+ * This operation is a no-throw.
+ *
+ * @return previous node
+ */
+template <typename T> LinkedListNode<T>* LinkedListNode<T>::prev() const noexcept
+{
+    return static_cast<LinkedListNode<T>*>(mPrev);
+}
+
+/**
+ * Returns the next node.
+ * This operation is a no-throw.
+ *
+ * @return next node
+ */
+template <typename T> LinkedListNode<T>* LinkedListNode<T>::next() const noexcept
+{
+    return static_cast<LinkedListNode<T>*>(mNext);
+}
+
+/**
+ * Deletes first and every node reachable from it through mNext, up to (but
+ * not including) nullptr. The chain must already be detached from any
+ * list; the neighbors of the deleted nodes are not relinked, so each node
+ * is touched exactly once.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ *
+ * @param first first node of a nullptr-terminated chain (may be nullptr)
+ */
+template <typename T> void LinkedListNode<T>::destroyChain(LinkedListNode<T>* first) noexcept
+{
+    while (first != nullptr) {
+        LinkedListNode<T>* next = first->next();
+        // Point the node at itself so that the destructor's unlink stays local
+        first->mPrev = first;
+        first->mNext = first;
+        delete first;
+        first = next;
+    }
+}
+
+/**
+ * Makes the element at offset within the run represented by node a node
+ * of its own and returns that node. node keeps representing the first
+ * element(s) of the run; the element at offset and the elements after it
+ * move to new nodes linked right after node. A node that represents a
+ * single element is returned as is. Either all new nodes are created and
+ * linked or, if creating one throws, the chain is left unchanged.
+ * This operation provides strong exception safety.
  *
- * @param   first node to link as preceding node
- * @param   second node to link as succeeding node
- * @post    first and second are linked in that order
+ * @param node node whose run contains the element
+ * @param offset position of the element within the run (< node->mCount)
+ * @return node holding exactly the element at offset
  */
 template <typename T>
-void LinkedListNode<T>::link(LinkedListNode<T>* first, LinkedListNode<T>* second) noexcept
+LinkedListNode<T>* LinkedListNode<T>::isolate(LinkedListNode<T>* node, uint32_t offset)
 {
-    first->mNext = second;
-    second->mPrev = first;
+    if (node->mCount == 1) {
+        return node;
+    }
+    uint32_t after = node->mCount - offset - 1;
+    // At offset 0 the node itself becomes the element and only the rest of
+    // the run needs a new node.
+    std::unique_ptr<LinkedListNode<T>> element;
+    if (offset != 0) {
+        element = std::make_unique<LinkedListNode<T>>(node->mItem);
+    }
+    std::unique_ptr<LinkedListNode<T>> rest;
+    if (after != 0) {
+        rest = std::make_unique<LinkedListNode<T>>(node->mItem);
+        rest->mCount = after;
+        link(rest.get(), node->mNext);
+        link(node, rest.release());
+    }
+    if (offset == 0) {
+        node->mCount = 1;
+        return node;
+    }
+    node->mCount = offset;
+    link(element.get(), node->mNext);
+    link(node, element.get());
+    return element.release();
 }
 #endif
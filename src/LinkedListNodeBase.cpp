@@ -0,0 +1,146 @@
+// LinkedListNodeBase.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "LinkedListNodeBase.h"
+
+/**
+ * Links the detached node in front of next.
+ * This operation is a no-throw.
+ *
+ * @param node node to insert
+ * @param next node of a list
+ */
+void LinkedListNodeBase::insertBefore(LinkedListNodeBase* node, LinkedListNodeBase* next) noexcept
+{
+    link(next->mPrev, node);
+    link(node, next);
+}
+
+/**
+ * Links the detached chain first..last in front of next.
+ * This operation is a no-throw.
+ *
+ * @param first first node of the chain
+ * @param last last node of the chain (its mNext is ignored)
+ * @param next node of a list
+ */
+void LinkedListNodeBase::insertChain(
+    LinkedListNodeBase* first, LinkedListNodeBase* last, LinkedListNodeBase* next) noexcept
+{
+    link(next->mPrev, first);
+    link(last, next);
+}
+
+/**
+ * Returns the node whose run contains the element at index of the list
+ * with dummy node dummy, and stores the position of that element within
+ * the run in offset.
+ * This operation is a no-throw.
+ *
+ * @pre index is less than the size of the list
+ * @param dummy dummy node of the list
+ * @param index index of the element
+ * @param offset receives the offset of the element within the node's run
+ * @return node containing the element
+ */
+LinkedListNodeBase* LinkedListNodeBase::seek(
+    const LinkedListNodeBase* dummy, uint32_t index, uint32_t& offset) noexcept
+{
+    LinkedListNodeBase* node = dummy->mNext;
+    while (index >= node->mCount) {
+        index -= node->mCount;
+        node = node->mNext;
+    }
+    offset = index;
+    return node;
+}
+
+/**
+ * Cuts node and every node after it, up to dummy, out of the list and
+ * returns them as a nullptr-terminated chain, or returns nullptr if node
+ * is dummy.
+ * This operation is a no-throw.
+ *
+ * @param node first node to detach (may be dummy)
+ * @param dummy dummy node of the list
+ * @return first node of the detached chain, or nullptr
+ */
+LinkedListNodeBase* LinkedListNodeBase::detachFrom(
+    LinkedListNodeBase* node, LinkedListNodeBase* dummy) noexcept
+{
+    if (node == dummy) {
+        return nullptr;
+    }
+    dummy->mPrev->mNext = nullptr;
+    link(node->mPrev, dummy);
+    return node;
+}
+
+/**
+ * Moves every node of the list with dummy node from in front of
+ * position, leaving that list empty.
+ * This operation is a no-throw.
+ *
+ * @param position node of another list
+ * @param from dummy node of the list whose nodes move
+ */
+void LinkedListNodeBase::spliceAll(LinkedListNodeBase* position, LinkedListNodeBase* from) noexcept
+{
+    if (from->mNext == from) {
+        return;
+    }
+    LinkedListNodeBase* first = from->mNext;
+    LinkedListNodeBase* last = from->mPrev;
+    link(from, from);
+    insertChain(first, last, position);
+}
+
+/**
+ * Unlinks node from its list and links it in front of next, which may
+ * belong to another list. Relinking the dummy node of a list rotates
+ * that list.
+ * This operation is a no-throw.
+ *
+ * @pre node is not next
+ * @param node node to move
+ * @param next node to move it in front of
+ */
+void LinkedListNodeBase::relink(LinkedListNodeBase* node, LinkedListNodeBase* next) noexcept
+{
+    link(node->mPrev, node->mNext);
+    insertBefore(node, next);
+}
+
+/**
+ * Moves node right after dummy.
+ * This operation is a no-throw.
+ *
+ * @pre node is neither dummy nor its successor
+ * @param node node to move
+ * @param dummy dummy node of the list
+ */
+void LinkedListNodeBase::moveToFront(LinkedListNodeBase* node, LinkedListNodeBase* dummy) noexcept
+{
+    link(node->mPrev, node->mNext);
+    link(node, dummy->mNext);
+    link(dummy, node);
+}
+
+/**
+ * Swaps node with its predecessor.
+ * This operation is a no-throw.
+ *
+ * @pre neither node nor its predecessor is the dummy node
+ * @param node node to move one step toward the front
+ */
+void LinkedListNodeBase::transpose(LinkedListNodeBase* node) noexcept
+{
+    LinkedListNodeBase* prev = node->mPrev;
+    LinkedListNodeBase* next = node->mNext;
+    link(prev->mPrev, node);
+    link(node, prev);
+    link(prev, next);
+}
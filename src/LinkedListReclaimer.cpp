@@ -0,0 +1,105 @@
+// LinkedListReclaimer.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "LinkedListReclaimer.h"
+
+/**
+ * Starts the background thread.
+ * This operation provides strong exception safety.
+ */
+LinkedListReclaimer::LinkedListReclaimer()
+    : mRetired(0)
+    , mReclaimed(0)
+    , mStopping(false)
+    , mThread()
+{
+    // Started last so that the thread only ever sees initialized members
+    mThread = std::thread(&LinkedListReclaimer::run, this);
+}
+
+/**
+ * Destructor. Frees all pending chains and joins the background thread.
+ * This operation is a no-throw.
+ */
+LinkedListReclaimer::~LinkedListReclaimer() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mWork.notify_one();
+    mThread.join();
+}
+
+/**
+ * Queues chain to be freed by reclaim on the background thread. If the
+ * request cannot be queued, the chain is freed on the calling thread
+ * instead.
+ * This operation is a no-throw.
+ *
+ * @param chain opaque pointer to the detached chain
+ * @param reclaim function that frees chain
+ */
+void LinkedListReclaimer::retire(void* chain, Reclaim reclaim) noexcept
+{
+    try {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mQueue.push_back(Retired { chain, reclaim });
+        ++mRetired;
+    } catch (...) {
+        reclaim(chain);
+        return;
+    }
+    mWork.notify_one();
+}
+
+/**
+ * Blocks until every chain retired before this call has been freed.
+ * This operation provides strong exception safety.
+ */
+void LinkedListReclaimer::flush()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    uint64_t target = mRetired;
+    mIdle.wait(lock, [this, target]() { return mReclaimed >= target; });
+}
+
+/**
+ * Returns the number of chains freed on the background thread so far.
+ * This operation is a no-throw.
+ *
+ * @return number of reclaimed chains
+ */
+uint64_t LinkedListReclaimer::reclaimed() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mReclaimed;
+}
+
+/**
+ * Body of the background thread.
+ * This operation is a no-throw.
+ */
+void LinkedListReclaimer::run() noexcept
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true) {
+        mWork.wait(lock, [this]() { return mStopping || !mQueue.empty(); });
+        if (mQueue.empty()) {
+            // Only reached when stopping with nothing left to free
+            return;
+        }
+        Retired retired = mQueue.front();
+        mQueue.pop_front();
+        // Free the chain without holding the lock so that retire() never
+        // waits behind a long teardown.
+        lock.unlock();
+        retired.mReclaim(retired.mChain);
+        lock.lock();
+        ++mReclaimed;
+        mIdle.notify_all();
+    }
+}
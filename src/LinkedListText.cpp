@@ -0,0 +1,222 @@
+// LinkedListText.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef LINKED_LIST_TEXT_CPP
+#define LINKED_LIST_TEXT_CPP
+#include <LinkedListText.h>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <unistd.h>
+
+template <typename T>
+char* TextCodec<T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>::format(
+    char* first, char* last, const T& value) noexcept
+{
+    std::to_chars_result result = std::to_chars(first, last, value);
+    return result.ec == std::errc() ? result.ptr : nullptr;
+}
+
+template <typename T>
+const char*
+TextCodec<T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>::parse(
+    const char* first, const char* last, T& value) noexcept
+{
+    std::from_chars_result result = std::from_chars(first, last, value);
+    return result.ec == std::errc() ? result.ptr : nullptr;
+}
+
+/**
+ * Returns true iff c separates elements in text.
+ * This operation is a no-throw.
+ */
+inline bool isTextSpace(char c) noexcept
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+ * Formats the elements of list, each followed by separator, into a buffer
+ * of kTextChunk bytes and hands every full buffer, and the last partial
+ * one, to flush(data, size).
+ * This operation provides basic exception safety.
+ */
+template <typename T, typename Allocator, typename Flush>
+void formatText(const LinkedList<T, Allocator>& list, char separator, Flush flush)
+{
+    std::unique_ptr<char[]> buffer(new char[kTextChunk]);
+    char* const first = buffer.get();
+    // One byte is kept back for the separator
+    char* const last = first + kTextChunk - 1;
+    char* cursor = first;
+    for (typename LinkedList<T, Allocator>::const_iterator iter = list.untracedBegin();
+         iter != list.end(); ++iter) {
+        const T& value = *iter;
+        char* end = TextCodec<T>::format(cursor, last, value);
+        if (end == nullptr) {
+            flush(first, static_cast<size_t>(cursor - first));
+            cursor = first;
+            end = TextCodec<T>::format(cursor, last, value);
+            if (end == nullptr) {
+                throw std::length_error("element text exceeds kTextChunk");
+            }
+        }
+        *end = separator;
+        cursor = end + 1;
+    }
+    if (cursor != first) {
+        flush(first, static_cast<size_t>(cursor - first));
+    }
+}
+
+/**
+ * Parses the whitespace-separated elements in [first, last) and appends
+ * them to into. Unless final is set, an element that runs up to last may
+ * continue in the next chunk, so it is left unparsed. Returns where the
+ * unparsed text starts. Malformed text throws an std::invalid_argument
+ * exception with its offset (offset being that of first) as its message.
+ * This operation provides basic exception safety.
+ */
+template <typename T, typename Allocator>
+const char* parseText(LinkedList<T, Allocator>& into, const char* first, const char* last,
+    bool final, uint64_t offset)
+{
+    const char* cursor = first;
+    while (true) {
+        while (cursor != last && isTextSpace(*cursor)) {
+            ++cursor;
+        }
+        const char* end = cursor;
+        while (end != last && !isTextSpace(*end)) {
+            ++end;
+        }
+        if (cursor == last || (end == last && !final)) {
+            return cursor;
+        }
+        T value {};
+        if (TextCodec<T>::parse(cursor, end, value) != end) {
+            throw std::invalid_argument(std::to_string(offset + (cursor - first)));
+        }
+        into.add(value);
+        cursor = end;
+    }
+}
+
+/**
+ * Writes the elements of list to the file descriptor fd as text, each
+ * followed by separator (which must be whitespace). The text is built in
+ * a reusable buffer of kTextChunk bytes that is written with one write()
+ * call whenever it fills up, instead of element by element through a
+ * stream. If writing fails, an std::system_error is thrown; if the text of
+ * one element does not fit in the buffer, an std::length_error is thrown.
+ * This operation provides basic exception safety: list is not modified,
+ * but part of the text may have been written.
+ *
+ * @param list list to write
+ * @param fd file descriptor open for writing
+ * @param separator character written after every element
+ */
+template <typename T, typename Allocator>
+void toText(const LinkedList<T, Allocator>& list, int fd, char separator)
+{
+    formatText(list, separator, [fd](const char* data, size_t size) {
+        while (size != 0) {
+            ssize_t written = write(fd, data, size);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(), "text file");
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+    });
+}
+
+/**
+ * Returns the elements of list as text, in the format written by
+ * toText(list, fd, separator).
+ * This operation provides strong exception safety.
+ *
+ * @param list list to format
+ * @param separator character written after every element
+ * @return text of the elements
+ */
+template <typename T, typename Allocator>
+std::string toText(const LinkedList<T, Allocator>& list, char separator)
+{
+    std::string text;
+    formatText(
+        list, separator, [&text](const char* data, size_t size) { text.append(data, size); });
+    return text;
+}
+
+/**
+ * Reads whitespace-separated elements from the file descriptor fd until
+ * its end and appends them to list. The file is read in chunks of
+ * kTextChunk bytes with one read() call each and parsed in place. If
+ * reading fails, an std::system_error is thrown; if the text holds
+ * something that is not an element, or an element longer than a chunk,
+ * an std::invalid_argument exception is thrown with the offset of that
+ * text in the file as its message.
+ * This operation provides strong exception safety for list.
+ *
+ * @param list list to append to
+ * @param fd file descriptor open for reading
+ */
+template <typename T, typename Allocator> void fromText(LinkedList<T, Allocator>& list, int fd)
+{
+    // Parse into a list of our own and splice it in once the whole file is read
+    LinkedList<T, Allocator> parsed(list.getAllocator());
+    std::unique_ptr<char[]> buffer(new char[kTextChunk]);
+    char* const first = buffer.get();
+    size_t held = 0;
+    uint64_t offset = 0;
+    while (true) {
+        ssize_t got = read(fd, first + held, kTextChunk - held);
+        if (got < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(), "text file");
+        }
+        held += static_cast<size_t>(got);
+        const char* rest = parseText(parsed, first, first + held, got == 0, offset);
+        if (got == 0) {
+            break;
+        }
+        size_t consumed = static_cast<size_t>(rest - first);
+        if (consumed == 0 && held == kTextChunk) {
+            throw std::invalid_argument(std::to_string(offset));
+        }
+        // Carry a partial element over to the start of the buffer
+        std::memmove(first, rest, held - consumed);
+        held -= consumed;
+        offset += consumed;
+    }
+    list.splice(list.end(), parsed);
+}
+
+/**
+ * Parses the whitespace-separated elements in text and appends them to
+ * list, throwing like fromText(list, fd) on malformed text.
+ * This operation provides strong exception safety.
+ *
+ * @param list list to append to
+ * @param text text to parse
+ */
+template <typename T, typename Allocator>
+void fromText(LinkedList<T, Allocator>& list, std::string_view text)
+{
+    LinkedList<T, Allocator> parsed(list.getAllocator());
+    parseText(parsed, text.data(), text.data() + text.size(), true, 0);
+    list.splice(list.end(), parsed);
+}
+
+#endif
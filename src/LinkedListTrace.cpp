@@ -0,0 +1,239 @@
+// LinkedListTrace.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "LinkedListTrace.h"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+namespace {
+
+const char kMagic[8] = { 'L', 'L', 'T', 'R', 'A', 'C', 'E', '1' };
+
+// Events are written once this many bytes are buffered
+const size_t kBlockSize = 64 * 1024;
+
+// Longest encoding of an event: the kind and four varints of 10 bytes
+const size_t kMaxEventSize = 41;
+
+/**
+ * Returns true iff events of kind op carry a count.
+ */
+bool hasCount(TraceOp op)
+{
+    return op == TraceOp::SpliceIn || op == TraceOp::SpliceOut || op == TraceOp::Move
+        || op == TraceOp::Apply;
+}
+}
+
+/**
+ * Creates (or truncates) the trace file at path. If it cannot be
+ * created, an std::system_error is thrown.
+ * This operation provides strong exception safety.
+ *
+ * @param path file to write
+ */
+LinkedListTraceRecorder::LinkedListTraceRecorder(const std::string& path)
+    : mFile(nullptr)
+    , mBuffer()
+    , mLast(std::chrono::steady_clock::now())
+    , mRecorded(0)
+    , mError(0)
+{
+    mBuffer.reserve(kBlockSize + kMaxEventSize);
+    mFile = std::fopen(path.c_str(), "wb");
+    if (mFile == nullptr) {
+        throw std::system_error(errno, std::generic_category(), path);
+    }
+    mBuffer.insert(mBuffer.end(), kMagic, kMagic + sizeof(kMagic));
+}
+
+/**
+ * Destructor. Writes the buffered events and closes the file; errors
+ * are ignored (call flush() first to see them).
+ * This operation is a no-throw.
+ */
+LinkedListTraceRecorder::~LinkedListTraceRecorder() noexcept
+{
+    drain();
+    std::fclose(mFile);
+}
+
+/**
+ * Appends an event stamped with the current time.
+ * This operation is a no-throw.
+ *
+ * @param op kind of operation
+ * @param index index of the operation (see TraceEvent)
+ * @param size size of the list before the operation
+ * @param count count of the operation (see TraceEvent)
+ */
+void LinkedListTraceRecorder::record(
+    TraceOp op, uint32_t index, uint32_t size, uint32_t count) noexcept
+{
+    if (mError != 0) {
+        return;
+    }
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    // The buffer was reserved with room for one event past a block, so
+    // these push_backs never reallocate
+    mBuffer.push_back(static_cast<unsigned char>(op));
+    put(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - mLast).count()));
+    put(index);
+    put(size);
+    if (hasCount(op)) {
+        put(count);
+    }
+    mLast = now;
+    ++mRecorded;
+    if (mBuffer.size() >= kBlockSize) {
+        drain();
+    }
+}
+
+/**
+ * Writes the buffered events to the file. If this or an earlier write
+ * failed, an std::system_error is thrown.
+ * This operation provides strong exception safety.
+ */
+void LinkedListTraceRecorder::flush()
+{
+    drain();
+    if (mError == 0 && std::fflush(mFile) != 0) {
+        mError = errno != 0 ? errno : EIO;
+    }
+    if (mError != 0) {
+        throw std::system_error(mError, std::generic_category(), "trace file");
+    }
+}
+
+/**
+ * Returns the number of events recorded so far.
+ * This operation is a no-throw.
+ *
+ * @return number of events
+ */
+uint64_t LinkedListTraceRecorder::recorded() const noexcept
+{
+    return mRecorded;
+}
+
+/**
+ * Appends value to the buffer as an unsigned LEB128 varint.
+ * This operation is a no-throw.
+ */
+void LinkedListTraceRecorder::put(uint64_t value) noexcept
+{
+    while (value >= 0x80) {
+        mBuffer.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    mBuffer.push_back(static_cast<unsigned char>(value));
+}
+
+/**
+ * Writes the buffer to the file and empties it, remembering the error
+ * if the write fails.
+ * This operation is a no-throw.
+ */
+void LinkedListTraceRecorder::drain() noexcept
+{
+    if (mError == 0 && !mBuffer.empty()
+        && std::fwrite(mBuffer.data(), 1, mBuffer.size(), mFile) != mBuffer.size()) {
+        mError = errno != 0 ? errno : EIO;
+    }
+    mBuffer.clear();
+}
+
+/**
+ * Opens the trace file at path. If it cannot be opened, an
+ * std::system_error is thrown; if it is not a trace, an
+ * std::invalid_argument exception is thrown with path as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param path file to read
+ */
+LinkedListTraceReader::LinkedListTraceReader(const std::string& path)
+    : mFile(std::fopen(path.c_str(), "rb"))
+    , mPath(path)
+    , mTime(0)
+{
+    if (mFile == nullptr) {
+        throw std::system_error(errno, std::generic_category(), path);
+    }
+    char magic[sizeof(kMagic)];
+    if (std::fread(magic, 1, sizeof(magic), mFile) != sizeof(magic)
+        || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+        std::fclose(mFile);
+        throw std::invalid_argument(path);
+    }
+}
+
+/**
+ * Destructor. Closes the file.
+ * This operation is a no-throw.
+ */
+LinkedListTraceReader::~LinkedListTraceReader() noexcept
+{
+    std::fclose(mFile);
+}
+
+/**
+ * Reads the next event into event, with mTime made absolute (since the
+ * recorder was created). Returns false at the end of the trace. If the
+ * trace ends in the middle of an event or holds an unknown kind, an
+ * std::invalid_argument exception is thrown with the path as its
+ * message.
+ * This operation provides basic exception safety.
+ *
+ * @param event receives the event
+ * @return true iff an event was read
+ */
+bool LinkedListTraceReader::next(TraceEvent& event)
+{
+    int op = std::fgetc(mFile);
+    if (op == EOF) {
+        return false;
+    }
+    if (op > static_cast<int>(TraceOp::Apply)) {
+        throw std::invalid_argument(mPath);
+    }
+    mTime += get();
+    uint64_t index = get();
+    uint64_t size = get();
+    uint64_t count = hasCount(static_cast<TraceOp>(op)) ? get() : 0;
+    if (index > UINT32_MAX || size > UINT32_MAX || count > UINT32_MAX) {
+        throw std::invalid_argument(mPath);
+    }
+    event.mTime = mTime;
+    event.mIndex = static_cast<uint32_t>(index);
+    event.mSize = static_cast<uint32_t>(size);
+    event.mCount = static_cast<uint32_t>(count);
+    event.mOp = static_cast<TraceOp>(op);
+    return true;
+}
+
+/**
+ * Reads an unsigned LEB128 varint, throwing like next() on a truncated
+ * or overlong one.
+ */
+uint64_t LinkedListTraceReader::get()
+{
+    uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        int byte = std::fgetc(mFile);
+        if (byte == EOF) {
+            break;
+        }
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw std::invalid_argument(mPath);
+}
@@ -0,0 +1,250 @@
+// LinkedListView.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef LINKED_LIST_VIEW_CPP
+#define LINKED_LIST_VIEW_CPP
+#include <LinkedListView.h>
+
+template <typename F>
+ViewFunction<F>::ViewFunction(const F& function)
+    : mFunction(function)
+{
+}
+
+template <typename F> ViewFunction<F>& ViewFunction<F>::operator=(const ViewFunction<F>& rhs)
+{
+    if (this != &rhs) {
+        // Copy first: if that throws, the held function is left alone
+        F copy(*rhs.mFunction);
+        mFunction.reset();
+        mFunction.emplace(std::move(copy));
+    }
+    return *this;
+}
+
+template <typename F>
+template <typename... Args>
+decltype(auto) ViewFunction<F>::operator()(Args&&... args) const
+{
+    return (*mFunction)(std::forward<Args>(args)...);
+}
+
+template <typename Iterator, typename F>
+TransformIterator<Iterator, F>::TransformIterator(Iterator current, const F& function)
+    : mCurrent(current)
+    , mFunction(function)
+{
+}
+
+template <typename Iterator, typename F>
+bool TransformIterator<Iterator, F>::operator==(const TransformIterator<Iterator, F>& rhs) const
+{
+    return mCurrent == rhs.mCurrent;
+}
+
+template <typename Iterator, typename F>
+bool TransformIterator<Iterator, F>::operator!=(const TransformIterator<Iterator, F>& rhs) const
+{
+    return mCurrent != rhs.mCurrent;
+}
+
+template <typename Iterator, typename F>
+typename TransformIterator<Iterator, F>::reference TransformIterator<Iterator, F>::operator*()
+    const
+{
+    return mFunction(*mCurrent);
+}
+
+template <typename Iterator, typename F>
+TransformIterator<Iterator, F>& TransformIterator<Iterator, F>::operator++()
+{
+    ++mCurrent;
+    return *this;
+}
+
+template <typename Iterator, typename F>
+TransformIterator<Iterator, F> TransformIterator<Iterator, F>::operator++(int)
+{
+    TransformIterator<Iterator, F> temp(*this);
+    ++mCurrent;
+    return temp;
+}
+
+template <typename Iterator, typename F>
+TransformIterator<Iterator, F>& TransformIterator<Iterator, F>::operator--()
+{
+    --mCurrent;
+    return *this;
+}
+
+template <typename Iterator, typename F>
+TransformIterator<Iterator, F> TransformIterator<Iterator, F>::operator--(int)
+{
+    TransformIterator<Iterator, F> temp(*this);
+    --mCurrent;
+    return temp;
+}
+
+template <typename Iterator, typename Predicate>
+FilterIterator<Iterator, Predicate>::FilterIterator(
+    Iterator current, Iterator last, const Predicate& pred)
+    : mCurrent(current)
+    , mLast(last)
+    , mPred(pred)
+{
+    satisfy();
+}
+
+template <typename Iterator, typename Predicate>
+bool FilterIterator<Iterator, Predicate>::operator==(
+    const FilterIterator<Iterator, Predicate>& rhs) const
+{
+    return mCurrent == rhs.mCurrent;
+}
+
+template <typename Iterator, typename Predicate>
+bool FilterIterator<Iterator, Predicate>::operator!=(
+    const FilterIterator<Iterator, Predicate>& rhs) const
+{
+    return mCurrent != rhs.mCurrent;
+}
+
+template <typename Iterator, typename Predicate>
+typename FilterIterator<Iterator, Predicate>::reference FilterIterator<Iterator,
+    Predicate>::operator*() const
+{
+    return *mCurrent;
+}
+
+template <typename Iterator, typename Predicate>
+FilterIterator<Iterator, Predicate>& FilterIterator<Iterator, Predicate>::operator++()
+{
+    ++mCurrent;
+    satisfy();
+    return *this;
+}
+
+template <typename Iterator, typename Predicate>
+FilterIterator<Iterator, Predicate> FilterIterator<Iterator, Predicate>::operator++(int)
+{
+    FilterIterator<Iterator, Predicate> temp(*this);
+    ++*this;
+    return temp;
+}
+
+/**
+ * Moves mCurrent to the first element from mCurrent on that satisfies
+ * the predicate, or to mLast.
+ */
+template <typename Iterator, typename Predicate>
+void FilterIterator<Iterator, Predicate>::satisfy()
+{
+    while (mCurrent != mLast && !mPred(*mCurrent)) {
+        ++mCurrent;
+    }
+}
+
+/**
+ * Initializes a view of the elements in [first, last).
+ * This operation provides strong exception safety.
+ *
+ * @param first iterator to the first element
+ * @param last iterator past the last element
+ */
+template <typename Iterator>
+LinkedListView<Iterator>::LinkedListView(Iterator first, Iterator last)
+    : mFirst(first)
+    , mLast(last)
+{
+}
+
+/**
+ * Returns an iterator to the first element of this view.
+ * This operation provides strong exception safety.
+ *
+ * @return iterator to the first element
+ */
+template <typename Iterator> Iterator LinkedListView<Iterator>::begin() const
+{
+    return mFirst;
+}
+
+/**
+ * Returns an iterator past the last element of this view.
+ * This operation provides strong exception safety.
+ *
+ * @return iterator past the last element
+ */
+template <typename Iterator> Iterator LinkedListView<Iterator>::end() const
+{
+    return mLast;
+}
+
+/**
+ * Returns true if this view has no elements and false otherwise.
+ * This operation provides strong exception safety.
+ *
+ * @return bool True when empty
+ */
+template <typename Iterator> bool LinkedListView<Iterator>::isEmpty() const
+{
+    return mFirst == mLast;
+}
+
+/**
+ * Returns a view of the results of calling function on each element of
+ * this view. function is called every time an element is dereferenced,
+ * not when the view is created.
+ * This operation provides strong exception safety.
+ *
+ * @param function callable taking this view's reference type
+ * @return transformed view
+ */
+template <typename Iterator>
+template <typename F>
+LinkedListView<TransformIterator<Iterator, F>> LinkedListView<Iterator>::transformed(
+    F function) const
+{
+    return LinkedListView<TransformIterator<Iterator, F>>(
+        TransformIterator<Iterator, F>(mFirst, function),
+        TransformIterator<Iterator, F>(mLast, function));
+}
+
+/**
+ * Returns a view of the elements of this view that satisfy pred, in
+ * order. The view's begin() is found when the view is created, so this
+ * evaluates pred on the elements up to the first that satisfies it; all
+ * other elements are tested while the view is iterated.
+ * This operation provides strong exception safety.
+ *
+ * @param pred predicate taking this view's reference type
+ * @return filtered view
+ */
+template <typename Iterator>
+template <typename Predicate>
+LinkedListView<FilterIterator<Iterator, Predicate>> LinkedListView<Iterator>::filtered(
+    Predicate pred) const
+{
+    return LinkedListView<FilterIterator<Iterator, Predicate>>(
+        FilterIterator<Iterator, Predicate>(mFirst, mLast, pred),
+        FilterIterator<Iterator, Predicate>(mLast, mLast, pred));
+}
+
+/**
+ * Returns a view of the elements in [first, last), typically of a
+ * LinkedList, without copying them.
+ * This operation provides strong exception safety.
+ *
+ * @param first iterator to the first element
+ * @param last iterator past the last element
+ * @return view of the range
+ */
+template <typename Iterator> LinkedListView<Iterator> sublist(Iterator first, Iterator last)
+{
+    return LinkedListView<Iterator>(first, last);
+}
+
+#endif
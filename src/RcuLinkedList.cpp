@@ -0,0 +1,449 @@
+// RcuLinkedList.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef RCU_LINKED_LIST_CPP
+#define RCU_LINKED_LIST_CPP
+#include <RcuLinkedList.h>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+/**
+ * Initializes an empty RcuLinkedList that supports up to readerSlots
+ * simultaneously open read guards. Opening more guards waits for one to
+ * be closed.
+ * This operation provides strong exception safety.
+ *
+ * @param readerSlots maximum number of simultaneously open guards
+ */
+template <typename T>
+RcuLinkedList<T>::RcuLinkedList(uint32_t readerSlots)
+    : mHead(nullptr)
+    , mTailLink(&mHead)
+    , mSize(0)
+    , mEpoch(1)
+    , mSlotCount(readerSlots == 0 ? 1 : readerSlots)
+    , mSlots(new Slot[mSlotCount])
+    , mRetired()
+{
+    for (uint32_t i = 0; i < mSlotCount; ++i) {
+        mSlots[i].mEpoch.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Destructor. Releases all resources held by this RcuLinkedList,
+ * including retired nodes that have not been reclaimed yet.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ */
+template <typename T> RcuLinkedList<T>::~RcuLinkedList() noexcept
+{
+    for (const Retired& retired : mRetired) {
+        if (retired.mChain) {
+            destroyChain(retired.mNode);
+        } else {
+            delete retired.mNode;
+        }
+    }
+    destroyChain(mHead.load(std::memory_order_relaxed));
+}
+
+/**
+ * Adds value to the end of this RcuLinkedList in constant time.
+ * This operation provides strong exception safety.
+ *
+ * @param value value to append to this RcuLinkedList
+ */
+template <typename T> void RcuLinkedList<T>::add(const T& value)
+{
+    Node* node = new Node(value);
+    mTailLink->store(node, std::memory_order_release);
+    mTailLink = &node->mNext;
+    mSize.store(mSize.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+/**
+ * Inserts value at the specified index. If this RcuLinkedList needs to be
+ * enlarged (index is out of range) default values are used to fill the
+ * gaps; readers see the gap and value appear at once.
+ * This operation provides strong exception safety.
+ *
+ * @param index index at which to insert value
+ * @param value the element to insert
+ */
+template <typename T> void RcuLinkedList<T>::add(uint32_t index, const T& value)
+{
+    uint32_t size = mSize.load(std::memory_order_relaxed);
+    if (index >= size) {
+        // Build the gap and the new element privately, then publish them with
+        // a single store.
+        Node* first = nullptr;
+        Node* tail = nullptr;
+        try {
+            for (uint32_t i = size; i <= index; ++i) {
+                Node* node = new Node(i == index ? value : T());
+                if (tail == nullptr) {
+                    first = node;
+                } else {
+                    tail->mNext.store(node, std::memory_order_relaxed);
+                }
+                tail = node;
+            }
+        } catch (...) {
+            destroyChain(first);
+            throw;
+        }
+        mTailLink->store(first, std::memory_order_release);
+        mTailLink = &tail->mNext;
+        mSize.store(index + 1, std::memory_order_relaxed);
+        return;
+    }
+    std::atomic<Node*>& link = linkBefore(index);
+    Node* node = new Node(value);
+    node->mNext.store(link.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    link.store(node, std::memory_order_release);
+    mSize.store(size + 1, std::memory_order_relaxed);
+}
+
+/**
+ * Empties this RcuLinkedList. The removed nodes are reclaimed once no
+ * reader can reach them any more.
+ * This operation provides strong exception safety.
+ */
+template <typename T> void RcuLinkedList<T>::clear()
+{
+    Node* first = mHead.load(std::memory_order_relaxed);
+    if (first == nullptr) {
+        return;
+    }
+    mRetired.reserve(mRetired.size() + 1);
+    mHead.store(nullptr, std::memory_order_release);
+    mTailLink = &mHead;
+    mSize.store(0, std::memory_order_relaxed);
+    retire(first, true);
+}
+
+/**
+ * Returns a constant reference to the element stored at the provided index
+ * for use by the writer thread. If index is out of bounds, an
+ * std::out_of_range exception is thrown with the index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the element to return
+ * @return constant reference to the element at the index.
+ */
+template <typename T> const T& RcuLinkedList<T>::get(uint32_t index) const
+{
+    rangeCheck(index);
+    const Node* node = mHead.load(std::memory_order_relaxed);
+    for (; index > 0; --index) {
+        node = node->mNext.load(std::memory_order_relaxed);
+    }
+    return node->mItem;
+}
+
+/**
+ * Returns true if this RcuLinkedList is empty and false otherwise.
+ * This operation is a no-throw.
+ *
+ * @return bool True when empty
+ */
+template <typename T> bool RcuLinkedList<T>::isEmpty() const noexcept
+{
+    return size() == 0;
+}
+
+/**
+ * Opens a read guard through which the calling thread may iterate this
+ * RcuLinkedList without locking.
+ * This operation is a no-throw.
+ *
+ * @return the open guard
+ */
+template <typename T> typename RcuLinkedList<T>::ReadGuard RcuLinkedList<T>::read() const noexcept
+{
+    return ReadGuard(this, pin());
+}
+
+/**
+ * Removes the element at the specified index. If index is out of bounds
+ * an std::out_of_range exception is thrown with index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the object to remove.
+ */
+template <typename T> void RcuLinkedList<T>::remove(uint32_t index)
+{
+    rangeCheck(index);
+    mRetired.reserve(mRetired.size() + 1);
+    std::atomic<Node*>& link = linkBefore(index);
+    Node* node = link.load(std::memory_order_relaxed);
+    // node keeps its own link so that readers standing on it can move on
+    link.store(node->mNext.load(std::memory_order_relaxed), std::memory_order_release);
+    if (mTailLink == &node->mNext) {
+        mTailLink = &link;
+    }
+    mSize.store(mSize.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    retire(node, false);
+}
+
+/**
+ * Replaces the element at the specified index with a copy of value. If
+ * index is out of bounds, an std::out_of_range exception is thrown with the
+ * index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the object to set
+ * @param value the new value
+ */
+template <typename T> void RcuLinkedList<T>::set(uint32_t index, const T& value)
+{
+    rangeCheck(index);
+    mRetired.reserve(mRetired.size() + 1);
+    std::unique_ptr<Node> replacement(new Node(value));
+    std::atomic<Node*>& link = linkBefore(index);
+    Node* node = link.load(std::memory_order_relaxed);
+    replacement->mNext.store(
+        node->mNext.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    if (mTailLink == &node->mNext) {
+        mTailLink = &replacement->mNext;
+    }
+    link.store(replacement.release(), std::memory_order_release);
+    retire(node, false);
+}
+
+/**
+ * Return the size of this RcuLinkedList.
+ * This operation is a no-throw.
+ *
+ * @return
+ */
+template <typename T> uint32_t RcuLinkedList<T>::size() const noexcept
+{
+    return mSize.load(std::memory_order_relaxed);
+}
+
+/**
+ * Blocks until every node retired so far has been freed, i.e. until every
+ * guard that was open when this method was called has been closed.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ */
+template <typename T> void RcuLinkedList<T>::synchronize() noexcept
+{
+    reclaim();
+    while (!mRetired.empty()) {
+        std::this_thread::yield();
+        reclaim();
+    }
+}
+
+/**
+ * Returns the number of retired nodes (or chains, for clear()) that are
+ * still waiting to be freed.
+ * This operation is a no-throw.
+ *
+ * @return number of pending retired entries
+ */
+template <typename T> size_t RcuLinkedList<T>::pending() const noexcept
+{
+    return mRetired.size();
+}
+
+/**
+ * Given an index, this method throws an std::out_of_range with the index as
+ * its message if index is out of bounds or is a no-op otherwise.
+ * This operation provides strong exception safety.
+ *
+ * @param index index to check
+ */
+template <typename T> void RcuLinkedList<T>::rangeCheck(uint32_t index) const
+{
+    if (index >= size()) {
+        throw std::out_of_range(std::to_string(index));
+    }
+}
+
+/**
+ * Returns the link that points at the element at index (mHead for 0).
+ * Writer only.
+ * This operation is a no-throw.
+ *
+ * @param index index of the element, at most size()
+ * @return the link in front of the element
+ */
+template <typename T> std::atomic<typename RcuLinkedList<T>::Node*>& RcuLinkedList<T>::linkBefore(
+    uint32_t index) noexcept
+{
+    std::atomic<Node*>* link = &mHead;
+    for (; index > 0; --index) {
+        link = &link->load(std::memory_order_relaxed)->mNext;
+    }
+    return *link;
+}
+
+/**
+ * Queues an unlinked node or chain for reclamation and advances the epoch.
+ * The caller must have reserved room in mRetired.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ */
+template <typename T> void RcuLinkedList<T>::retire(Node* node, bool chain) noexcept
+{
+    // A guard opened at a later epoch was opened after node was unlinked
+    mRetired.push_back(Retired { node, mEpoch.fetch_add(1), chain });
+    if (mRetired.size() >= kReclaimThreshold) {
+        reclaim();
+    }
+}
+
+/**
+ * Frees every retired entry that no open guard can reach.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ */
+template <typename T> void RcuLinkedList<T>::reclaim() noexcept
+{
+    uint64_t oldest = std::numeric_limits<uint64_t>::max();
+    // Pairs with the fence in pin(): the unlinking stores (release only) come
+    // before the slot loads, so either this scan sees the reader's slot or
+    // the reader sees the list without the retired nodes
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (uint32_t i = 0; i < mSlotCount; ++i) {
+        uint64_t epoch = mSlots[i].mEpoch.load();
+        if (epoch != 0 && epoch < oldest) {
+            oldest = epoch;
+        }
+    }
+    size_t freed = 0;
+    while (freed < mRetired.size() && mRetired[freed].mEpoch < oldest) {
+        if (mRetired[freed].mChain) {
+            destroyChain(mRetired[freed].mNode);
+        } else {
+            delete mRetired[freed].mNode;
+        }
+        ++freed;
+    }
+    mRetired.erase(mRetired.begin(), mRetired.begin() + freed);
+}
+
+/**
+ * Claims a reader slot for the current epoch and returns its index.
+ * This operation is a no-throw.
+ */
+template <typename T> uint32_t RcuLinkedList<T>::pin() const noexcept
+{
+    // Start at a per-thread position so that readers rarely contend for a slot
+    size_t start = std::hash<std::thread::id>()(std::this_thread::get_id());
+    for (;;) {
+        for (uint32_t i = 0; i < mSlotCount; ++i) {
+            uint32_t slot = static_cast<uint32_t>((start + i) % mSlotCount);
+            uint64_t expected = 0;
+            if (mSlots[slot].mEpoch.load(std::memory_order_relaxed) == 0
+                && mSlots[slot].mEpoch.compare_exchange_strong(expected, mEpoch.load())) {
+                // The reader's loads of the links must not move ahead of the
+                // slot store. Pairs with the fence in reclaim(), so a writer
+                // that does not see the slot taken has unlinked its nodes
+                // before this reader starts reading.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                return slot;
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * Deletes the nullptr-terminated chain starting at first.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ */
+template <typename T> void RcuLinkedList<T>::destroyChain(Node* first) noexcept
+{
+    while (first != nullptr) {
+        Node* next = first->mNext.load(std::memory_order_relaxed);
+        delete first;
+        first = next;
+    }
+}
+
+template <typename T>
+RcuLinkedList<T>::Node::Node(const T& item)
+    : mItem(item)
+    , mNext(nullptr)
+{
+}
+
+template <typename T>
+RcuLinkedList<T>::ReadGuard::ReadGuard(const RcuLinkedList<T>* list, uint32_t slot) noexcept
+    : mList(list)
+    , mSlot(slot)
+{
+}
+template <typename T>
+RcuLinkedList<T>::ReadGuard::ReadGuard(ReadGuard&& other) noexcept
+    : mList(other.mList)
+    , mSlot(other.mSlot)
+{
+    other.mList = nullptr;
+}
+template <typename T> RcuLinkedList<T>::ReadGuard::~ReadGuard() noexcept
+{
+    if (mList != nullptr) {
+        mList->mSlots[mSlot].mEpoch.store(0, std::memory_order_release);
+    }
+}
+template <typename T>
+typename RcuLinkedList<T>::const_iterator RcuLinkedList<T>::ReadGuard::begin() const noexcept
+{
+    return const_iterator(mList->mHead.load(std::memory_order_acquire));
+}
+template <typename T>
+typename RcuLinkedList<T>::const_iterator RcuLinkedList<T>::ReadGuard::end() const noexcept
+{
+    return const_iterator(nullptr);
+}
+
+template <typename T>
+bool RcuLinkedList<T>::const_iterator::operator==(const const_iterator& rhs) const noexcept
+{
+    return mPtr == rhs.mPtr;
+}
+template <typename T>
+bool RcuLinkedList<T>::const_iterator::operator!=(const const_iterator& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+template <typename T> const T& RcuLinkedList<T>::const_iterator::operator*() const
+{
+    return mPtr->mItem;
+}
+template <typename T> const T* RcuLinkedList<T>::const_iterator::operator->() const
+{
+    return &mPtr->mItem;
+}
+template <typename T>
+typename RcuLinkedList<T>::const_iterator& RcuLinkedList<T>::const_iterator::operator++()
+{
+    mPtr = mPtr->mNext.load(std::memory_order_acquire);
+    return *this;
+}
+template <typename T>
+const typename RcuLinkedList<T>::const_iterator RcuLinkedList<T>::const_iterator::operator++(int)
+{
+    const_iterator temp(*this);
+    ++*this;
+    return temp;
+}
+template <typename T>
+RcuLinkedList<T>::const_iterator::const_iterator(const Node* ptr)
+    : mPtr(ptr)
+{
+}
+#endif
@@ -0,0 +1,85 @@
+// RoundRobinCursor.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef ROUND_ROBIN_CURSOR_CPP
+#define ROUND_ROBIN_CURSOR_CPP
+#include <RoundRobinCursor.h>
+#include <stdexcept>
+
+/**
+ * Initializes a cursor over list whose first call to next() returns
+ * the first element.
+ * This operation is a no-throw.
+ *
+ * @param list list to cycle through
+ */
+template <typename T, typename Allocator>
+RoundRobinCursor<T, Allocator>::RoundRobinCursor(LinkedList<T, Allocator>& list) noexcept
+    : mList(&list)
+    , mCurrent(list.end())
+    , mStep(true)
+{
+}
+
+/**
+ * Steps to the next element, wrapping around at the end of the list,
+ * and returns a reference to it. If the list is empty, an
+ * std::out_of_range exception is thrown with 0 as its message.
+ * This operation provides strong exception safety.
+ *
+ * @return reference to the new current element
+ */
+template <typename T, typename Allocator> T& RoundRobinCursor<T, Allocator>::next()
+{
+    if (mList->isEmpty()) {
+        throw std::out_of_range("0");
+    }
+    iterator current = mCurrent;
+    if (mStep) {
+        ++current;
+    }
+    // Stepping off the dummy node lands on the first element
+    if (current == mList->end()) {
+        ++current;
+    }
+    T& item = *current;
+    mCurrent = current;
+    mStep = true;
+    return item;
+}
+
+/**
+ * Removes the current element from the list, so that the following
+ * call to next() returns the element that came after it. Does nothing
+ * if there is no current element.
+ * This operation is no-throw under the assumption that the
+ * parameterizing type's destructor is no-throw.
+ */
+template <typename T, typename Allocator> void RoundRobinCursor<T, Allocator>::erase() noexcept
+{
+    if (!mStep || mCurrent == mList->end()) {
+        return;
+    }
+    mCurrent = mList->erase(mCurrent);
+    mStep = false;
+}
+
+/**
+ * Returns an iterator to the current element, or the end() of the list
+ * if next() has not been called since the cursor was created or
+ * erase() was last called.
+ * This operation is a no-throw.
+ *
+ * @return iterator to the current element
+ */
+template <typename T, typename Allocator>
+typename RoundRobinCursor<T, Allocator>::iterator RoundRobinCursor<T, Allocator>::position()
+    const noexcept
+{
+    return mStep ? mCurrent : mList->end();
+}
+
+#endif
@@ -0,0 +1,564 @@
+// SharedMemoryQueue.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef SHARED_MEMORY_QUEUE_CPP
+#define SHARED_MEMORY_QUEUE_CPP
+#include <SharedMemoryQueue.h>
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <new>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <system_error>
+#include <unistd.h>
+
+/**
+ * Creates the shared memory object name (which must not exist yet)
+ * holding an empty queue of capacity records and maps it.
+ * This operation provides strong exception safety.
+ *
+ * @param name POSIX shared memory name, e.g. "/records"
+ * @param capacity maximum number of queued records
+ * @return handle to the new queue
+ */
+template <typename T>
+SharedMemoryQueue<T> SharedMemoryQueue<T>::create(const std::string& name, uint32_t capacity)
+{
+    if (capacity == 0) {
+        throw std::invalid_argument(std::to_string(capacity));
+    }
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), name);
+    }
+    size_t bytes = bytesFor(capacity);
+    if (ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        int error = errno;
+        close(fd);
+        shm_unlink(name.c_str());
+        throw std::system_error(error, std::generic_category(), name);
+    }
+    unsigned char* base;
+    try {
+        base = map(fd, bytes);
+    } catch (...) {
+        shm_unlink(name.c_str());
+        throw;
+    }
+    SharedMemoryQueue<T> queue(base, bytes);
+
+    Control* control = new (base) Control();
+    control->mNodeSize = sizeof(Node);
+    control->mCapacity = capacity;
+    pthread_mutexattr_t attributes;
+    int error = pthread_mutexattr_init(&attributes);
+    if (error == 0) {
+        error = pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+        if (error == 0) {
+            error = pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+        }
+        if (error == 0) {
+            error = pthread_mutex_init(&control->mMutex, &attributes);
+        }
+        pthread_mutexattr_destroy(&attributes);
+    }
+    if (error != 0) {
+        shm_unlink(name.c_str());
+        throw std::system_error(error, std::generic_category(), name);
+    }
+
+    uint64_t dummy = queue.offsetOf(&control->mDummy);
+    control->mDummy.mPrev = dummy;
+    control->mDummy.mNext = dummy;
+    for (uint32_t i = capacity; i-- > 0;) {
+        uint64_t offset = sizeof(Control) + static_cast<uint64_t>(i) * sizeof(Node);
+        queue.at(offset)->mNext = control->mFree;
+        control->mFree = offset;
+    }
+    control->mMagic.store(kMagic, std::memory_order_release);
+    return queue;
+}
+
+/**
+ * Maps the existing queue name. If it was not made by create() for
+ * records of this size, an std::invalid_argument exception is thrown
+ * with the name as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param name POSIX shared memory name
+ * @return handle to the queue
+ */
+template <typename T> SharedMemoryQueue<T> SharedMemoryQueue<T>::open(const std::string& name)
+{
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), name);
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        int error = errno;
+        close(fd);
+        throw std::system_error(error, std::generic_category(), name);
+    }
+    size_t bytes = static_cast<size_t>(status.st_size);
+    if (bytes < sizeof(Control)) {
+        close(fd);
+        throw std::invalid_argument(name);
+    }
+    SharedMemoryQueue<T> queue(map(fd, bytes), bytes);
+    const Control* control = queue.mControl;
+    if (control->mMagic.load(std::memory_order_acquire) != kMagic
+        || control->mNodeSize != sizeof(Node) || bytesFor(control->mCapacity) != bytes) {
+        throw std::invalid_argument(name);
+    }
+    return queue;
+}
+
+/**
+ * Removes the name of a shared memory object. Mapped handles keep
+ * working. A name that does not exist is ignored.
+ * This operation is a no-throw.
+ *
+ * @param name POSIX shared memory name
+ */
+template <typename T> void SharedMemoryQueue<T>::unlink(const std::string& name) noexcept
+{
+    shm_unlink(name.c_str());
+}
+
+template <typename T>
+SharedMemoryQueue<T>::SharedMemoryQueue(SharedMemoryQueue<T>&& other) noexcept
+    : mBase(other.mBase)
+    , mBytes(other.mBytes)
+    , mControl(other.mControl)
+{
+    other.mBase = nullptr;
+    other.mControl = nullptr;
+}
+
+/**
+ * Destructor. Unmaps the queue.
+ * This operation is a no-throw.
+ */
+template <typename T> SharedMemoryQueue<T>::~SharedMemoryQueue() noexcept
+{
+    if (mBase != nullptr) {
+        munmap(mBase, mBytes);
+    }
+}
+
+/**
+ * Appends record, waiting while the queue is full.
+ * This operation provides strong exception safety.
+ *
+ * @param record record to append
+ */
+template <typename T> void SharedMemoryQueue<T>::push(const T& record)
+{
+    bool waiting = false;
+    uint32_t epoch = 0;
+    bool wakePoppers = false;
+    for (;;) {
+        uint32_t removed;
+        {
+            Lock lock(*this);
+            if (waiting && epoch == mControl->mWaiterEpoch) {
+                --mControl->mPushers;
+            }
+            if (mControl->mSize < mControl->mCapacity) {
+                wakePoppers = append(record);
+                break;
+            }
+            // Read under the lock: a pop after it bumps the word, so the
+            // futex wait below returns at once instead of missing it.
+            removed = mControl->mRemoved.load(std::memory_order_relaxed);
+            ++mControl->mPushers;
+            epoch = mControl->mWaiterEpoch;
+            waiting = true;
+        }
+        wait(mControl->mRemoved, removed);
+    }
+    if (wakePoppers) {
+        notify(mControl->mAdded);
+    }
+}
+
+/**
+ * Appends record if the queue is not full.
+ * This operation provides strong exception safety.
+ *
+ * @param record record to append
+ * @return true iff the record was appended
+ */
+template <typename T> bool SharedMemoryQueue<T>::tryPush(const T& record)
+{
+    bool wakePoppers;
+    {
+        Lock lock(*this);
+        if (mControl->mSize == mControl->mCapacity) {
+            return false;
+        }
+        wakePoppers = append(record);
+    }
+    if (wakePoppers) {
+        notify(mControl->mAdded);
+    }
+    return true;
+}
+
+/**
+ * Removes and returns the oldest record, waiting while the queue is
+ * empty.
+ * This operation provides strong exception safety.
+ *
+ * @return the oldest record
+ */
+template <typename T> T SharedMemoryQueue<T>::pop()
+{
+    T record;
+    bool waiting = false;
+    uint32_t epoch = 0;
+    bool wakePushers = false;
+    for (;;) {
+        uint32_t added;
+        {
+            Lock lock(*this);
+            if (waiting && epoch == mControl->mWaiterEpoch) {
+                --mControl->mPoppers;
+            }
+            if (mControl->mSize != 0) {
+                wakePushers = takeFirst(record);
+                break;
+            }
+            added = mControl->mAdded.load(std::memory_order_relaxed);
+            ++mControl->mPoppers;
+            epoch = mControl->mWaiterEpoch;
+            waiting = true;
+        }
+        wait(mControl->mAdded, added);
+    }
+    if (wakePushers) {
+        notify(mControl->mRemoved);
+    }
+    return record;
+}
+
+/**
+ * Removes the oldest record into record if the queue is not empty.
+ * This operation provides strong exception safety.
+ *
+ * @param record receives the oldest record
+ * @return true iff a record was removed
+ */
+template <typename T> bool SharedMemoryQueue<T>::tryPop(T& record)
+{
+    bool wakePushers;
+    {
+        Lock lock(*this);
+        if (mControl->mSize == 0) {
+            return false;
+        }
+        wakePushers = takeFirst(record);
+    }
+    if (wakePushers) {
+        notify(mControl->mRemoved);
+    }
+    return true;
+}
+
+/**
+ * Returns the number of queued records.
+ * This operation provides strong exception safety.
+ *
+ * @return number of queued records
+ */
+template <typename T> uint32_t SharedMemoryQueue<T>::size()
+{
+    Lock lock(*this);
+    return mControl->mSize;
+}
+
+/**
+ * Returns the maximum number of queued records.
+ * This operation is a no-throw.
+ *
+ * @return capacity
+ */
+template <typename T> uint32_t SharedMemoryQueue<T>::capacity() const noexcept
+{
+    return mControl->mCapacity;
+}
+
+/**
+ * Returns how many times a process found the mutex abandoned by a dead
+ * owner and repaired the queue, over the lifetime of the object.
+ * This operation provides strong exception safety.
+ *
+ * @return number of repairs
+ */
+template <typename T> uint64_t SharedMemoryQueue<T>::recoveries()
+{
+    Lock lock(*this);
+    return mControl->mRecoveries;
+}
+
+/**
+ * Locks the queue, repairing it first if the previous owner died.
+ * If the mutex cannot be locked, an std::system_error is thrown.
+ */
+template <typename T>
+SharedMemoryQueue<T>::Lock::Lock(SharedMemoryQueue<T>& queue)
+    : mControl(queue.mControl)
+{
+    int error = pthread_mutex_lock(&mControl->mMutex);
+    if (error == EOWNERDEAD) {
+        queue.repair();
+        ++mControl->mRecoveries;
+        error = pthread_mutex_consistent(&mControl->mMutex);
+        if (error != 0) {
+            pthread_mutex_unlock(&mControl->mMutex);
+        }
+    }
+    if (error != 0) {
+        throw std::system_error(error, std::generic_category(), "queue mutex");
+    }
+}
+
+template <typename T> SharedMemoryQueue<T>::Lock::~Lock() noexcept
+{
+    pthread_mutex_unlock(&mControl->mMutex);
+}
+
+template <typename T>
+SharedMemoryQueue<T>::SharedMemoryQueue(unsigned char* base, size_t bytes) noexcept
+    : mBase(base)
+    , mBytes(bytes)
+    , mControl(reinterpret_cast<Control*>(base))
+{
+}
+
+/**
+ * Returns the size of an object holding capacity nodes.
+ * This operation is a no-throw.
+ */
+template <typename T> size_t SharedMemoryQueue<T>::bytesFor(uint32_t capacity) noexcept
+{
+    // Control ends with a Node, so the nodes that follow it are aligned.
+    return sizeof(Control) + static_cast<size_t>(capacity) * sizeof(Node);
+}
+
+/**
+ * Maps the object open as fd, of bytes bytes, and closes fd.
+ * This operation provides strong exception safety.
+ */
+template <typename T> unsigned char* SharedMemoryQueue<T>::map(int fd, size_t bytes)
+{
+    void* base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int error = errno;
+    close(fd);
+    if (base == MAP_FAILED) {
+        throw std::system_error(error, std::generic_category(), "shared memory queue");
+    }
+    return static_cast<unsigned char*>(base);
+}
+
+/**
+ * Converts between nodes and their offsets.
+ * This operation is a no-throw.
+ */
+template <typename T>
+typename SharedMemoryQueue<T>::Node* SharedMemoryQueue<T>::at(uint64_t offset) const noexcept
+{
+    return reinterpret_cast<Node*>(mBase + offset);
+}
+
+template <typename T> uint64_t SharedMemoryQueue<T>::offsetOf(const Node* node) const noexcept
+{
+    return static_cast<uint64_t>(reinterpret_cast<const unsigned char*>(node) - mBase);
+}
+
+/**
+ * Returns true if offset is the offset of one of the capacity nodes.
+ * This operation is a no-throw.
+ */
+template <typename T> bool SharedMemoryQueue<T>::isNode(uint64_t offset) const noexcept
+{
+    return offset >= sizeof(Control) && offset < mBytes
+        && (offset - sizeof(Control)) % sizeof(Node) == 0;
+}
+
+/**
+ * Links a free node holding record before the dummy node.
+ * This operation is a no-throw.
+ *
+ * @pre the queue is locked and not full
+ * @return true if a process is waiting for a record to be added
+ */
+template <typename T> bool SharedMemoryQueue<T>::append(const T& record) noexcept
+{
+    Control& control = *mControl;
+    uint64_t offset = control.mFree;
+    Node* node = at(offset);
+    control.mFree = node->mNext;
+    node->mItem = record;
+    node->mPrev = control.mDummy.mPrev;
+    node->mNext = offsetOf(&control.mDummy);
+    // A process may die between any two stores; the fences keep the
+    // compiler from moving the store that publishes the node in the next
+    // chain ahead of the ones that fill it in (see repair()).
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    at(node->mPrev)->mNext = offset;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    control.mDummy.mPrev = offset;
+    ++control.mSize;
+    control.mAdded.fetch_add(1, std::memory_order_relaxed);
+    return control.mPoppers != 0;
+}
+
+/**
+ * Unlinks the first node, copies its record into record and returns the
+ * node to the free list.
+ * This operation is a no-throw.
+ *
+ * @pre the queue is locked and not empty
+ * @return true if a process is waiting for a record to be removed
+ */
+template <typename T> bool SharedMemoryQueue<T>::takeFirst(T& record) noexcept
+{
+    Control& control = *mControl;
+    uint64_t offset = control.mDummy.mNext;
+    Node* node = at(offset);
+    record = node->mItem;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    control.mDummy.mNext = node->mNext;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    at(node->mNext)->mPrev = offsetOf(&control.mDummy);
+    node->mNext = control.mFree;
+    control.mFree = offset;
+    --control.mSize;
+    control.mRemoved.fetch_add(1, std::memory_order_relaxed);
+    return control.mPushers != 0;
+}
+
+/**
+ * Rebuilds the previous links, the size and the free list from the
+ * chain of next links (see the class description), and resets the
+ * waiters, which may include the process that died.
+ * This operation is a no-throw.
+ *
+ * @pre the queue is locked
+ */
+template <typename T> void SharedMemoryQueue<T>::repair() noexcept
+{
+    Control& control = *mControl;
+    uint64_t end = bytesFor(control.mCapacity);
+
+    // Offset 0 is the control block, never a node, so a previous link of 0
+    // marks a node the walk has not reached. Reaching a marked node again
+    // means the chain loops; it is cut there.
+    for (uint64_t offset = sizeof(Control); offset < end; offset += sizeof(Node)) {
+        at(offset)->mPrev = 0;
+    }
+    uint64_t dummy = offsetOf(&control.mDummy);
+    uint64_t previous = dummy;
+    uint32_t size = 0;
+    for (uint64_t offset = control.mDummy.mNext; offset != dummy && isNode(offset)
+         && at(offset)->mPrev == 0;
+         offset = at(offset)->mNext) {
+        at(offset)->mPrev = previous;
+        previous = offset;
+        ++size;
+    }
+    at(previous)->mNext = dummy;
+    control.mDummy.mPrev = previous;
+    control.mSize = size;
+
+    control.mFree = 0;
+    for (uint64_t offset = end; offset > sizeof(Control);) {
+        offset -= sizeof(Node);
+        if (at(offset)->mPrev == 0) {
+            at(offset)->mNext = control.mFree;
+            control.mFree = offset;
+        }
+    }
+    resetWaiters();
+}
+
+/**
+ * Forgets the sleeping processes: zeroes both counts, starts a new
+ * waiter epoch and wakes every sleeper, so that those still alive
+ * register again.
+ * This operation is a no-throw.
+ *
+ * @pre the queue is locked
+ */
+template <typename T> void SharedMemoryQueue<T>::resetWaiters() noexcept
+{
+    Control& control = *mControl;
+    control.mPoppers = 0;
+    control.mPushers = 0;
+    ++control.mWaiterEpoch;
+    // Also reaches processes that have registered but not gone to sleep yet:
+    // their wait returns at once because the word has changed
+    control.mAdded.fetch_add(1, std::memory_order_relaxed);
+    control.mRemoved.fetch_add(1, std::memory_order_relaxed);
+    wake(control.mAdded);
+    wake(control.mRemoved);
+}
+
+/**
+ * Wakes the processes sleeping on word, which the counts say exist. If
+ * none was asleep, the count includes processes that died while
+ * waiting, and the waiters are reset.
+ * This operation is a no-throw.
+ *
+ * @pre the queue is not locked by this process
+ */
+template <typename T> void SharedMemoryQueue<T>::notify(std::atomic<uint32_t>& word) noexcept
+{
+    if (wake(word)) {
+        return;
+    }
+    try {
+        Lock lock(*this);
+        resetWaiters();
+    } catch (const std::system_error&) {
+        // The counts stay too high, which only costs futile wake-ups
+    }
+}
+
+/**
+ * Sleeps until word differs from expected (or a spurious wake-up).
+ * This operation is a no-throw.
+ */
+template <typename T>
+void SharedMemoryQueue<T>::wait(std::atomic<uint32_t>& word, uint32_t expected) noexcept
+{
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t)
+            && std::atomic<uint32_t>::is_always_lock_free,
+        "futex words must be plain 32-bit integers");
+    // Not FUTEX_PRIVATE_FLAG: the sleepers are in other processes.
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, nullptr,
+        nullptr, 0);
+}
+
+/**
+ * Wakes the processes sleeping on word and returns true iff there were
+ * any (or the call failed).
+ * This operation is a no-throw.
+ */
+template <typename T> bool SharedMemoryQueue<T>::wake(std::atomic<uint32_t>& word) noexcept
+{
+    return syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr,
+               nullptr, 0)
+        != 0;
+}
+
+#endif
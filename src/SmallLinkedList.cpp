@@ -0,0 +1,238 @@
+// SmallLinkedList.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef SMALL_LINKED_LIST_CPP
+#define SMALL_LINKED_LIST_CPP
+#include <SmallLinkedList.h>
+#include <new>
+
+/**
+ * Initializes an allocator that uses arena, or only the heap if arena is
+ * nullptr.
+ * This operation is a no-throw.
+ *
+ * @param arena arena to allocate from first
+ */
+template <typename T>
+SmallBufferAllocator<T>::SmallBufferAllocator(SmallBufferArena* arena) noexcept
+    : mArena(arena)
+{
+}
+
+/**
+ * Initializes an allocator that uses the same arena as other.
+ * This operation is a no-throw.
+ *
+ * @param other allocator to rebind
+ */
+template <typename T>
+template <typename U>
+SmallBufferAllocator<T>::SmallBufferAllocator(const SmallBufferAllocator<U>& other) noexcept
+    : mArena(other.mArena)
+{
+}
+
+/**
+ * Returns storage for n objects of type T: a free arena slot if n is 1
+ * and one fits, heap memory otherwise.
+ * This operation provides strong exception safety.
+ *
+ * @param n number of objects
+ * @return pointer to the storage
+ */
+template <typename T> T* SmallBufferAllocator<T>::allocate(size_t n)
+{
+    if (mArena != nullptr && n == 1 && mArena->mFree != 0 && sizeof(T) <= mArena->mSlotSize
+        && alignof(T) <= mArena->mSlotAlign) {
+        uint32_t slot = 0;
+        while ((mArena->mFree & (uint64_t(1) << slot)) == 0) {
+            ++slot;
+        }
+        mArena->mFree &= ~(uint64_t(1) << slot);
+        return reinterpret_cast<T*>(mArena->mBegin + slot * mArena->mSlotSize);
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+}
+
+/**
+ * Returns storage obtained from allocate(n) to the arena or the heap.
+ * This operation is a no-throw.
+ *
+ * @param p pointer to the storage
+ * @param n number of objects
+ */
+template <typename T> void SmallBufferAllocator<T>::deallocate(T* p, size_t) noexcept
+{
+    unsigned char* bytes = reinterpret_cast<unsigned char*>(p);
+    if (mArena != nullptr && bytes >= mArena->mBegin
+        && bytes < mArena->mBegin + mArena->mSlots * mArena->mSlotSize) {
+        size_t slot = static_cast<size_t>(bytes - mArena->mBegin) / mArena->mSlotSize;
+        mArena->mFree |= uint64_t(1) << slot;
+        return;
+    }
+    ::operator delete(p);
+}
+
+/**
+ * Returns an allocator without an arena (see the class description).
+ * This operation is a no-throw.
+ *
+ * @return heap-only allocator
+ */
+template <typename T>
+SmallBufferAllocator<T> SmallBufferAllocator<T>::select_on_container_copy_construction() const
+    noexcept
+{
+    return SmallBufferAllocator<T>(nullptr);
+}
+
+template <typename T>
+template <typename U>
+bool SmallBufferAllocator<T>::operator==(const SmallBufferAllocator<U>& rhs) const noexcept
+{
+    return mArena == rhs.mArena;
+}
+
+template <typename T>
+template <typename U>
+bool SmallBufferAllocator<T>::operator!=(const SmallBufferAllocator<U>& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+template <typename T, uint32_t K>
+SmallLinkedListStorage<T, K>::SmallLinkedListStorage() noexcept
+    : mArena { mSlots, sizeof(LinkedListNode<T>), alignof(LinkedListNode<T>), K + 1,
+        (uint64_t(1) << (K + 1)) - 1 }
+{
+}
+
+/**
+ * Initializes an empty SmallLinkedList. The dummy node is placed in the
+ * inline storage.
+ * This operation provides strong exception safety.
+ */
+template <typename T, uint32_t K>
+SmallLinkedList<T, K>::SmallLinkedList()
+    : SmallLinkedListStorage<T, K>()
+    , LinkedList<T, SmallBufferAllocator<T>>(SmallBufferAllocator<T>(&this->mArena))
+{
+}
+
+/**
+ * Initializes the SmallLinkedList to be a copy of src, in its own inline
+ * storage.
+ * This operation provides strong exception safety.
+ *
+ * @param src SmallLinkedList to copy
+ */
+template <typename T, uint32_t K>
+SmallLinkedList<T, K>::SmallLinkedList(const SmallLinkedList<T, K>& src)
+    : SmallLinkedListStorage<T, K>()
+    , LinkedList<T, SmallBufferAllocator<T>>(src, SmallBufferAllocator<T>(&this->mArena))
+{
+}
+
+/**
+ * Initializes the SmallLinkedList to be a copy of src, in its own inline
+ * storage. The nodes of src cannot be taken over, so the elements are
+ * copied and src is left unchanged.
+ * This operation provides strong exception safety.
+ *
+ * @param src SmallLinkedList to copy
+ */
+template <typename T, uint32_t K>
+SmallLinkedList<T, K>::SmallLinkedList(SmallLinkedList<T, K>&& src)
+    : SmallLinkedList<T, K>(static_cast<const SmallLinkedList<T, K>&>(src))
+{
+}
+
+/**
+ * Makes this object a copy of rhs. Note that calling this method on
+ * yourself (l = l;) is equivalent to a no-op.
+ * This operation provides strong exception safety.
+ *
+ * @param rhs SmallLinkedList to copy
+ * @return *this, used for chaining.
+ */
+template <typename T, uint32_t K>
+SmallLinkedList<T, K>& SmallLinkedList<T, K>::operator=(const SmallLinkedList<T, K>& rhs)
+{
+    Base::operator=(rhs);
+    return *this;
+}
+
+/**
+ * Makes this object a copy of rhs, which is left unchanged (see the move
+ * constructor).
+ * This operation provides strong exception safety.
+ *
+ * @param rhs SmallLinkedList to copy
+ * @return *this, used for chaining.
+ */
+template <typename T, uint32_t K>
+SmallLinkedList<T, K>& SmallLinkedList<T, K>::operator=(SmallLinkedList<T, K>&& rhs)
+{
+    Base::operator=(static_cast<const Base&>(rhs));
+    return *this;
+}
+
+/**
+ * Exchanges the contents of this SmallLinkedList and other by copying
+ * the elements, in time proportional to their sizes.
+ * This operation provides basic exception safety.
+ *
+ * @param other the SmallLinkedList to swap with
+ */
+template <typename T, uint32_t K> void SmallLinkedList<T, K>::swap(SmallLinkedList<T, K>& other)
+{
+    if (this == &other) {
+        return;
+    }
+    SmallLinkedList<T, K> tmp(*this);
+    *this = other;
+    other = tmp;
+}
+
+/**
+ * Returns true if rhs holds equal elements in the same order.
+ * This operation provides strong exception safety.
+ *
+ * @param rhs SmallLinkedList to compare with
+ * @return bool True when equal
+ */
+template <typename T, uint32_t K>
+bool SmallLinkedList<T, K>::operator==(const SmallLinkedList<T, K>& rhs) const
+{
+    return Base::operator==(rhs);
+}
+
+/**
+ * Returns the negation of operator==.
+ * This operation provides strong exception safety.
+ *
+ * @param rhs SmallLinkedList to compare with
+ * @return bool True when not equal
+ */
+template <typename T, uint32_t K>
+bool SmallLinkedList<T, K>::operator!=(const SmallLinkedList<T, K>& rhs) const
+{
+    return !(*this == rhs);
+}
+
+/**
+ * Returns the number of elements that fit in the inline storage, K.
+ * This operation is a no-throw.
+ *
+ * @return inline capacity
+ */
+template <typename T, uint32_t K>
+constexpr uint32_t SmallLinkedList<T, K>::inlineCapacity() noexcept
+{
+    return K;
+}
+
+#endif
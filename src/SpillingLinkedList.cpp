@@ -0,0 +1,455 @@
+// SpillingLinkedList.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef SPILLING_LINKED_LIST_CPP
+#define SPILLING_LINKED_LIST_CPP
+#include <SpillingLinkedList.h>
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * Initializes an empty SpillingLinkedList that keeps at most
+ * memoryBudget bytes of nodes in memory. If the budget does not hold
+ * two segments, an std::invalid_argument exception is thrown with the
+ * budget as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param memoryBudget bytes of nodes that may be resident
+ * @param segmentSize number of elements per segment
+ */
+template <typename T>
+SpillingLinkedList<T>::SpillingLinkedList(size_t memoryBudget, uint32_t segmentSize)
+    : mSegments()
+    , mFile(nullptr)
+    , mSegmentSize(segmentSize)
+    , mMaxResident(0)
+    , mResident(0)
+    , mReadahead(4)
+    , mSize(0)
+    , mLastAccess(UINT32_MAX)
+    , mClock(0)
+    , mStats()
+{
+    size_t segmentBytes = (static_cast<size_t>(segmentSize) + 1) * sizeof(LinkedListNode<T>);
+    if (segmentSize == 0 || memoryBudget / segmentBytes < 2) {
+        throw std::invalid_argument(std::to_string(memoryBudget));
+    }
+    mMaxResident = static_cast<uint32_t>(std::min<size_t>(memoryBudget / segmentBytes, UINT32_MAX));
+    mFile = std::tmpfile();
+    if (mFile == nullptr) {
+        throw std::system_error(errno, std::generic_category(), "spill file");
+    }
+}
+
+/**
+ * Destructor. Frees the nodes and closes (and so deletes) the spill file.
+ * This operation is a no-throw.
+ */
+template <typename T> SpillingLinkedList<T>::~SpillingLinkedList() noexcept
+{
+    std::fclose(mFile);
+}
+
+/**
+ * Adds value to the end of this SpillingLinkedList. Starting a new
+ * segment may evict another one first.
+ * This operation provides strong exception safety.
+ *
+ * @param value value to append
+ */
+template <typename T> void SpillingLinkedList<T>::add(const T& value)
+{
+    if (mSegments.empty() || mSegments.back().mCount == mSegmentSize) {
+        makeRoom(1);
+        mSegments.push_back(Segment { LinkedList<T>(), 0, true, true, ++mClock });
+        ++mResident;
+        try {
+            mSegments.back().mNodes.add(value);
+        } catch (...) {
+            mSegments.pop_back();
+            --mResident;
+            throw;
+        }
+    } else {
+        // A segment that is still filling up is never evicted
+        mSegments.back().mNodes.add(value);
+    }
+    Segment& tail = mSegments.back();
+    ++tail.mCount;
+    tail.mDirty = true;
+    ++mSize;
+}
+
+/**
+ * Empties this SpillingLinkedList. The spill file keeps its size but its
+ * contents are no longer used. The counters are not reset.
+ * This operation is a no-throw.
+ */
+template <typename T> void SpillingLinkedList<T>::clear() noexcept
+{
+    mSegments.clear();
+    mResident = 0;
+    mSize = 0;
+    mLastAccess = UINT32_MAX;
+}
+
+/**
+ * Returns a constant reference to the element stored at the provided
+ * index, paging its segment in if necessary. The reference is valid
+ * until the next access. If index is out of bounds, an std::out_of_range
+ * exception is thrown with the index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the element to return
+ * @return constant reference to the element at the index
+ */
+template <typename T> const T& SpillingLinkedList<T>::get(uint32_t index)
+{
+    rangeCheck(index);
+    uint32_t segment = index / mSegmentSize;
+    const LinkedList<T>& nodes = acquire(segment, segment == mLastAccess + 1).mNodes;
+    return nodes.get(index % mSegmentSize);
+}
+
+/**
+ * Sets the element at the specified index to the provided value, paging
+ * its segment in if necessary. If index is out of bounds, an
+ * std::out_of_range exception is thrown with the index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the object to set
+ * @param value the new value
+ */
+template <typename T> void SpillingLinkedList<T>::set(uint32_t index, const T& value)
+{
+    rangeCheck(index);
+    uint32_t segment = index / mSegmentSize;
+    Segment& target = acquire(segment, segment == mLastAccess + 1);
+    target.mNodes.set(index % mSegmentSize, value);
+    target.mDirty = true;
+}
+
+/**
+ * Returns an iterator to the beginning, paging the first segment in.
+ * This operation provides strong exception safety.
+ *
+ * @return const_iterator
+ */
+template <typename T> typename SpillingLinkedList<T>::const_iterator SpillingLinkedList<T>::begin()
+{
+    return const_iterator(this, 0);
+}
+
+/**
+ * Returns an iterator to the end.
+ * This operation is a no-throw.
+ *
+ * @return const_iterator
+ */
+template <typename T>
+typename SpillingLinkedList<T>::const_iterator SpillingLinkedList<T>::end() noexcept
+{
+    return const_iterator(this, mSize);
+}
+
+/**
+ * Sets how many spilled segments a sequential miss reads ahead.
+ * This operation is a no-throw.
+ *
+ * @param segments number of segments to read ahead (0 to disable)
+ */
+template <typename T> void SpillingLinkedList<T>::setReadahead(uint32_t segments) noexcept
+{
+    mReadahead = segments;
+}
+
+/**
+ * Returns the I/O counters.
+ * This operation is a no-throw.
+ *
+ * @return counters since construction
+ */
+template <typename T> SpillStats SpillingLinkedList<T>::stats() const noexcept
+{
+    return mStats;
+}
+
+/**
+ * Returns the number of bytes of nodes currently in memory, at most the
+ * budget.
+ * This operation is a no-throw.
+ *
+ * @return resident bytes
+ */
+template <typename T> size_t SpillingLinkedList<T>::residentBytes() const noexcept
+{
+    size_t nodes = 0;
+    for (const Segment& segment : mSegments) {
+        if (segment.mResident) {
+            nodes += segment.mCount + 1;
+        }
+    }
+    return nodes * sizeof(LinkedListNode<T>);
+}
+
+/**
+ * Returns true if this SpillingLinkedList is empty and false otherwise.
+ * This operation is a no-throw.
+ *
+ * @return bool True when empty
+ */
+template <typename T> bool SpillingLinkedList<T>::isEmpty() const noexcept
+{
+    return mSize == 0;
+}
+
+/**
+ * Return the size of this SpillingLinkedList.
+ * This operation is a no-throw.
+ *
+ * @return
+ */
+template <typename T> uint32_t SpillingLinkedList<T>::size() const noexcept
+{
+    return mSize;
+}
+
+/**
+ * Given an index, this method throws an std::out_of_range with the index as
+ * its message if index is out of bounds or is a no-op otherwise.
+ * This operation provides strong exception safety.
+ *
+ * @param index index to check
+ */
+template <typename T> void SpillingLinkedList<T>::rangeCheck(uint32_t index) const
+{
+    if (index >= mSize) {
+        throw std::out_of_range(std::to_string(index));
+    }
+}
+
+/**
+ * Makes segment resident, reading ahead if the access is sequential,
+ * counts the access and returns the segment.
+ * This operation provides strong exception safety.
+ *
+ * @param segment position of the segment
+ * @param sequential whether the access belongs to a sequential scan
+ * @return the resident segment
+ */
+template <typename T>
+typename SpillingLinkedList<T>::Segment& SpillingLinkedList<T>::acquire(
+    uint32_t segment, bool sequential)
+{
+    Segment& target = mSegments[segment];
+    if (target.mResident) {
+        ++mStats.mHits;
+    } else {
+        uint32_t count = 1;
+        while (sequential && count <= mReadahead && segment + count < mSegments.size()
+            && !mSegments[segment + count].mResident) {
+            ++count;
+        }
+        // Only full segments are evicted and the budget holds two segments,
+        // so there is always room for the one being accessed
+        load(segment, makeRoom(count));
+        ++mStats.mMisses;
+    }
+    target.mLastUse = ++mClock;
+    mLastAccess = segment;
+    return target;
+}
+
+/**
+ * Evicts least recently used segments until count more fit in the
+ * budget, or no more segment can be evicted. Returns how many fit.
+ * This operation provides strong exception safety.
+ *
+ * @param count number of segments about to be loaded
+ * @return number of segments that fit (at most count)
+ */
+template <typename T> uint32_t SpillingLinkedList<T>::makeRoom(uint32_t count)
+{
+    while (mResident + count > mMaxResident) {
+        uint32_t victim = UINT32_MAX;
+        for (uint32_t i = 0; i < mSegments.size(); ++i) {
+            const Segment& segment = mSegments[i];
+            if (segment.mResident && segment.mCount == mSegmentSize
+                && (victim == UINT32_MAX || segment.mLastUse < mSegments[victim].mLastUse)) {
+                victim = i;
+            }
+        }
+        if (victim == UINT32_MAX) {
+            break;
+        }
+        evict(victim);
+    }
+    return mResident >= mMaxResident ? 0 : std::min(count, mMaxResident - mResident);
+}
+
+/**
+ * Writes segment to the spill file if it is dirty and frees its nodes.
+ * This operation provides strong exception safety.
+ *
+ * @param segment position of a resident, full segment
+ */
+template <typename T> void SpillingLinkedList<T>::evict(uint32_t segment)
+{
+    Segment& victim = mSegments[segment];
+    if (victim.mDirty) {
+        std::vector<T> items;
+        items.reserve(mSegmentSize);
+        for (const T& item : static_cast<const LinkedList<T>&>(victim.mNodes)) {
+            items.push_back(item);
+        }
+        size_t bytes = items.size() * sizeof(T);
+        transfer(items.data(), bytes, static_cast<uint64_t>(segment) * bytes, true);
+        victim.mDirty = false;
+        ++mStats.mSegmentsWritten;
+        mStats.mBytesWritten += bytes;
+    }
+    victim.mNodes.clear();
+    victim.mResident = false;
+    --mResident;
+}
+
+/**
+ * Reads count consecutive spilled segments starting at first with one
+ * read and makes them resident.
+ * This operation provides strong exception safety.
+ *
+ * @param first position of the first segment
+ * @param count number of segments
+ */
+template <typename T> void SpillingLinkedList<T>::load(uint32_t first, uint32_t count)
+{
+    size_t segmentBytes = static_cast<size_t>(mSegmentSize) * sizeof(T);
+    std::vector<T> items(static_cast<size_t>(count) * mSegmentSize);
+    uint64_t offset = first * static_cast<uint64_t>(segmentBytes);
+    transfer(items.data(), count * segmentBytes, offset, false);
+
+    // Build every list before touching a segment
+    std::vector<LinkedList<T>> lists;
+    lists.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        lists.emplace_back();
+        for (uint32_t j = 0; j < mSegmentSize; ++j) {
+            lists.back().add(items[static_cast<size_t>(i) * mSegmentSize + j]);
+        }
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        Segment& segment = mSegments[first + i];
+        segment.mNodes.swap(lists[i]);
+        segment.mResident = true;
+        segment.mDirty = false;
+        segment.mLastUse = ++mClock;
+    }
+    mResident += count;
+    mStats.mSegmentsRead += count;
+    mStats.mBytesRead += count * segmentBytes;
+}
+
+/**
+ * Transfers bytes between the spill file at offset and buffer, throwing
+ * std::system_error on failure.
+ *
+ * @param buffer memory to read into or write from
+ * @param bytes number of bytes
+ * @param offset position in the file
+ * @param write true to write, false to read
+ */
+template <typename T>
+void SpillingLinkedList<T>::transfer(void* buffer, size_t bytes, uint64_t offset, bool write)
+{
+    int fd = fileno(mFile);
+    char* cursor = static_cast<char*>(buffer);
+    while (bytes > 0) {
+        ssize_t done = write ? pwrite(fd, cursor, bytes, static_cast<off_t>(offset))
+                             : pread(fd, cursor, bytes, static_cast<off_t>(offset));
+        if (done < 0 && errno == EINTR) {
+            continue;
+        }
+        if (done <= 0) {
+            throw std::system_error(done < 0 ? errno : EIO, std::generic_category(), "spill file");
+        }
+        cursor += done;
+        bytes -= static_cast<size_t>(done);
+        offset += static_cast<uint64_t>(done);
+    }
+}
+
+template <typename T>
+bool SpillingLinkedList<T>::const_iterator::operator==(const const_iterator& rhs) const noexcept
+{
+    return mList == rhs.mList && mIndex == rhs.mIndex;
+}
+
+template <typename T>
+bool SpillingLinkedList<T>::const_iterator::operator!=(const const_iterator& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+template <typename T> const T& SpillingLinkedList<T>::const_iterator::operator*() const noexcept
+{
+    return **mCurrent;
+}
+
+template <typename T> const T* SpillingLinkedList<T>::const_iterator::operator->() const noexcept
+{
+    return &**mCurrent;
+}
+
+template <typename T>
+typename SpillingLinkedList<T>::const_iterator& SpillingLinkedList<T>::const_iterator::operator++()
+{
+    uint32_t next = mIndex + 1;
+    if (next < mList->mSize) {
+        if (next % mList->mSegmentSize == 0) {
+            enterSegment(next);
+        } else {
+            ++*mCurrent;
+        }
+    }
+    mIndex = next;
+    return *this;
+}
+
+template <typename T>
+const typename SpillingLinkedList<T>::const_iterator
+SpillingLinkedList<T>::const_iterator::operator++(int)
+{
+    const_iterator previous(*this);
+    ++*this;
+    return previous;
+}
+
+template <typename T>
+SpillingLinkedList<T>::const_iterator::const_iterator(SpillingLinkedList<T>* list, uint32_t index)
+    : mList(list)
+    , mIndex(index)
+    , mCurrent()
+{
+    if (index < list->mSize) {
+        enterSegment(index);
+    }
+}
+
+/**
+ * Pages in the segment starting at element index and positions
+ * mCurrent on that element. mIndex is left to the caller.
+ */
+template <typename T> void SpillingLinkedList<T>::const_iterator::enterSegment(uint32_t index)
+{
+    const LinkedList<T>& nodes = mList->acquire(index / mList->mSegmentSize, true).mNodes;
+    mCurrent = nodes.begin();
+}
+#endif
@@ -0,0 +1,489 @@
+// SplitLinkedList.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef SPLIT_LINKED_LIST_CPP
+#define SPLIT_LINKED_LIST_CPP
+#include <SplitLinkedList.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+/**
+ * Initializes an empty SplitLinkedList.
+ * This operation provides strong exception safety.
+ */
+template <typename T>
+SplitLinkedList<T>::SplitLinkedList()
+    : mSize(0)
+    , mFree(0)
+    , mLinks(1, Link { 0, 0 })
+    , mItems(1)
+{
+}
+
+/**
+ * Initializes the SplitLinkedList to be a copy of src. The slot layout of src
+ * is copied as is, so this is two array copies rather than a traversal.
+ * This operation provides strong exception safety.
+ *
+ * @param src SplitLinkedList to copy
+ */
+template <typename T>
+SplitLinkedList<T>::SplitLinkedList(const SplitLinkedList<T>& src)
+    : mSize(src.mSize)
+    , mFree(src.mFree)
+    , mLinks(src.mLinks)
+    , mItems(src.mItems)
+{
+}
+
+/**
+ * Makes this object a copy of rhs. Note that calling this method on
+ * yourself (l = l;) is equivalent to a no-op.
+ * This operation provides strong exception safety.
+ *
+ * @param rhs SplitLinkedList to copy
+ * @return *this, used for chaining.
+ */
+template <typename T>
+SplitLinkedList<T>& SplitLinkedList<T>::operator=(const SplitLinkedList<T>& rhs)
+{
+    if (this != &rhs) {
+        SplitLinkedList<T> tmp(rhs);
+        swap(tmp);
+    }
+    return *this;
+}
+
+/**
+ * Destructor. Releases all resources held by this SplitLinkedList.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ */
+template <typename T> SplitLinkedList<T>::~SplitLinkedList() noexcept
+{
+}
+
+/**
+ * Adds value to the end of this SplitLinkedList in amortized constant
+ * time.
+ * This operation provides strong exception safety.
+ *
+ * @param value value to append to this SplitLinkedList
+ */
+template <typename T> void SplitLinkedList<T>::add(const T& value)
+{
+    insertBefore(0, value);
+}
+
+/**
+ * Inserts value at the specified index. All elements at or to the right of
+ * index are shifted down by one spot. If this SplitLinkedList needs to be
+ * enlarged (index is out of range) default values are used to fill the
+ * gaps.
+ * This operation provides strong exception safety.
+ *
+ * @param index index at which to insert value
+ * @param value the element to insert
+ */
+template <typename T> void SplitLinkedList<T>::add(uint32_t index, const T& value)
+{
+    if (index <= mSize) {
+        insertBefore(seek(index), value);
+        return;
+    }
+    uint32_t size = mSize;
+    try {
+        while (mSize < index) {
+            insertBefore(0, T());
+        }
+        insertBefore(0, value);
+    } catch (...) {
+        while (mSize > size) {
+            release(mLinks[0].mPrev);
+        }
+        throw;
+    }
+}
+
+/**
+ * Empties this SplitLinkedList returning it to the same state as the
+ * default constructor.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ */
+template <typename T> void SplitLinkedList<T>::clear() noexcept
+{
+    // Shrinking never allocates
+    mItems.resize(1);
+    mLinks.resize(1);
+    link(0, 0);
+    mFree = 0;
+    mSize = 0;
+}
+
+/**
+ * Returns a constant reference to the element stored at the provided index.
+ * If index is out of bounds, an std::out_of_range exception is thrown with
+ * the index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the element to return
+ * @return constant reference to the element at the index.
+ */
+template <typename T> const T& SplitLinkedList<T>::get(uint32_t index) const
+{
+    rangeCheck(index);
+    return *mItems[seek(index)];
+}
+
+/**
+ * Returns a reference to the element stored at the provided index. If index
+ * is out of bounds, an std::out_of_range exception is thrown with the index
+ * as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the element to return
+ * @return reference to the element at the index.
+ */
+template <typename T> T& SplitLinkedList<T>::get(uint32_t index)
+{
+    rangeCheck(index);
+    return *mItems[seek(index)];
+}
+
+/**
+ * Returns true if and only if this SplitLinkedList is logically equivalent
+ * to rhs, i.e. the size and contents are equal.
+ * This operation provides strong exception safety.
+ *
+ * @param rhs the SplitLinkedList being compared to
+ * @return true iff logically equivalent
+ */
+template <typename T> bool SplitLinkedList<T>::operator==(const SplitLinkedList<T>& rhs) const
+{
+    if (mSize != rhs.mSize) {
+        return false;
+    }
+    const_iterator rhsIter = rhs.begin();
+    for (const_iterator iter = begin(); iter != end(); ++iter, ++rhsIter) {
+        if (*iter != *rhsIter) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Returns false if this SplitLinkedList is equal to rhs and true otherwise.
+ * This operation provides strong exception safety.
+ *
+ * @param rhs the SplitLinkedList being compared to
+ * @return true iff not logically equivalent
+ */
+template <typename T> bool SplitLinkedList<T>::operator!=(const SplitLinkedList<T>& rhs) const
+{
+    return !(*this == rhs);
+}
+
+/**
+ * Returns a constant iterator to the beginning.
+ * This operation is a no-throw.
+ *
+ * @return const_iterator
+ */
+template <typename T>
+typename SplitLinkedList<T>::const_iterator SplitLinkedList<T>::begin() const noexcept
+{
+    return const_iterator(this, mLinks[0].mNext);
+}
+
+/**
+ * Returns an iterator to the beginning.
+ * This operation is a no-throw.
+ *
+ * @return iterator
+ */
+template <typename T> typename SplitLinkedList<T>::iterator SplitLinkedList<T>::begin() noexcept
+{
+    return iterator(this, mLinks[0].mNext);
+}
+
+/**
+ * Returns a constant iterator to the end.
+ * This operation is a no-throw.
+ *
+ * @return const_iterator
+ */
+template <typename T>
+typename SplitLinkedList<T>::const_iterator SplitLinkedList<T>::end() const noexcept
+{
+    return const_iterator(this, 0);
+}
+
+/**
+ * Returns an iterator to the end.
+ * This operation is a no-throw.
+ *
+ * @return iterator
+ */
+template <typename T> typename SplitLinkedList<T>::iterator SplitLinkedList<T>::end() noexcept
+{
+    return iterator(this, 0);
+}
+
+/**
+ * Returns true if this SplitLinkedList is empty and false otherwise.
+ * This operation is a no-throw.
+ *
+ * @return bool True when empty
+ */
+template <typename T> bool SplitLinkedList<T>::isEmpty() const noexcept
+{
+    return mSize == 0;
+}
+
+/**
+ * Removes the element at the specified index. If index is out of bounds
+ * an std::out_of_range exception is thrown with index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the object to remove.
+ */
+template <typename T> void SplitLinkedList<T>::remove(uint32_t index)
+{
+    rangeCheck(index);
+    release(seek(index));
+}
+
+/**
+ * Sets the element at the specified index to the provided value. If index
+ * is out of bounds, an std::out_of_range exception is thrown with the index
+ * as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the object to set
+ * @param value the new value
+ */
+template <typename T> void SplitLinkedList<T>::set(uint32_t index, const T& value)
+{
+    rangeCheck(index);
+    *mItems[seek(index)] = value;
+}
+
+/**
+ * Return the size of this SplitLinkedList.
+ * This operation is a no-throw.
+ *
+ * @return
+ */
+template <typename T> uint32_t SplitLinkedList<T>::size() const noexcept
+{
+    return mSize;
+}
+
+/**
+ * Given an index, this method throws an std::out_of_range with the index as
+ * its message if index is out of bounds or is a no-op otherwise.
+ * This operation provides strong exception safety.
+ *
+ * @param index index to check
+ */
+template <typename T> void SplitLinkedList<T>::rangeCheck(uint32_t index) const
+{
+    if (index >= mSize) {
+        throw std::out_of_range(std::to_string(index));
+    }
+}
+
+/**
+ * Returns the slot of the element at index, or of the dummy if index is
+ * size(), walking the link array only.
+ * This operation is a no-throw.
+ *
+ * @param index index of the element
+ * @return slot of the element
+ */
+template <typename T> uint32_t SplitLinkedList<T>::seek(uint32_t index) const noexcept
+{
+    uint32_t slot = mLinks[0].mNext;
+    for (; index > 0; --index) {
+        slot = mLinks[slot].mNext;
+    }
+    return slot;
+}
+
+/**
+ * Stores value in an unused slot and links it right before slot next.
+ * This operation provides strong exception safety.
+ *
+ * @param next slot of the element that will follow the new one
+ * @param value value to store
+ */
+template <typename T> void SplitLinkedList<T>::insertBefore(uint32_t next, const T& value)
+{
+    uint32_t slot = mFree;
+    if (slot != 0) {
+        mItems[slot].emplace(value);
+        mFree = mLinks[slot].mNext;
+    } else {
+        slot = static_cast<uint32_t>(mLinks.size());
+        mLinks.push_back(Link { 0, 0 });
+        try {
+            mItems.emplace_back(std::in_place, value);
+        } catch (...) {
+            mLinks.pop_back();
+            throw;
+        }
+    }
+    link(mLinks[next].mPrev, slot);
+    link(slot, next);
+    ++mSize;
+}
+
+/**
+ * Unlinks the element in slot, destroys its item and puts the slot on the
+ * free list.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ *
+ * @param slot slot of the element to release
+ */
+template <typename T> void SplitLinkedList<T>::release(uint32_t slot) noexcept
+{
+    link(mLinks[slot].mPrev, mLinks[slot].mNext);
+    mItems[slot].reset();
+    mLinks[slot].mNext = mFree;
+    mFree = slot;
+    --mSize;
+}
+
+/**
+ * Establishes the proper linkage between the provided slots.
+ * This operation is a no-throw.
+ */
+template <typename T> void SplitLinkedList<T>::link(uint32_t first, uint32_t second) noexcept
+{
+    mLinks[first].mNext = second;
+    mLinks[second].mPrev = first;
+}
+
+/**
+ * Swaps the contents of this SplitLinkedList with that of other in
+ * constant time.
+ * This operation is a no-throw.
+ *
+ * @param other the SplitLinkedList to swap with
+ */
+template <typename T> void SplitLinkedList<T>::swap(SplitLinkedList<T>& other) noexcept
+{
+    std::swap(mSize, other.mSize);
+    std::swap(mFree, other.mFree);
+    mLinks.swap(other.mLinks);
+    mItems.swap(other.mItems);
+}
+
+template <typename T>
+bool SplitLinkedListIterator<T>::operator==(const SplitLinkedListIterator<T>& rhs) const noexcept
+{
+    return mList == rhs.mList && mSlot == rhs.mSlot;
+}
+template <typename T>
+bool SplitLinkedListIterator<T>::operator!=(const SplitLinkedListIterator<T>& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+template <typename T> T& SplitLinkedListIterator<T>::operator*() const
+{
+    return *mList->mItems[mSlot];
+}
+template <typename T> T* SplitLinkedListIterator<T>::operator->() const
+{
+    return &*mList->mItems[mSlot];
+}
+template <typename T> SplitLinkedListIterator<T>& SplitLinkedListIterator<T>::operator++()
+{
+    mSlot = mList->mLinks[mSlot].mNext;
+    return *this;
+}
+template <typename T> const SplitLinkedListIterator<T> SplitLinkedListIterator<T>::operator++(int)
+{
+    SplitLinkedListIterator<T> temp(*this);
+    ++*this;
+    return temp;
+}
+template <typename T> SplitLinkedListIterator<T>& SplitLinkedListIterator<T>::operator--()
+{
+    mSlot = mList->mLinks[mSlot].mPrev;
+    return *this;
+}
+template <typename T> const SplitLinkedListIterator<T> SplitLinkedListIterator<T>::operator--(int)
+{
+    SplitLinkedListIterator<T> temp(*this);
+    --*this;
+    return temp;
+}
+template <typename T>
+SplitLinkedListIterator<T>::SplitLinkedListIterator(SplitLinkedList<T>* list, uint32_t slot)
+    : mList(list)
+    , mSlot(slot)
+{
+}
+
+template <typename T>
+bool SplitLinkedListConstIterator<T>::operator==(
+    const SplitLinkedListConstIterator<T>& rhs) const noexcept
+{
+    return mList == rhs.mList && mSlot == rhs.mSlot;
+}
+template <typename T>
+bool SplitLinkedListConstIterator<T>::operator!=(
+    const SplitLinkedListConstIterator<T>& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+template <typename T> const T& SplitLinkedListConstIterator<T>::operator*() const
+{
+    return *mList->mItems[mSlot];
+}
+template <typename T> const T* SplitLinkedListConstIterator<T>::operator->() const
+{
+    return &*mList->mItems[mSlot];
+}
+template <typename T>
+SplitLinkedListConstIterator<T>& SplitLinkedListConstIterator<T>::operator++()
+{
+    mSlot = mList->mLinks[mSlot].mNext;
+    return *this;
+}
+template <typename T>
+const SplitLinkedListConstIterator<T> SplitLinkedListConstIterator<T>::operator++(int)
+{
+    SplitLinkedListConstIterator<T> temp(*this);
+    ++*this;
+    return temp;
+}
+template <typename T>
+SplitLinkedListConstIterator<T>& SplitLinkedListConstIterator<T>::operator--()
+{
+    mSlot = mList->mLinks[mSlot].mPrev;
+    return *this;
+}
+template <typename T>
+const SplitLinkedListConstIterator<T> SplitLinkedListConstIterator<T>::operator--(int)
+{
+    SplitLinkedListConstIterator<T> temp(*this);
+    --*this;
+    return temp;
+}
+template <typename T>
+SplitLinkedListConstIterator<T>::SplitLinkedListConstIterator(
+    const SplitLinkedList<T>* list, uint32_t slot)
+    : mList(list)
+    , mSlot(slot)
+{
+}
+#endif
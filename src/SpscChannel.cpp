@@ -0,0 +1,241 @@
+// SpscChannel.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef SPSC_CHANNEL_CPP
+#define SPSC_CHANNEL_CPP
+#include <SpscChannel.h>
+#include <new>
+#include <utility>
+
+/**
+ * Initializes an empty SpscChannel.
+ * This operation provides strong exception safety.
+ */
+template <typename T>
+SpscChannel<T>::SpscChannel()
+    : mFront(nullptr)
+    , mBack(new Node())
+    , mFree(mBack)
+    , mFrontCopy(mBack)
+    , mNodeCount(1)
+{
+    mFront.store(mBack, std::memory_order_relaxed);
+}
+
+/**
+ * Destructor. Destroys the elements that have not been consumed and
+ * releases every node. Neither thread may be using the channel.
+ * This operation is no-throw under the assumption that the parameterizing
+ * type's destructor is no-throw.
+ */
+template <typename T> SpscChannel<T>::~SpscChannel() noexcept
+{
+    // Every node is on one chain: free nodes, the dummy, then full nodes
+    Node* front = mFront.load(std::memory_order_relaxed);
+    bool full = false;
+    for (Node* node = mFree; node != nullptr;) {
+        Node* next = node->mNext.load(std::memory_order_relaxed);
+        if (full) {
+            node->item()->~T();
+        }
+        full = full || node == front;
+        delete node;
+        node = next;
+    }
+}
+
+/**
+ * Appends a copy of value. Producer only.
+ * This operation provides strong exception safety.
+ *
+ * @param value value to send
+ */
+template <typename T> void SpscChannel<T>::push(const T& value)
+{
+    Node* node = acquire();
+    try {
+        ::new (static_cast<void*>(node->mStorage)) T(value);
+    } catch (...) {
+        recycle(node);
+        throw;
+    }
+    node->mNext.store(nullptr, std::memory_order_relaxed);
+    mBack->mNext.store(node, std::memory_order_release);
+    mBack = node;
+}
+
+/**
+ * Appends copies of the elements of [first, last) and makes them visible
+ * to the consumer at once. Producer only.
+ * This operation provides strong exception safety.
+ *
+ * @param first iterator to the first element to send
+ * @param last iterator past the last element to send
+ */
+template <typename T>
+template <typename InputIterator>
+void SpscChannel<T>::pushBatch(InputIterator first, InputIterator last)
+{
+    Node* head = nullptr;
+    Node* tail = nullptr;
+    try {
+        for (; first != last; ++first) {
+            Node* node = acquire();
+            try {
+                ::new (static_cast<void*>(node->mStorage)) T(*first);
+            } catch (...) {
+                recycle(node);
+                throw;
+            }
+            node->mNext.store(nullptr, std::memory_order_relaxed);
+            if (tail == nullptr) {
+                head = node;
+            } else {
+                tail->mNext.store(node, std::memory_order_relaxed);
+            }
+            tail = node;
+        }
+    } catch (...) {
+        // Return the unpublished nodes to the free list
+        while (head != nullptr) {
+            Node* next = head->mNext.load(std::memory_order_relaxed);
+            head->item()->~T();
+            recycle(head);
+            head = next;
+        }
+        throw;
+    }
+    if (head != nullptr) {
+        mBack->mNext.store(head, std::memory_order_release);
+        mBack = tail;
+    }
+}
+
+/**
+ * Moves the oldest element into value if there is one. Consumer only.
+ * This operation provides strong exception safety, provided T's move
+ * assignment does.
+ *
+ * @param value receives the element
+ * @return true iff an element was received
+ */
+template <typename T> bool SpscChannel<T>::tryPop(T& value)
+{
+    Node* front = mFront.load(std::memory_order_relaxed);
+    Node* next = front->mNext.load(std::memory_order_acquire);
+    if (next == nullptr) {
+        return false;
+    }
+    value = std::move(*next->item());
+    next->item()->~T();
+    // Hands front over to the producer's free list
+    mFront.store(next, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Moves up to max of the oldest elements to out, in order. Consumer only.
+ * If moving an element throws, the elements moved before it are consumed
+ * and the rest stay in the channel.
+ * This operation provides basic exception safety.
+ *
+ * @param out output iterator receiving the elements
+ * @param max maximum number of elements to receive
+ * @return number of elements received
+ */
+template <typename T>
+template <typename OutputIterator>
+size_t SpscChannel<T>::popBatch(OutputIterator out, size_t max)
+{
+    Node* front = mFront.load(std::memory_order_relaxed);
+    size_t count = 0;
+    try {
+        for (; count < max; ++count) {
+            Node* next = front->mNext.load(std::memory_order_acquire);
+            if (next == nullptr) {
+                break;
+            }
+            *out = std::move(*next->item());
+            ++out;
+            next->item()->~T();
+            front = next;
+        }
+    } catch (...) {
+        mFront.store(front, std::memory_order_release);
+        throw;
+    }
+    mFront.store(front, std::memory_order_release);
+    return count;
+}
+
+/**
+ * Returns true if the consumer has nothing to receive right now. Consumer
+ * only.
+ * This operation is a no-throw.
+ *
+ * @return bool True when empty
+ */
+template <typename T> bool SpscChannel<T>::isEmpty() const noexcept
+{
+    return mFront.load(std::memory_order_relaxed)->mNext.load(std::memory_order_acquire)
+        == nullptr;
+}
+
+/**
+ * Returns the number of nodes the producer has allocated so far, which
+ * stops growing once drained nodes are being reused.
+ * This operation is a no-throw.
+ *
+ * @return number of allocated nodes
+ */
+template <typename T> size_t SpscChannel<T>::nodeCount() const noexcept
+{
+    return mNodeCount;
+}
+
+/**
+ * Returns a node from the free list or a new one. The node's mNext is
+ * unspecified. Producer only.
+ * This operation provides strong exception safety.
+ */
+template <typename T> typename SpscChannel<T>::Node* SpscChannel<T>::acquire()
+{
+    if (mFree == mFrontCopy) {
+        // Only look at the consumer's position when the cached one is used up
+        mFrontCopy = mFront.load(std::memory_order_acquire);
+    }
+    if (mFree != mFrontCopy) {
+        Node* node = mFree;
+        mFree = node->mNext.load(std::memory_order_relaxed);
+        return node;
+    }
+    Node* node = new Node();
+    ++mNodeCount;
+    return node;
+}
+
+/**
+ * Puts a node obtained from acquire() back at the front of the free
+ * list. Producer only.
+ * This operation is a no-throw.
+ */
+template <typename T> void SpscChannel<T>::recycle(Node* node) noexcept
+{
+    node->mNext.store(mFree, std::memory_order_relaxed);
+    mFree = node;
+}
+
+template <typename T>
+SpscChannel<T>::Node::Node() noexcept
+    : mNext(nullptr)
+{
+}
+
+template <typename T> T* SpscChannel<T>::Node::item() noexcept
+{
+    return std::launder(reinterpret_cast<T*>(mStorage));
+}
+#endif
@@ -0,0 +1,537 @@
+// StaticLinkedList.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef STATIC_LINKED_LIST_CPP
+#define STATIC_LINKED_LIST_CPP
+#include <StaticLinkedList.h>
+#include <stdexcept>
+#include <string>
+
+/**
+ * Initializes an empty StaticLinkedList. Every item slot is
+ * default-constructed.
+ * This operation provides strong exception safety.
+ */
+template <typename T, uint32_t N>
+constexpr StaticLinkedList<T, N>::StaticLinkedList()
+    : mSize(0)
+    , mFree(0)
+    , mUsed(0)
+    , mLinks()
+    , mItems()
+{
+}
+
+/**
+ * Adds value to the end of this StaticLinkedList in constant time. If the
+ * list is full, an std::length_error exception is thrown.
+ * This operation provides strong exception safety.
+ *
+ * @param value value to append to this StaticLinkedList
+ */
+template <typename T, uint32_t N> constexpr void StaticLinkedList<T, N>::add(const T& value)
+{
+    insertBefore(0, value);
+}
+
+/**
+ * Inserts value at the specified index. All elements at or to the right of
+ * index are shifted down by one spot. If this StaticLinkedList needs to be
+ * enlarged (index is out of range) default values are used to fill the
+ * gap. If the elements do not fit, an std::length_error exception is
+ * thrown.
+ * This operation provides strong exception safety.
+ *
+ * @param index index at which to insert value
+ * @param value the element to insert
+ */
+template <typename T, uint32_t N>
+constexpr void StaticLinkedList<T, N>::add(uint32_t index, const T& value)
+{
+    if (index <= mSize) {
+        insertBefore(seek(index), value);
+        return;
+    }
+    uint32_t gap = index - mSize;
+    capacityCheck(static_cast<uint64_t>(gap) + 1);
+    // Store the new items in the slots acquire() will hand out, in that
+    // order, before linking any of them
+    uint32_t slot = mFree;
+    uint32_t fresh = mUsed;
+    for (uint32_t i = 0; i <= gap; ++i) {
+        uint32_t target = slot;
+        if (slot != 0) {
+            slot = mLinks[slot].mNext;
+        } else {
+            target = ++fresh;
+        }
+        if (i == gap) {
+            item(target) = value;
+        } else {
+            item(target) = T();
+        }
+    }
+    for (uint32_t i = 0; i <= gap; ++i) {
+        uint32_t added = acquire();
+        link(mLinks[0].mPrev, added);
+        link(added, 0);
+    }
+    mSize = index + 1;
+}
+
+/**
+ * Empties this StaticLinkedList in constant time, returning it to the same
+ * state as the default constructor (except for the item values left in
+ * the slots).
+ * This operation is a no-throw.
+ */
+template <typename T, uint32_t N> constexpr void StaticLinkedList<T, N>::clear() noexcept
+{
+    mSize = 0;
+    mFree = 0;
+    mUsed = 0;
+    link(0, 0);
+}
+
+/**
+ * Returns a constant reference to the element stored at the provided index.
+ * If index is out of bounds, an std::out_of_range exception is thrown with
+ * the index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the element to return
+ * @return constant reference to the element at the index.
+ */
+template <typename T, uint32_t N>
+constexpr const T& StaticLinkedList<T, N>::get(uint32_t index) const
+{
+    rangeCheck(index);
+    return item(seek(index));
+}
+
+/**
+ * Returns a reference to the element stored at the provided index. If index
+ * is out of bounds, an std::out_of_range exception is thrown with the index
+ * as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the element to return
+ * @return reference to the element at the index.
+ */
+template <typename T, uint32_t N> constexpr T& StaticLinkedList<T, N>::get(uint32_t index)
+{
+    rangeCheck(index);
+    return item(seek(index));
+}
+
+/**
+ * Returns true if and only if this StaticLinkedList is logically
+ * equivalent to rhs, i.e. the size and contents are equal.
+ * This operation provides strong exception safety.
+ *
+ * @param rhs the StaticLinkedList being compared to
+ * @return true iff logically equivalent
+ */
+template <typename T, uint32_t N>
+constexpr bool StaticLinkedList<T, N>::operator==(const StaticLinkedList<T, N>& rhs) const
+{
+    if (mSize != rhs.mSize) {
+        return false;
+    }
+    const_iterator rhsIter = rhs.begin();
+    for (const_iterator iter = begin(); iter != end(); ++iter, ++rhsIter) {
+        if (*iter != *rhsIter) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Returns false if this StaticLinkedList is equal to rhs and true
+ * otherwise.
+ * This operation provides strong exception safety.
+ *
+ * @param rhs the StaticLinkedList being compared to
+ * @return true iff not logically equivalent
+ */
+template <typename T, uint32_t N>
+constexpr bool StaticLinkedList<T, N>::operator!=(const StaticLinkedList<T, N>& rhs) const
+{
+    return !(*this == rhs);
+}
+
+/**
+ * Returns a constant iterator to the beginning.
+ * This operation is a no-throw.
+ *
+ * @return const_iterator
+ */
+template <typename T, uint32_t N>
+constexpr StaticLinkedListConstIterator<T, N> StaticLinkedList<T, N>::begin() const noexcept
+{
+    return const_iterator(this, mLinks[0].mNext);
+}
+
+/**
+ * Returns an iterator to the beginning.
+ * This operation is a no-throw.
+ *
+ * @return iterator
+ */
+template <typename T, uint32_t N>
+constexpr StaticLinkedListIterator<T, N> StaticLinkedList<T, N>::begin() noexcept
+{
+    return iterator(this, mLinks[0].mNext);
+}
+
+/**
+ * Returns a constant iterator to the end.
+ * This operation is a no-throw.
+ *
+ * @return const_iterator
+ */
+template <typename T, uint32_t N>
+constexpr StaticLinkedListConstIterator<T, N> StaticLinkedList<T, N>::end() const noexcept
+{
+    return const_iterator(this, 0);
+}
+
+/**
+ * Returns an iterator to the end.
+ * This operation is a no-throw.
+ *
+ * @return iterator
+ */
+template <typename T, uint32_t N>
+constexpr StaticLinkedListIterator<T, N> StaticLinkedList<T, N>::end() noexcept
+{
+    return iterator(this, 0);
+}
+
+/**
+ * Returns true if this StaticLinkedList is empty and false otherwise.
+ * This operation is a no-throw.
+ *
+ * @return bool True when empty
+ */
+template <typename T, uint32_t N> constexpr bool StaticLinkedList<T, N>::isEmpty() const noexcept
+{
+    return mSize == 0;
+}
+
+/**
+ * Returns true if this StaticLinkedList holds capacity() elements, so that
+ * adding another one would throw.
+ * This operation is a no-throw.
+ *
+ * @return bool True when full
+ */
+template <typename T, uint32_t N> constexpr bool StaticLinkedList<T, N>::isFull() const noexcept
+{
+    return mSize == N;
+}
+
+/**
+ * Removes the element at the specified index. If index is out of bounds
+ * an std::out_of_range exception is thrown with index as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the object to remove.
+ */
+template <typename T, uint32_t N> constexpr void StaticLinkedList<T, N>::remove(uint32_t index)
+{
+    rangeCheck(index);
+    uint32_t slot = seek(index);
+    link(mLinks[slot].mPrev, mLinks[slot].mNext);
+    mLinks[slot].mNext = mFree;
+    mFree = slot;
+    --mSize;
+}
+
+/**
+ * Sets the element at the specified index to the provided value. If index
+ * is out of bounds, an std::out_of_range exception is thrown with the index
+ * as its message.
+ * This operation provides strong exception safety.
+ *
+ * @param index index of the object to set
+ * @param value the new value
+ */
+template <typename T, uint32_t N>
+constexpr void StaticLinkedList<T, N>::set(uint32_t index, const T& value)
+{
+    rangeCheck(index);
+    item(seek(index)) = value;
+}
+
+/**
+ * Return the size of this StaticLinkedList.
+ * This operation is a no-throw.
+ *
+ * @return
+ */
+template <typename T, uint32_t N> constexpr uint32_t StaticLinkedList<T, N>::size() const noexcept
+{
+    return mSize;
+}
+
+/**
+ * Returns the maximum number of elements, N.
+ * This operation is a no-throw.
+ *
+ * @return capacity
+ */
+template <typename T, uint32_t N> constexpr uint32_t StaticLinkedList<T, N>::capacity() noexcept
+{
+    return N;
+}
+
+/**
+ * Given an index, this method throws an std::out_of_range with the index as
+ * its message if index is out of bounds or is a no-op otherwise.
+ * This operation provides strong exception safety.
+ *
+ * @param index index to check
+ */
+template <typename T, uint32_t N>
+constexpr void StaticLinkedList<T, N>::rangeCheck(uint32_t index) const
+{
+    if (index >= mSize) {
+        throw std::out_of_range(std::to_string(index));
+    }
+}
+
+/**
+ * Throws an std::length_error with the capacity as its message unless
+ * count more elements fit.
+ * This operation provides strong exception safety.
+ *
+ * @param count number of elements about to be added
+ */
+template <typename T, uint32_t N>
+constexpr void StaticLinkedList<T, N>::capacityCheck(uint64_t count) const
+{
+    if (count > N - mSize) {
+        throw std::length_error(std::to_string(N));
+    }
+}
+
+/**
+ * Returns the slot of the element at index, or of the dummy if index is
+ * size(), walking from whichever end of the list is closer.
+ * This operation is a no-throw.
+ *
+ * @param index index of the element
+ * @return slot of the element
+ */
+template <typename T, uint32_t N>
+constexpr uint32_t StaticLinkedList<T, N>::seek(uint32_t index) const noexcept
+{
+    uint32_t slot = 0;
+    if (index <= mSize / 2) {
+        for (slot = mLinks[0].mNext; index > 0; --index) {
+            slot = mLinks[slot].mNext;
+        }
+    } else {
+        for (index = mSize - index; index > 0; --index) {
+            slot = mLinks[slot].mPrev;
+        }
+    }
+    return slot;
+}
+
+/**
+ * Stores value in an unused slot and links it right before slot next. If
+ * the list is full, an std::length_error exception is thrown.
+ * This operation provides strong exception safety.
+ *
+ * @param next slot of the element that will follow the new one
+ * @param value value to store
+ */
+template <typename T, uint32_t N>
+constexpr void StaticLinkedList<T, N>::insertBefore(uint32_t next, const T& value)
+{
+    capacityCheck(1);
+    // The slot is not taken until the item has been stored
+    item(peek()) = value;
+    uint32_t slot = acquire();
+    link(mLinks[next].mPrev, slot);
+    link(slot, next);
+    ++mSize;
+}
+
+/**
+ * Returns the slot the next call to acquire() will return, without
+ * taking it.
+ * This operation is a no-throw.
+ *
+ * @pre !isFull()
+ */
+template <typename T, uint32_t N> constexpr uint32_t StaticLinkedList<T, N>::peek() const noexcept
+{
+    return mFree != 0 ? mFree : mUsed + 1;
+}
+
+/**
+ * Takes an unused slot, from the free list if possible.
+ * This operation is a no-throw.
+ *
+ * @pre !isFull()
+ */
+template <typename T, uint32_t N> constexpr uint32_t StaticLinkedList<T, N>::acquire() noexcept
+{
+    if (mFree == 0) {
+        return ++mUsed;
+    }
+    uint32_t slot = mFree;
+    mFree = mLinks[slot].mNext;
+    return slot;
+}
+
+/**
+ * Establishes the proper linkage between the provided slots.
+ * This operation is a no-throw.
+ */
+template <typename T, uint32_t N>
+constexpr void StaticLinkedList<T, N>::link(uint32_t first, uint32_t second) noexcept
+{
+    mLinks[first].mNext = second;
+    mLinks[second].mPrev = first;
+}
+
+/**
+ * Returns the item of slot (which must not be the dummy).
+ * This operation is a no-throw.
+ */
+template <typename T, uint32_t N> constexpr T& StaticLinkedList<T, N>::item(uint32_t slot) noexcept
+{
+    return mItems[slot - 1];
+}
+template <typename T, uint32_t N>
+constexpr const T& StaticLinkedList<T, N>::item(uint32_t slot) const noexcept
+{
+    return mItems[slot - 1];
+}
+
+template <typename T, uint32_t N>
+constexpr bool StaticLinkedListIterator<T, N>::operator==(
+    const StaticLinkedListIterator<T, N>& rhs) const noexcept
+{
+    return mSlot == rhs.mSlot;
+}
+template <typename T, uint32_t N>
+constexpr bool StaticLinkedListIterator<T, N>::operator!=(
+    const StaticLinkedListIterator<T, N>& rhs) const noexcept
+{
+    return mSlot != rhs.mSlot;
+}
+template <typename T, uint32_t N>
+constexpr T& StaticLinkedListIterator<T, N>::operator*() const noexcept
+{
+    return mList->item(mSlot);
+}
+template <typename T, uint32_t N>
+constexpr T* StaticLinkedListIterator<T, N>::operator->() const noexcept
+{
+    return &mList->item(mSlot);
+}
+template <typename T, uint32_t N>
+constexpr StaticLinkedListIterator<T, N>& StaticLinkedListIterator<T, N>::operator++() noexcept
+{
+    mSlot = mList->mLinks[mSlot].mNext;
+    return *this;
+}
+template <typename T, uint32_t N>
+constexpr const StaticLinkedListIterator<T, N> StaticLinkedListIterator<T, N>::operator++(
+    int) noexcept
+{
+    StaticLinkedListIterator<T, N> temp(*this);
+    ++*this;
+    return temp;
+}
+template <typename T, uint32_t N>
+constexpr StaticLinkedListIterator<T, N>& StaticLinkedListIterator<T, N>::operator--() noexcept
+{
+    mSlot = mList->mLinks[mSlot].mPrev;
+    return *this;
+}
+template <typename T, uint32_t N>
+constexpr const StaticLinkedListIterator<T, N> StaticLinkedListIterator<T, N>::operator--(
+    int) noexcept
+{
+    StaticLinkedListIterator<T, N> temp(*this);
+    --*this;
+    return temp;
+}
+template <typename T, uint32_t N>
+constexpr StaticLinkedListIterator<T, N>::StaticLinkedListIterator(
+    StaticLinkedList<T, N>* list, uint32_t slot) noexcept
+    : mList(list)
+    , mSlot(slot)
+{
+}
+
+template <typename T, uint32_t N>
+constexpr bool StaticLinkedListConstIterator<T, N>::operator==(
+    const StaticLinkedListConstIterator<T, N>& rhs) const noexcept
+{
+    return mSlot == rhs.mSlot;
+}
+template <typename T, uint32_t N>
+constexpr bool StaticLinkedListConstIterator<T, N>::operator!=(
+    const StaticLinkedListConstIterator<T, N>& rhs) const noexcept
+{
+    return mSlot != rhs.mSlot;
+}
+template <typename T, uint32_t N>
+constexpr const T& StaticLinkedListConstIterator<T, N>::operator*() const noexcept
+{
+    return mList->item(mSlot);
+}
+template <typename T, uint32_t N>
+constexpr const T* StaticLinkedListConstIterator<T, N>::operator->() const noexcept
+{
+    return &mList->item(mSlot);
+}
+template <typename T, uint32_t N>
+constexpr StaticLinkedListConstIterator<T, N>&
+StaticLinkedListConstIterator<T, N>::operator++() noexcept
+{
+    mSlot = mList->mLinks[mSlot].mNext;
+    return *this;
+}
+template <typename T, uint32_t N>
+constexpr const StaticLinkedListConstIterator<T, N>
+StaticLinkedListConstIterator<T, N>::operator++(int) noexcept
+{
+    StaticLinkedListConstIterator<T, N> temp(*this);
+    ++*this;
+    return temp;
+}
+template <typename T, uint32_t N>
+constexpr StaticLinkedListConstIterator<T, N>&
+StaticLinkedListConstIterator<T, N>::operator--() noexcept
+{
+    mSlot = mList->mLinks[mSlot].mPrev;
+    return *this;
+}
+template <typename T, uint32_t N>
+constexpr const StaticLinkedListConstIterator<T, N>
+StaticLinkedListConstIterator<T, N>::operator--(int) noexcept
+{
+    StaticLinkedListConstIterator<T, N> temp(*this);
+    --*this;
+    return temp;
+}
+template <typename T, uint32_t N>
+constexpr StaticLinkedListConstIterator<T, N>::StaticLinkedListConstIterator(
+    const StaticLinkedList<T, N>* list, uint32_t slot) noexcept
+    : mList(list)
+    , mSlot(slot)
+{
+}
+#endif
@@ -0,0 +1,249 @@
+// TimingWheel.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef TIMING_WHEEL_CPP
+#define TIMING_WHEEL_CPP
+#include <TimingWheel.h>
+
+template <typename T>
+TimingWheel<T>::Handle::Handle(LinkedListIterator<Timer> timer) noexcept
+    : mTimer(timer)
+{
+}
+
+/**
+ * Initializes an empty TimingWheel whose clock reads now.
+ * This operation provides strong exception safety.
+ *
+ * @param now initial value of the clock, in ticks
+ */
+template <typename T>
+TimingWheel<T>::TimingWheel(uint64_t now)
+    : mNow(now)
+    , mSize(0)
+    , mPending()
+    , mBuckets(kLevels * kSlots)
+    , mExpired()
+    , mFiring()
+{
+}
+
+/**
+ * Schedules item to expire once the clock reaches deadline and returns
+ * a handle to the timer. A deadline that has already passed expires on
+ * the next tick. This operation completes in constant time.
+ * This operation provides strong exception safety.
+ *
+ * @param deadline tick at which to expire the timer
+ * @param item item to hand to the expiry callback
+ * @return handle to the timer, for cancel()
+ */
+template <typename T>
+typename TimingWheel<T>::Handle TimingWheel<T>::schedule(uint64_t deadline, const T& item)
+{
+    if (deadline <= mNow) {
+        deadline = mNow + 1;
+    }
+    unsigned level = levelOf(deadline);
+    LinkedList<Timer>& timers = bucket(level, deadline);
+    timers.add(Timer { deadline, item });
+    ++mPending[level];
+    ++mSize;
+    return Handle(--timers.end());
+}
+
+/**
+ * Cancels the timer timer refers to in constant time, so that it never
+ * expires. timer must refer to a timer of this TimingWheel that has not
+ * expired nor been cancelled; a timer may however cancel itself, or any
+ * other timer, from its expiry callback.
+ * This operation is no-throw under the assumption that the
+ * parameterizing type's destructor is no-throw.
+ *
+ * @param timer handle returned by schedule()
+ */
+template <typename T> void TimingWheel<T>::cancel(Handle timer) noexcept
+{
+    // Cascading keeps every timer at the level and slot its deadline maps
+    // to at the current tick, so its bucket need not be stored
+    uint64_t deadline = timer.mTimer->mDeadline;
+    if (deadline > mNow) {
+        unsigned level = levelOf(deadline);
+        bucket(level, deadline).erase(timer.mTimer);
+        --mPending[level];
+    } else if (timer.mTimer == mFiring.begin()) {
+        return;
+    } else {
+        mExpired.erase(timer.mTimer);
+    }
+    --mSize;
+}
+
+/**
+ * Moves the clock forward to now, one tick at a time, and calls expire
+ * with a reference to the item of every timer whose deadline is reached,
+ * in order of deadline (timers that share a deadline expire in an
+ * unspecified order). expire may schedule and cancel timers but must not
+ * advance this TimingWheel. Stretches of ticks in which no timer can
+ * expire are skipped. Nothing happens if now is not ahead of the clock.
+ * This operation provides basic exception safety: if expire throws, the
+ * timer it was called for is discarded, the clock stays at its deadline
+ * and the other timers due then expire on the next call.
+ *
+ * @param now new value of the clock, in ticks
+ * @param expire callable taking a T&
+ */
+template <typename T>
+template <typename Expire>
+void TimingWheel<T>::advance(uint64_t now, Expire expire)
+{
+    // A timer whose callback threw is dropped here
+    mFiring.clear();
+    while (!mExpired.isEmpty() || mNow < now) {
+        if (mExpired.isEmpty()) {
+            unsigned level = 0;
+            while (level < kLevels && mPending[level] == 0) {
+                ++level;
+            }
+            if (level == kLevels) {
+                mNow = now;
+                return;
+            }
+            if (level > 0) {
+                // Below level everything is empty, so nothing happens until
+                // the clock reaches the next slot of level
+                uint64_t last = mNow | ((uint64_t(1) << (kSlotBits * level)) - 1);
+                if (last >= now) {
+                    mNow = now;
+                    return;
+                }
+                mNow = last;
+            }
+            tick();
+        }
+        while (!mExpired.isEmpty()) {
+            mFiring.splice(mFiring.end(), mExpired, mExpired.begin());
+            --mSize;
+            expire(mFiring.begin()->mItem);
+            mFiring.clear();
+        }
+    }
+}
+
+/**
+ * Returns the current value of the clock, in ticks.
+ * This operation is a no-throw.
+ *
+ * @return current tick
+ */
+template <typename T> uint64_t TimingWheel<T>::now() const noexcept
+{
+    return mNow;
+}
+
+/**
+ * Returns the number of timers that have neither expired nor been
+ * cancelled.
+ * This operation is a no-throw.
+ *
+ * @return number of pending timers
+ */
+template <typename T> size_t TimingWheel<T>::size() const noexcept
+{
+    return mSize;
+}
+
+/**
+ * Returns true if no timer is pending and false otherwise.
+ * This operation is a no-throw.
+ *
+ * @return bool True when empty
+ */
+template <typename T> bool TimingWheel<T>::isEmpty() const noexcept
+{
+    return mSize == 0;
+}
+
+/**
+ * Returns the level at which a timer with the given deadline, which
+ * must be ahead of the clock, belongs: the position of the highest
+ * digit in which the deadline and the clock differ.
+ * This operation is a no-throw.
+ *
+ * @param deadline deadline of the timer
+ * @return level of the timer
+ */
+template <typename T> unsigned TimingWheel<T>::levelOf(uint64_t deadline) const noexcept
+{
+    uint64_t differ = (deadline ^ mNow) >> kSlotBits;
+    unsigned level = 0;
+    while (differ != 0) {
+        differ >>= kSlotBits;
+        ++level;
+    }
+    return level;
+}
+
+/**
+ * Returns the bucket of level holding timers with the given deadline.
+ * This operation is a no-throw.
+ *
+ * @param level level of the bucket
+ * @param deadline deadline of the timers
+ * @return bucket
+ */
+template <typename T>
+LinkedList<typename TimingWheel<T>::Timer>& TimingWheel<T>::bucket(
+    unsigned level, uint64_t deadline) noexcept
+{
+    return mBuckets[level * kSlots + ((deadline >> (kSlotBits * level)) & (kSlots - 1))];
+}
+
+/**
+ * Moves the clock forward by one tick: cascades the buckets whose slot
+ * starts at the new tick, from the highest level down, and appends the
+ * level-0 bucket due to mExpired.
+ * This operation is a no-throw.
+ */
+template <typename T> void TimingWheel<T>::tick() noexcept
+{
+    ++mNow;
+    unsigned top = 0;
+    while (top + 1 < kLevels && (mNow & ((uint64_t(1) << (kSlotBits * (top + 1))) - 1)) == 0) {
+        ++top;
+    }
+    for (unsigned level = top; level > 0; --level) {
+        cascade(level);
+    }
+    LinkedList<Timer>& due = bucket(0, mNow);
+    mPending[0] -= due.size();
+    mExpired.splice(mExpired.end(), due);
+}
+
+/**
+ * Redistributes the timers of the bucket of level whose slot starts at
+ * the current tick over the levels below it.
+ * This operation is a no-throw.
+ *
+ * @param level level to cascade (at least 1)
+ */
+template <typename T> void TimingWheel<T>::cascade(unsigned level) noexcept
+{
+    LinkedList<Timer>& timers = bucket(level, mNow);
+    mPending[level] -= timers.size();
+    while (!timers.isEmpty()) {
+        // The buckets hold no runs of default values, so the splice never
+        // allocates
+        LinkedListIterator<Timer> timer = timers.begin();
+        uint64_t deadline = timer->mDeadline;
+        unsigned target = levelOf(deadline);
+        LinkedList<Timer>& into = bucket(target, deadline);
+        into.splice(into.end(), timers, timer);
+        ++mPending[target];
+    }
+}
+
+#endif
@@ -0,0 +1,209 @@
+// aggregateListTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "AggregateList.h"
+#include "fragile.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Concatenation is associative but not commutative, so it catches aggregates
+// that combine elements out of order.
+struct ConcatMonoid {
+    static std::string identity()
+    {
+        return "";
+    }
+
+    static std::string combine(const std::string& lhs, const std::string& rhs)
+    {
+        return lhs + rhs;
+    }
+};
+
+// Sums Fragile values; combine throws while failing is set.
+struct FragileSum {
+    static bool failing;
+
+    static Fragile identity()
+    {
+        return Fragile();
+    }
+
+    static Fragile combine(const Fragile& lhs, const Fragile& rhs)
+    {
+        if (failing) {
+            throw std::runtime_error("combine");
+        }
+        return Fragile(lhs.mValue + rhs.mValue);
+    }
+};
+
+bool FragileSum::failing = false;
+
+// The fixture for testing AggregateList.
+class AggregateListTest : public ::testing::Test {
+};
+
+TEST_F(AggregateListTest, SumTracksMutations)
+{
+    AggregateList<int> list;
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.aggregate(), 0);
+    for (int i = 1; i <= 10; ++i) {
+        list.add(i);
+    }
+    EXPECT_EQ(list.size(), 10U);
+    EXPECT_EQ(list.aggregate(), 55);
+
+    list.set(0, 100);
+    EXPECT_EQ(list.aggregate(), 154);
+    list.remove(9);
+    EXPECT_EQ(list.aggregate(), 144);
+    list.add(0, -44);
+    EXPECT_EQ(list.get(0), -44);
+    EXPECT_EQ(list.get(1), 100);
+    EXPECT_EQ(list.aggregate(), 100);
+
+    // Gap filling uses default values
+    list.add(15, 5);
+    EXPECT_EQ(list.size(), 16U);
+    EXPECT_EQ(list.get(12), 0);
+    EXPECT_EQ(list.aggregate(), 105);
+
+    list.clear();
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.aggregate(), 0);
+
+    EXPECT_THROW(list.get(0), std::out_of_range);
+    EXPECT_THROW(list.remove(0), std::out_of_range);
+    EXPECT_THROW(list.set(0, 1), std::out_of_range);
+}
+
+TEST_F(AggregateListTest, MinMaxSurviveRemovals)
+{
+    AggregateList<int, MinMonoid<int>> minList;
+    AggregateList<int, MaxMonoid<int>> maxList;
+    const int data[] = { 5, 3, 9, 1, 7, 1, 8 };
+    for (int value : data) {
+        minList.add(value);
+        maxList.add(value);
+    }
+    EXPECT_EQ(minList.aggregate(), 1);
+    EXPECT_EQ(maxList.aggregate(), 9);
+
+    // Removing one of the two minima keeps the other
+    minList.remove(3);
+    EXPECT_EQ(minList.aggregate(), 1);
+    minList.remove(4);
+    EXPECT_EQ(minList.aggregate(), 3);
+
+    maxList.remove(2);
+    EXPECT_EQ(maxList.aggregate(), 8);
+    maxList.set(5, 2);
+    EXPECT_EQ(maxList.aggregate(), 7);
+}
+
+TEST_F(AggregateListTest, RangeAggregatesMatchBruteForce)
+{
+    AggregateList<long> list;
+    std::vector<long> mirror;
+    unsigned seed = 12345;
+    auto next = [&seed]() {
+        seed = seed * 1103515245U + 12345U;
+        return seed >> 8;
+    };
+    for (int step = 0; step < 2000; ++step) {
+        unsigned op = next() % 4;
+        if (op < 2 || mirror.empty()) {
+            uint32_t index = next() % (mirror.size() + 1);
+            long value = static_cast<long>(next() % 1000) - 500;
+            list.add(index, value);
+            mirror.insert(mirror.begin() + index, value);
+        } else if (op == 2) {
+            uint32_t index = next() % mirror.size();
+            list.remove(index);
+            mirror.erase(mirror.begin() + index);
+        } else {
+            uint32_t index = next() % mirror.size();
+            long value = static_cast<long>(next() % 1000);
+            list.set(index, value);
+            mirror[index] = value;
+        }
+        uint32_t first = next() % (mirror.size() + 1);
+        uint32_t last = first + next() % (mirror.size() - first + 1);
+        long expected = 0;
+        for (uint32_t i = first; i < last; ++i) {
+            expected += mirror[i];
+        }
+        ASSERT_EQ(list.aggregate(first, last), expected);
+    }
+    ASSERT_EQ(list.size(), mirror.size());
+    EXPECT_TRUE(std::equal(mirror.begin(), mirror.end(), list.begin()));
+    EXPECT_THROW(list.aggregate(0, list.size() + 1), std::out_of_range);
+    EXPECT_THROW(list.aggregate(2, 1), std::out_of_range);
+}
+
+TEST_F(AggregateListTest, CustomMonoidKeepsOrder)
+{
+    AggregateList<std::string, ConcatMonoid> list;
+    list.add("c");
+    list.add(0, "a");
+    list.add(1, "b");
+    list.add("d");
+    EXPECT_EQ(list.aggregate(), "abcd");
+    EXPECT_EQ(list.aggregate(1, 3), "bc");
+
+    AggregateList<std::string, ConcatMonoid> copy(list);
+    list.remove(0);
+    EXPECT_EQ(list.aggregate(), "bcd");
+    EXPECT_EQ(copy.aggregate(), "abcd");
+    copy = list;
+    EXPECT_EQ(copy.aggregate(), "bcd");
+}
+
+TEST_F(AggregateListTest, ThrowingElementsAndMonoidLeaveListUnchanged)
+{
+    AggregateList<Fragile, FragileSum> list;
+    for (int i = 1; i <= 20; ++i) {
+        list.add(Fragile(i));
+    }
+    EXPECT_EQ(list.aggregate().mValue, 210);
+
+    Fragile::budget = 0;
+    EXPECT_THROW(list.add(Fragile(100)), std::runtime_error);
+    EXPECT_THROW(list.add(25, Fragile(100)), std::runtime_error);
+    EXPECT_THROW(list.set(3, Fragile(100)), std::runtime_error);
+    Fragile::budget = -1;
+    EXPECT_EQ(list.size(), 20U);
+    EXPECT_EQ(list.get(3).mValue, 4);
+    EXPECT_EQ(list.aggregate().mValue, 210);
+
+    // Relinking does not call the monoid; the next aggregate() catches up
+    FragileSum::failing = true;
+    list.remove(0);
+    list.add(5, Fragile(50));
+    list.set(19, Fragile(1));
+    EXPECT_THROW(list.aggregate(), std::runtime_error);
+    EXPECT_THROW(list.aggregate(2, 9), std::runtime_error);
+    FragileSum::failing = false;
+    EXPECT_EQ(list.aggregate().mValue, 210 - 1 + 50 - 20 + 1);
+    EXPECT_EQ(list.aggregate(4, 7).mValue, 6 + 50 + 7);
+
+    // A copy assignment that fails part way leaves the target as it was
+    AggregateList<Fragile, FragileSum> copy;
+    copy.add(Fragile(7));
+    Fragile::budget = 10;
+    EXPECT_THROW(copy = list, std::runtime_error);
+    Fragile::budget = -1;
+    EXPECT_EQ(copy.size(), 1U);
+    EXPECT_EQ(copy.aggregate().mValue, 7);
+}
+}
@@ -0,0 +1,105 @@
+// compressedSequenceTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "CompressedSequence.h"
+#include <gtest/gtest.h>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+template <typename T, uint32_t B> std::vector<T> toVector(const CompressedSequence<T, B>& sequence)
+{
+    std::vector<T> values;
+    for (T value : sequence) {
+        values.push_back(value);
+    }
+    return values;
+}
+
+// The fixture for testing class CompressedSequence.
+class CompressedSequenceTest : public ::testing::Test {
+};
+
+TEST_F(CompressedSequenceTest, RoundTripsExtremeValues)
+{
+    const int64_t values[] = { 0, -1, std::numeric_limits<int64_t>::max(),
+        std::numeric_limits<int64_t>::min(), 42, 42, -7 };
+    CompressedSequence<int64_t, 4> signedSequence;
+    for (int64_t value : values) {
+        signedSequence.add(value);
+    }
+    EXPECT_EQ(toVector(signedSequence), std::vector<int64_t>(std::begin(values), std::end(values)));
+    for (uint32_t i = 0; i < 7; ++i) {
+        EXPECT_EQ(signedSequence.get(i), values[i]) << i;
+    }
+
+    CompressedSequence<uint32_t> unsignedSequence;
+    unsignedSequence.add(std::numeric_limits<uint32_t>::max());
+    unsignedSequence.add(0);
+    unsignedSequence.add(1);
+    EXPECT_EQ(toVector(unsignedSequence),
+        (std::vector<uint32_t> { std::numeric_limits<uint32_t>::max(), 0, 1 }));
+}
+
+TEST_F(CompressedSequenceTest, BlockLocalInsertAndRemove)
+{
+    CompressedSequence<int32_t, 4> sequence;
+    std::vector<int32_t> expected;
+    for (int32_t i = 0; i < 10; ++i) {
+        sequence.add(i * 10);
+        expected.push_back(i * 10);
+    }
+
+    // Inserting into a full block splits it
+    sequence.add(2, 15);
+    expected.insert(expected.begin() + 2, 15);
+    sequence.add(0, -5);
+    expected.insert(expected.begin(), -5);
+    sequence.add(12, 95);
+    expected.insert(expected.begin() + 12, 95);
+    EXPECT_EQ(toVector(sequence), expected);
+    EXPECT_EQ(sequence.size(), expected.size());
+
+    // Removing the last element of a block drops the block
+    for (uint32_t index : { 5U, 0U, 10U, 3U, 3U, 3U }) {
+        sequence.remove(index);
+        expected.erase(expected.begin() + index);
+        EXPECT_EQ(toVector(sequence), expected);
+    }
+    for (uint32_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(sequence.get(i), expected[i]) << i;
+    }
+
+    EXPECT_THROW(sequence.get(sequence.size()), std::out_of_range);
+    EXPECT_THROW(sequence.remove(sequence.size()), std::out_of_range);
+    EXPECT_THROW(sequence.add(sequence.size() + 1, 1), std::out_of_range);
+    EXPECT_EQ(toVector(sequence), expected);
+}
+
+TEST_F(CompressedSequenceTest, SortedDataIsCompact)
+{
+    CompressedSequence<int64_t> sequence;
+    int64_t timestamp = 1700000000000;
+    for (int64_t i = 0; i < 10000; ++i) {
+        timestamp += 1 + (i * 7919) % 200;
+        sequence.add(timestamp);
+    }
+    EXPECT_EQ(sequence.get(9999), timestamp);
+    EXPECT_LT(sequence.memoryUsage(), sequence.size() * 3);
+
+    CompressedSequence<int64_t> copy(sequence);
+    EXPECT_TRUE(copy == sequence);
+    copy.remove(5000);
+    EXPECT_TRUE(copy != sequence);
+    copy.clear();
+    EXPECT_TRUE(copy.isEmpty());
+    EXPECT_TRUE(copy.begin() == copy.end());
+    copy.add(3);
+    EXPECT_EQ(copy.get(0), 3);
+}
+}
@@ -0,0 +1,186 @@
+// concurrentSortedListTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "AllocationTracker.h"
+#include "ConcurrentSortedList.h"
+#include <atomic>
+#include <functional>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Orders AllocationTrackers by address; only used to count allocations
+struct ByAddress {
+    bool operator()(const AllocationTracker& lhs, const AllocationTracker& rhs) const
+    {
+        return &lhs < &rhs;
+    }
+};
+
+std::vector<int> contents(const ConcurrentSortedList<int>& list)
+{
+    std::vector<int> values;
+    list.forEach([&values](int value) { values.push_back(value); });
+    return values;
+}
+
+// The fixture for testing class ConcurrentSortedList.
+class ConcurrentSortedListTest : public ::testing::Test {
+};
+
+TEST_F(ConcurrentSortedListTest, SortedSet)
+{
+    ConcurrentSortedList<int> list;
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_TRUE(list.insert(5));
+    EXPECT_TRUE(list.insert(1));
+    EXPECT_TRUE(list.insert(9));
+    EXPECT_TRUE(list.insert(3));
+    EXPECT_FALSE(list.insert(5));
+    EXPECT_EQ(list.size(), 4U);
+    EXPECT_EQ(contents(list), (std::vector<int> { 1, 3, 5, 9 }));
+    EXPECT_TRUE(list.contains(3));
+    EXPECT_FALSE(list.contains(4));
+    EXPECT_TRUE(list.erase(1));
+    EXPECT_TRUE(list.erase(9));
+    EXPECT_FALSE(list.erase(9));
+    EXPECT_EQ(contents(list), (std::vector<int> { 3, 5 }));
+
+    ConcurrentSortedList<int, std::greater<int>> descending;
+    for (int i = 0; i < 5; ++i) {
+        descending.insert(i);
+    }
+    std::vector<int> values;
+    descending.forEach([&values](int value) { values.push_back(value); });
+    EXPECT_EQ(values, (std::vector<int> { 4, 3, 2, 1, 0 }));
+}
+
+TEST_F(ConcurrentSortedListTest, ForEachPropagatesExceptions)
+{
+    ConcurrentSortedList<int> list;
+    for (int i = 0; i < 5; ++i) {
+        list.insert(i);
+    }
+    EXPECT_THROW(list.forEach([](int value) {
+        if (value == 2) {
+            throw std::runtime_error("stop");
+        }
+    }),
+        std::runtime_error);
+    // Every lock was released
+    EXPECT_TRUE(list.erase(2));
+    EXPECT_TRUE(list.insert(7));
+    EXPECT_EQ(contents(list), (std::vector<int> { 0, 1, 3, 4, 7 }));
+}
+
+TEST_F(ConcurrentSortedListTest, DisjointKeysFromManyThreads)
+{
+    ConcurrentSortedList<int> list;
+    const int threads = 8;
+    const int perThread = 500;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&list, t]() {
+            // Interleaved keys, so neighboring nodes belong to different threads
+            for (int i = 0; i < perThread; ++i) {
+                list.insert(i * threads + t);
+            }
+            for (int i = 0; i < perThread; i += 2) {
+                list.erase(i * threads + t);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    std::vector<int> values = contents(list);
+    ASSERT_EQ(values.size(), static_cast<size_t>(threads * perThread / 2));
+    EXPECT_EQ(list.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i] / threads % 2, 1);
+        if (i > 0) {
+            EXPECT_LT(values[i - 1], values[i]);
+        }
+    }
+}
+
+TEST_F(ConcurrentSortedListTest, RandomOperationsBalance)
+{
+    const int keys = 64;
+    const int threads = 8;
+    ConcurrentSortedList<int> list;
+    // Net number of successful inserts minus erases per key
+    std::vector<std::atomic<int>> balance(keys);
+    std::atomic<bool> done(false);
+    std::atomic<int> unsorted(0);
+    std::thread observer([&list, &done, &unsorted]() {
+        while (!done.load()) {
+            std::vector<int> values = contents(list);
+            for (size_t i = 1; i < values.size(); ++i) {
+                if (values[i - 1] >= values[i]) {
+                    unsorted.fetch_add(1);
+                }
+            }
+        }
+    });
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&list, &balance, t]() {
+            unsigned seed = static_cast<unsigned>(t) + 1;
+            for (int step = 0; step < 5000; ++step) {
+                seed = seed * 1103515245U + 12345U;
+                int key = static_cast<int>((seed >> 8) % keys);
+                switch ((seed >> 20) % 3) {
+                case 0:
+                    if (list.insert(key)) {
+                        balance[key].fetch_add(1);
+                    }
+                    break;
+                case 1:
+                    if (list.erase(key)) {
+                        balance[key].fetch_sub(1);
+                    }
+                    break;
+                default:
+                    list.contains(key);
+                    break;
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    done.store(true);
+    observer.join();
+    EXPECT_EQ(unsorted.load(), 0);
+    uint32_t present = 0;
+    for (int key = 0; key < keys; ++key) {
+        ASSERT_GE(balance[key].load(), 0);
+        ASSERT_LE(balance[key].load(), 1);
+        EXPECT_EQ(list.contains(key), balance[key].load() == 1);
+        present += static_cast<uint32_t>(balance[key].load());
+    }
+    EXPECT_EQ(list.size(), present);
+}
+
+TEST_F(ConcurrentSortedListTest, ReleasesResources)
+{
+    {
+        ConcurrentSortedList<AllocationTracker, ByAddress> list;
+        EXPECT_EQ(AllocationTracker::getCount(), 2U);
+        AllocationTracker tracker;
+        for (int i = 0; i < 10; ++i) {
+            list.insert(tracker);
+        }
+        EXPECT_EQ(AllocationTracker::getCount(), 13U);
+    }
+    EXPECT_EQ(AllocationTracker::getCount(), 0U);
+}
+}
@@ -0,0 +1,192 @@
+// flatCombiningListTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "FlatCombiningList.h"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Copying a negative value throws
+struct Picky {
+    Picky(int value = 0)
+        : mValue(value)
+    {
+    }
+
+    Picky(const Picky& other)
+        : mValue(other.mValue)
+    {
+        if (mValue < 0) {
+            throw std::runtime_error("copy");
+        }
+    }
+
+    Picky& operator=(const Picky& other) = default;
+
+    int mValue;
+};
+
+// The fixture for testing class FlatCombiningList.
+class FlatCombiningListTest : public ::testing::Test {
+};
+
+TEST_F(FlatCombiningListTest, QueueOrder)
+{
+    FlatCombiningList<int> list;
+    int value = 0;
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_FALSE(list.removeFront(value));
+    for (int i = 0; i < 5; ++i) {
+        list.add(i);
+    }
+    EXPECT_EQ(list.size(), 5U);
+    ASSERT_TRUE(list.removeFront(value));
+    EXPECT_EQ(value, 0);
+    uint32_t size = list.withList([](LinkedList<int>& inner) {
+        inner.add(5);
+        return inner.size();
+    });
+    EXPECT_EQ(size, 5U);
+    EXPECT_EQ(list.size(), 5U);
+    for (int i = 1; i <= 5; ++i) {
+        ASSERT_TRUE(list.removeFront(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_TRUE(list.isEmpty());
+}
+
+TEST_F(FlatCombiningListTest, FailedRequestLeavesListUnchanged)
+{
+    FlatCombiningList<Picky> list;
+    list.add(Picky(1));
+    EXPECT_THROW(list.add(Picky(-1)), std::runtime_error);
+    list.add(Picky(2));
+    EXPECT_EQ(list.size(), 2U);
+    Picky value;
+    ASSERT_TRUE(list.removeFront(value));
+    EXPECT_EQ(value.mValue, 1);
+    // The list was untouched by the failed request and keeps working
+    ASSERT_TRUE(list.removeFront(value));
+    EXPECT_EQ(value.mValue, 2);
+    EXPECT_FALSE(list.removeFront(value));
+}
+
+TEST_F(FlatCombiningListTest, ConcurrentProducersKeepTheirOrder)
+{
+    const int threads = 8;
+    const int perThread = 2000;
+    FlatCombiningList<int> list(4);
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; ++t) {
+        producers.emplace_back([&list, t]() {
+            for (int i = 0; i < perThread; ++i) {
+                list.add(t * perThread + i);
+            }
+        });
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    ASSERT_EQ(list.size(), static_cast<uint32_t>(threads * perThread));
+    std::vector<int> last(threads, -1);
+    bool ordered = list.withList([&last](LinkedList<int>& inner) {
+        for (int value : inner) {
+            int& previous = last[value / perThread];
+            if (value <= previous) {
+                return false;
+            }
+            previous = value;
+        }
+        return true;
+    });
+    EXPECT_TRUE(ordered);
+    for (int t = 0; t < threads; ++t) {
+        EXPECT_EQ(last[t], t * perThread + perThread - 1);
+    }
+}
+
+TEST_F(FlatCombiningListTest, ConcurrentProducersAndConsumers)
+{
+    const int threads = 4;
+    const int perThread = 5000;
+    FlatCombiningList<int> list;
+    std::atomic<long long> removedSum(0);
+    std::atomic<int> removed(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&list, t]() {
+            for (int i = 0; i < perThread; ++i) {
+                list.add(t * perThread + i);
+            }
+        });
+        workers.emplace_back([&list, &removedSum, &removed]() {
+            int value = 0;
+            for (int i = 0; i < perThread; ++i) {
+                if (list.removeFront(value)) {
+                    removedSum.fetch_add(value);
+                    removed.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    long long remainingSum = list.withList([](LinkedList<int>& inner) {
+        long long sum = 0;
+        for (int value : inner) {
+            sum += value;
+        }
+        return sum;
+    });
+    long long total = static_cast<long long>(threads * perThread) * (threads * perThread - 1) / 2;
+    EXPECT_EQ(removedSum.load() + remainingSum, total);
+    EXPECT_EQ(static_cast<int>(list.size()) + removed.load(), threads * perThread);
+}
+
+TEST_F(FlatCombiningListTest, SlotsAreFreedWithTheirThread)
+{
+    FlatCombiningList<int> list(1);
+    // Each thread holds the only slot while it runs and frees it on exit, so
+    // the next thread gets it back
+    for (int t = 0; t < 4; ++t) {
+        std::thread([&list, t]() {
+            list.add(t);
+            list.add(t);
+        }).join();
+    }
+    EXPECT_EQ(list.size(), 8U);
+    // This thread now holds the slot for good; another thread finds none
+    // free and serves itself
+    list.add(4);
+    std::thread([&list]() { list.add(5); }).join();
+    int value = 0;
+    for (int expected : { 0, 0, 1, 1, 2, 2, 3, 3, 4, 5 }) {
+        ASSERT_TRUE(list.removeFront(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_TRUE(list.isEmpty());
+}
+
+TEST_F(FlatCombiningListTest, ThreadsOutliveTheirLists)
+{
+    // A thread keeps registrations for lists that are gone; a new list at
+    // the same address must not reuse them
+    std::thread([]() {
+        for (int i = 0; i < 100; ++i) {
+            FlatCombiningList<int> list(1);
+            list.add(i);
+            int value = -1;
+            ASSERT_TRUE(list.removeFront(value));
+            EXPECT_EQ(value, i);
+        }
+    }).join();
+}
+}
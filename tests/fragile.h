@@ -0,0 +1,58 @@
+// fragile.h
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#ifndef FRAGILE_H
+#define FRAGILE_H
+
+#include <stdexcept>
+
+/**
+ * An element for exception-safety tests: every copy, whether by construction
+ * or by assignment, spends one unit of a budget shared by all Fragile
+ * objects, and the copy made once the budget is used up throws. A negative
+ * budget, the default, never runs out. Tests that set the budget reset it to
+ * -1 when done.
+ */
+struct Fragile {
+    static inline int budget = -1;
+
+    Fragile(int value = 0)
+        : mValue(value)
+    {
+    }
+
+    Fragile(const Fragile& other)
+        : mValue(other.mValue)
+    {
+        spend();
+    }
+
+    Fragile& operator=(const Fragile& other)
+    {
+        spend();
+        mValue = other.mValue;
+        return *this;
+    }
+
+    bool operator==(const Fragile& rhs) const
+    {
+        return mValue == rhs.mValue;
+    }
+
+    static void spend()
+    {
+        if (budget == 0) {
+            throw std::runtime_error("copy");
+        }
+        if (budget > 0) {
+            --budget;
+        }
+    }
+
+    int mValue;
+};
+
+#endif // FRAGILE_H
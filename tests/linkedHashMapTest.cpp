@@ -0,0 +1,144 @@
+// linkedHashMapTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "LinkedHashMap.h"
+#include "AllocationTracker.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace {
+
+// The fixture for testing LinkedHashMap.
+class LinkedHashMapTest : public ::testing::Test {
+};
+
+TEST_F(LinkedHashMapTest, InsertAndLookup)
+{
+    LinkedHashMap<std::string, int> map;
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_TRUE(map.insert("one", 1).second);
+    EXPECT_TRUE(map.insert("two", 2).second);
+    // Existing entries are not overwritten
+    EXPECT_FALSE(map.insert("one", 100).second);
+    EXPECT_EQ(map.size(), 2U);
+    EXPECT_EQ(map.at("one"), 1);
+    EXPECT_EQ(map.at("two"), 2);
+    EXPECT_TRUE(map.contains("two"));
+    EXPECT_FALSE(map.contains("three"));
+    EXPECT_TRUE(map.find("three") == map.end());
+    EXPECT_THROW(map.at("three"), std::out_of_range);
+
+    map["three"] = 3;
+    ++map["one"];
+    EXPECT_EQ(map.size(), 3U);
+    EXPECT_EQ(map.at("one"), 2);
+    EXPECT_EQ(map.find("three")->second, 3);
+}
+
+TEST_F(LinkedHashMapTest, InsertionOrder)
+{
+    LinkedHashMap<int, int> map;
+    // Descending keys so that iteration order differs from hash order
+    for (int i = 999; i >= 0; --i) {
+        map.insert(i, i * i);
+    }
+    int expected = 999;
+    for (auto iter = map.begin(); iter != map.end(); ++iter) {
+        EXPECT_EQ(iter->first, expected);
+        EXPECT_EQ(iter->second, expected * expected);
+        --expected;
+    }
+    EXPECT_EQ(expected, -1);
+
+    // Re-inserting after an erase moves the key to the back
+    EXPECT_TRUE(map.erase(500));
+    EXPECT_FALSE(map.erase(500));
+    map.insert(500, 0);
+    auto last = map.end();
+    --last;
+    EXPECT_EQ(last->first, 500);
+    EXPECT_EQ(map.size(), 1000U);
+}
+
+TEST_F(LinkedHashMapTest, EraseWhileIterating)
+{
+    LinkedHashMap<int, std::string> map;
+    for (int i = 0; i < 100; ++i) {
+        map.insert(i, std::to_string(i));
+    }
+    for (auto iter = map.begin(); iter != map.end();) {
+        if (iter->first % 3 != 0) {
+            iter = map.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    EXPECT_EQ(map.size(), 34U);
+    int expected = 0;
+    for (const auto& entry : map) {
+        EXPECT_EQ(entry.first, expected);
+        EXPECT_EQ(entry.second, std::to_string(expected));
+        expected += 3;
+    }
+    // Every surviving key must still be reachable through the table
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(map.contains(i), i % 3 == 0);
+    }
+}
+
+TEST_F(LinkedHashMapTest, CopyAndAssignment)
+{
+    LinkedHashMap<int, int> map;
+    for (int i = 0; i < 50; ++i) {
+        map.insert(50 - i, i);
+    }
+    LinkedHashMap<int, int> copy(map);
+    map.clear();
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_EQ(copy.size(), 50U);
+
+    std::vector<int> keys;
+    for (const auto& entry : copy) {
+        keys.push_back(entry.first);
+    }
+    ASSERT_EQ(keys.size(), 50U);
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ(keys[i], 50 - i);
+        EXPECT_EQ(copy.at(50 - i), i);
+    }
+
+    LinkedHashMap<int, int> assigned;
+    assigned.insert(7, 7);
+    assigned = copy;
+    assigned = assigned;
+    EXPECT_EQ(assigned.size(), 50U);
+    EXPECT_EQ(assigned.at(7), 43);
+}
+
+TEST_F(LinkedHashMapTest, ReleasesResources)
+{
+    {
+        LinkedHashMap<int, AllocationTracker> map;
+        // The dummy entry holds one value
+        EXPECT_EQ(AllocationTracker::getCount(), 1U);
+        for (int i = 0; i < 20; ++i) {
+            map.insert(i, AllocationTracker());
+        }
+        EXPECT_EQ(AllocationTracker::getCount(), 21U);
+        for (int i = 0; i < 20; i += 2) {
+            map.erase(i);
+        }
+        EXPECT_EQ(AllocationTracker::getCount(), 11U);
+        LinkedHashMap<int, AllocationTracker> copy(map);
+        EXPECT_EQ(AllocationTracker::getCount(), 22U);
+        map.clear();
+        EXPECT_EQ(AllocationTracker::getCount(), 12U);
+    }
+    EXPECT_EQ(AllocationTracker::getCount(), 0U);
+}
+}
@@ -0,0 +1,234 @@
+// linkedListAllocatorTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "LinkedList.h"
+#include "fragile.h"
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace {
+
+// Counts what passes through it on its way to the global heap.
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t mAllocations = 0;
+    size_t mLive = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        void* p = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        ++mAllocations;
+        ++mLive;
+        return p;
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        --mLive;
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+// A stateful allocator that propagates on copy, move and swap.
+template <typename T> struct TaggedAllocator {
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    explicit TaggedAllocator(CountingResource* resource)
+        : mResource(resource)
+    {
+    }
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U>& other)
+        : mResource(other.mResource)
+    {
+    }
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(mResource->allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* p, size_t n)
+    {
+        mResource->deallocate(p, n * sizeof(T), alignof(T));
+    }
+    template <typename U> bool operator==(const TaggedAllocator<U>& other) const
+    {
+        return mResource == other.mResource;
+    }
+    template <typename U> bool operator!=(const TaggedAllocator<U>& other) const
+    {
+        return mResource != other.mResource;
+    }
+
+    CountingResource* mResource;
+};
+
+// The fixture for testing allocator-aware LinkedLists.
+class LinkedListAllocatorTest : public ::testing::Test {
+};
+
+TEST_F(LinkedListAllocatorTest, NodesComeFromResource)
+{
+    CountingResource resource;
+    {
+        pmr::LinkedList<std::string> list(&resource);
+        EXPECT_EQ(resource.mLive, 1U);
+        list.add("a");
+        list.add(0, "b");
+        list.add(5, "c");
+        EXPECT_EQ(list.size(), 6U);
+        // Without runs, every element of the gap has a node of its own
+        EXPECT_EQ(resource.mLive, 7U);
+        EXPECT_EQ(list.get(0), "b");
+        EXPECT_EQ(list.get(1), "a");
+        EXPECT_EQ(list.get(3), "");
+        EXPECT_EQ(list.get(5), "c");
+        list.remove(2);
+        list.set(2, "d");
+        EXPECT_EQ(resource.mLive, 6U);
+        EXPECT_EQ(list.getAllocator().resource(), &resource);
+    }
+    EXPECT_EQ(resource.mLive, 0U);
+}
+
+TEST_F(LinkedListAllocatorTest, MonotonicBuffer)
+{
+    char buffer[4096];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+    pmr::LinkedList<int> list(&arena);
+    for (int i = 0; i < 20; ++i) {
+        list.add(i);
+    }
+    int expected = 0;
+    for (int item : list) {
+        EXPECT_EQ(item, expected++);
+    }
+    list.clear();
+    EXPECT_TRUE(list.isEmpty());
+}
+
+TEST_F(LinkedListAllocatorTest, CopyDoesNotPropagate)
+{
+    CountingResource first;
+    CountingResource second;
+    pmr::LinkedList<int> src(&first);
+    src.add(1);
+    src.add(2);
+    // pmr containers copy onto the default resource
+    pmr::LinkedList<int> copy(src);
+    EXPECT_EQ(copy.getAllocator().resource(), std::pmr::get_default_resource());
+    EXPECT_TRUE(copy == src);
+
+    pmr::LinkedList<int> target(&second);
+    target.add(7);
+    target = src;
+    EXPECT_EQ(target.getAllocator().resource(), &second);
+    EXPECT_TRUE(target == src);
+    EXPECT_EQ(second.mLive, 3U);
+    EXPECT_EQ(first.mLive, 3U);
+}
+
+TEST_F(LinkedListAllocatorTest, MoveBetweenResources)
+{
+    CountingResource first;
+    CountingResource second;
+    pmr::LinkedList<int> src(&first);
+    for (int i = 0; i < 4; ++i) {
+        src.add(i);
+    }
+    pmr::LinkedList<int> moved(std::move(src));
+    EXPECT_EQ(moved.getAllocator().resource(), &first);
+    EXPECT_EQ(moved.size(), 4U);
+    EXPECT_TRUE(src.isEmpty());
+
+    // Equal resources: the nodes are taken over
+    pmr::LinkedList<int> same(&first);
+    size_t before = first.mAllocations;
+    same = std::move(moved);
+    EXPECT_EQ(first.mAllocations, before);
+    EXPECT_EQ(same.size(), 4U);
+
+    // Different resources: the elements are copied into ours
+    pmr::LinkedList<int> other(&second);
+    other = std::move(same);
+    EXPECT_EQ(other.getAllocator().resource(), &second);
+    EXPECT_EQ(other.size(), 4U);
+    EXPECT_EQ(second.mLive, 5U);
+    EXPECT_EQ(other.get(3), 3);
+}
+
+TEST_F(LinkedListAllocatorTest, SwapWithEqualResources)
+{
+    CountingResource resource;
+    pmr::LinkedList<int> left(&resource);
+    pmr::LinkedList<int> right(&resource);
+    left.add(1);
+    right.add(2);
+    right.add(3);
+    left.swap(right);
+    EXPECT_EQ(left.size(), 2U);
+    EXPECT_EQ(right.get(0), 1);
+    EXPECT_EQ(resource.mLive, 5U);
+}
+
+TEST_F(LinkedListAllocatorTest, PropagatingAllocator)
+{
+    using List = LinkedList<int, TaggedAllocator<int>>;
+    CountingResource first;
+    CountingResource second;
+    {
+        List a { TaggedAllocator<int>(&first) };
+        List b { TaggedAllocator<int>(&second) };
+        a.add(1);
+        b.add(2);
+        b.add(3);
+
+        a = b;
+        EXPECT_EQ(a.getAllocator().mResource, &second);
+        EXPECT_EQ(first.mLive, 0U);
+
+        List c { TaggedAllocator<int>(&first) };
+        c.add(4);
+        c = std::move(a);
+        EXPECT_EQ(c.getAllocator().mResource, &second);
+        EXPECT_EQ(c.size(), 2U);
+
+        c.swap(b);
+        EXPECT_EQ(c.getAllocator().mResource, &second);
+        b.swap(a);
+        EXPECT_EQ(b.getAllocator().mResource, &first);
+        EXPECT_EQ(a.getAllocator().mResource, &second);
+        EXPECT_EQ(a.size(), 2U);
+    }
+    EXPECT_EQ(first.mLive, 0U);
+    EXPECT_EQ(second.mLive, 0U);
+}
+
+TEST_F(LinkedListAllocatorTest, FailedCopyReleasesNodes)
+{
+    CountingResource resource;
+    pmr::LinkedList<Fragile> src(&resource);
+    for (int i = 0; i < 5; ++i) {
+        src.add(Fragile(i));
+    }
+    size_t live = resource.mLive;
+    Fragile::budget = 3;
+    EXPECT_THROW(pmr::LinkedList<Fragile> copy(src, &resource), std::runtime_error);
+    Fragile::budget = -1;
+    EXPECT_EQ(resource.mLive, live);
+    EXPECT_EQ(src.size(), 5U);
+}
+}
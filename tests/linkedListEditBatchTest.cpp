@@ -0,0 +1,208 @@
+// linkedListEditBatchTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "AllocationTracker.h"
+#include "LinkedList.h"
+#include "fragile.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// The fixture for testing LinkedListEditBatch and LinkedList::apply.
+class LinkedListEditBatchTest : public ::testing::Test {
+};
+
+TEST_F(LinkedListEditBatchTest, SequentialSemantics)
+{
+    LinkedList<int> list;
+    for (int i = 0; i < 5; ++i) {
+        list.add(i);
+    }
+    LinkedListEditBatch<int> batch(list);
+    EXPECT_TRUE(batch.isEmpty());
+    batch.add(0, 10); // 10 0 1 2 3 4
+    batch.remove(2); // 10 0 2 3 4
+    batch.set(2, 20); // 10 0 20 3 4
+    batch.add(5, 30); // 10 0 20 3 4 30
+    batch.remove(0); // 0 20 3 4 30
+    batch.add(1, 40); // 0 40 20 3 4 30
+    batch.set(1, 41); // 0 41 20 3 4 30
+    batch.add(8, 50); // 0 41 20 3 4 30 0 0 50
+    EXPECT_EQ(batch.resultSize(), 9U);
+    EXPECT_THROW(batch.remove(9), std::out_of_range);
+    EXPECT_THROW(batch.set(9, 0), std::out_of_range);
+
+    // Nothing happens until the batch is applied
+    EXPECT_EQ(list.size(), 5U);
+    list.apply(batch);
+    const int expected[] = { 0, 41, 20, 3, 4, 30, 0, 0, 50 };
+    ASSERT_EQ(list.size(), 9U);
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), expected));
+
+    // The batch was recorded for a list of size 5
+    EXPECT_THROW(list.apply(batch), std::invalid_argument);
+}
+
+TEST_F(LinkedListEditBatchTest, MatchesOneAtATime)
+{
+    unsigned seed = 7;
+    auto next = [&seed]() {
+        seed = seed * 1103515245U + 12345U;
+        return seed >> 8;
+    };
+    for (int round = 0; round < 20; ++round) {
+        LinkedList<int> batched;
+        LinkedList<int> direct;
+        for (int i = 0; i < 50; ++i) {
+            batched.add(i);
+            direct.add(i);
+        }
+        LinkedListEditBatch<int> batch(batched);
+        for (int step = 0; step < 100; ++step) {
+            uint32_t size = direct.size();
+            int value = static_cast<int>(next() % 1000);
+            switch (size == 0 ? 0 : next() % 3) {
+            case 0: {
+                uint32_t index = next() % (size + 8);
+                batch.add(index, value);
+                direct.add(index, value);
+                break;
+            }
+            case 1: {
+                uint32_t index = next() % size;
+                batch.remove(index);
+                direct.remove(index);
+                break;
+            }
+            default: {
+                uint32_t index = next() % size;
+                batch.set(index, value);
+                direct.set(index, value);
+                break;
+            }
+            }
+            ASSERT_EQ(batch.resultSize(), direct.size());
+        }
+        batched.apply(batch);
+        ASSERT_EQ(batched.size(), direct.size());
+        EXPECT_TRUE(std::equal(batched.begin(), batched.end(), direct.begin()));
+    }
+}
+
+TEST_F(LinkedListEditBatchTest, EditsInsideDefaultRuns)
+{
+    LinkedList<int> sparse;
+    LinkedList<int> dense;
+    sparse.add(20, 1);
+    for (int i = 0; i < 20; ++i) {
+        dense.add(0);
+    }
+    dense.add(1);
+    LinkedListEditBatch<int> sparseBatch(sparse);
+    LinkedListEditBatch<int> denseBatch(dense);
+    for (LinkedListEditBatch<int>* batch : { &sparseBatch, &denseBatch }) {
+        batch->set(3, 3);
+        batch->remove(7);
+        batch->add(10, 10);
+        batch->add(15, 15);
+        batch->remove(0);
+    }
+    sparse.apply(sparseBatch);
+    dense.apply(denseBatch);
+    ASSERT_EQ(sparse.size(), dense.size());
+    EXPECT_TRUE(std::equal(dense.begin(), dense.end(), sparse.begin()));
+}
+
+TEST_F(LinkedListEditBatchTest, GapsStayOneEdit)
+{
+    // A gap this long would take gigabytes as one edit and node per element
+    const uint32_t gap = 1U << 28;
+    LinkedList<int> list;
+    list.add(1);
+    LinkedListEditBatch<int> batch(list);
+    batch.add(gap, 2);
+    batch.add(gap + 5, 3);
+    batch.set(10, 10);
+    batch.remove(20);
+    batch.add(30, 30);
+    batch.add(gap + 2, 4);
+    batch.set(gap + 1, 5);
+    EXPECT_EQ(batch.resultSize(), gap + 7);
+    list.apply(batch);
+
+    const LinkedList<int>& result = list;
+    ASSERT_EQ(result.size(), gap + 7);
+    const uint32_t indices[] = { 0, 1, 10, 20, 30, 31, gap - 1, gap, gap + 1, gap + 2, gap + 3,
+        gap + 5, gap + 6 };
+    const int expected[] = { 1, 0, 10, 0, 30, 0, 0, 2, 5, 4, 0, 0, 3 };
+    for (size_t i = 0; i < sizeof(indices) / sizeof(indices[0]); ++i) {
+        EXPECT_EQ(result.get(indices[i]), expected[i]) << indices[i];
+    }
+
+    // Lists without runs of default values get one node per element
+    pmr::LinkedList<int> dense;
+    LinkedListEditBatch<int> denseBatch(dense);
+    denseBatch.add(5, 1);
+    denseBatch.set(2, 2);
+    denseBatch.remove(0);
+    dense.apply(denseBatch);
+    const int denseExpected[] = { 0, 2, 0, 0, 1 };
+    ASSERT_EQ(dense.size(), 5U);
+    EXPECT_TRUE(std::equal(dense.begin(), dense.end(), denseExpected));
+}
+
+TEST_F(LinkedListEditBatchTest, AllOrNothing)
+{
+    LinkedList<Fragile> list;
+    for (int i = 0; i < 10; ++i) {
+        list.add(Fragile(i));
+    }
+    LinkedListEditBatch<Fragile> batch(list);
+    batch.set(3, Fragile(30));
+    batch.remove(5);
+    batch.add(0, Fragile(-1));
+    batch.add(10, Fragile(99));
+
+    Fragile::budget = 2;
+    EXPECT_THROW(list.apply(batch), std::runtime_error);
+    Fragile::budget = -1;
+    ASSERT_EQ(list.size(), 10U);
+    for (uint32_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(list.get(i).mValue, static_cast<int>(i));
+    }
+
+    list.apply(batch);
+    const int expected[] = { -1, 0, 1, 2, 30, 4, 6, 7, 8, 9, 99 };
+    ASSERT_EQ(list.size(), 11U);
+    for (uint32_t i = 0; i < 11; ++i) {
+        EXPECT_EQ(list.get(i).mValue, expected[i]);
+    }
+}
+
+TEST_F(LinkedListEditBatchTest, ReleasesResources)
+{
+    {
+        LinkedList<AllocationTracker> list;
+        for (int i = 0; i < 10; ++i) {
+            list.add(AllocationTracker());
+        }
+        LinkedListEditBatch<AllocationTracker> batch(list);
+        for (int i = 0; i < 5; ++i) {
+            batch.remove(0);
+        }
+        batch.add(3, AllocationTracker());
+        batch.set(0, AllocationTracker());
+        list.apply(batch);
+        batch.clear();
+        EXPECT_EQ(list.size(), 6U);
+        EXPECT_EQ(AllocationTracker::getCount(), 7U);
+    }
+    EXPECT_EQ(AllocationTracker::getCount(), 0U);
+}
+}
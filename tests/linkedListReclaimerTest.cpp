@@ -0,0 +1,134 @@
+// linkedListReclaimerTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "AllocationTracker.h"
+#include "LinkedList.h"
+#include "LinkedListReclaimer.h"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace {
+
+// Counts live instances; the reclaimer thread destroys them concurrently
+// with the test, so the count is atomic.
+struct Counted {
+    static std::atomic<int> live;
+
+    Counted()
+    {
+        ++live;
+    }
+
+    Counted(const Counted&)
+    {
+        ++live;
+    }
+
+    Counted& operator=(const Counted&) = default;
+
+    ~Counted()
+    {
+        --live;
+    }
+};
+
+std::atomic<int> Counted::live { 0 };
+
+// The fixture for testing bulk and deferred teardown.
+class LinkedListReclaimerTest : public ::testing::Test {
+};
+
+TEST_F(LinkedListReclaimerTest, BulkClearLeavesUsableList)
+{
+    LinkedList<AllocationTracker> list;
+    for (int i = 0; i < 100; ++i) {
+        list.add(AllocationTracker());
+    }
+    list.clear();
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_TRUE(list.begin() == list.end());
+    EXPECT_EQ(AllocationTracker::getCount(), 1U);
+
+    list.add(AllocationTracker());
+    list.add(0, AllocationTracker());
+    EXPECT_EQ(list.size(), 2U);
+    EXPECT_EQ(AllocationTracker::getCount(), 3U);
+    list.clear();
+    list.clear();
+    EXPECT_EQ(AllocationTracker::getCount(), 1U);
+}
+
+TEST_F(LinkedListReclaimerTest, DeferredClearAndDestructor)
+{
+    LinkedListReclaimer reclaimer;
+    {
+        LinkedList<Counted> list;
+        list.setReclaimer(&reclaimer);
+        for (int i = 0; i < 1000; ++i) {
+            list.add(Counted());
+        }
+        list.clear();
+        // The list is empty right away even though the nodes may still exist
+        EXPECT_TRUE(list.isEmpty());
+        list.add(Counted());
+        reclaimer.flush();
+        EXPECT_EQ(Counted::live, 2);
+
+        for (int i = 0; i < 1000; ++i) {
+            list.add(Counted());
+        }
+    }
+    reclaimer.flush();
+    EXPECT_EQ(Counted::live, 0);
+    EXPECT_EQ(reclaimer.reclaimed(), 2U);
+}
+
+TEST_F(LinkedListReclaimerTest, DeferredAssignment)
+{
+    LinkedListReclaimer reclaimer;
+    LinkedList<std::string> source;
+    source.add("kept");
+    {
+        LinkedList<std::string> list;
+        list.setReclaimer(&reclaimer);
+        for (int i = 0; i < 10; ++i) {
+            list.add(std::to_string(i));
+        }
+        list = source;
+        EXPECT_EQ(list.size(), 1U);
+        EXPECT_EQ(list.get(0), "kept");
+        reclaimer.flush();
+        EXPECT_EQ(reclaimer.reclaimed(), 1U);
+
+        // Copies do not inherit the reclaimer
+        LinkedList<std::string> copy(list);
+        copy.clear();
+        EXPECT_EQ(reclaimer.reclaimed(), 1U);
+        list.setReclaimer(nullptr);
+    }
+    EXPECT_EQ(reclaimer.reclaimed(), 1U);
+}
+
+TEST_F(LinkedListReclaimerTest, DeferredSurplusOfReusedNodes)
+{
+    LinkedListReclaimer reclaimer;
+    LinkedList<int> source;
+    source.add(1);
+    source.add(2);
+    LinkedList<int> list;
+    list.setReclaimer(&reclaimer);
+    for (int i = 0; i < 10; ++i) {
+        list.add(i);
+    }
+    // The first two nodes are assigned to, the other eight go as one chain
+    list = source;
+    EXPECT_TRUE(list == source);
+    reclaimer.flush();
+    EXPECT_EQ(reclaimer.reclaimed(), 1U);
+    list.setReclaimer(nullptr);
+}
+}
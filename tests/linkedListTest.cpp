@@ -336,3 +336,360 @@ TEST_F(LinkedListTest, Iterators)
     EXPECT_EQ(os2.str(), correct);
 }
 }
+
+namespace {
+
+TEST_F(LinkedListTest, LazyGapFill)
+{
+    {
+        LinkedList<AllocationTracker> list;
+        list.add(1000, AllocationTracker());
+        EXPECT_EQ(list.size(), 1001U);
+        // dummy, one node for the whole gap and the inserted value
+        EXPECT_EQ(AllocationTracker::getCount(), 3UL);
+
+        const LinkedList<AllocationTracker>& view = list;
+        uint32_t count = 0;
+        for (auto iter = view.begin(); iter != view.end(); ++iter) {
+            ++count;
+        }
+        EXPECT_EQ(count, 1001U);
+        for (auto iter = view.end(); iter != view.begin();) {
+            --iter;
+            --count;
+        }
+        EXPECT_EQ(count, 0U);
+        // Reading never materializes the gap
+        view.get(500);
+        EXPECT_EQ(AllocationTracker::getCount(), 3UL);
+
+        // A mutable reference splits out one element and the rest of the run
+        list.get(500).nonConstMethod();
+        EXPECT_EQ(AllocationTracker::getCount(), 5UL);
+        // Removing from a run only shortens it
+        list.remove(10);
+        EXPECT_EQ(list.size(), 1000U);
+        EXPECT_EQ(AllocationTracker::getCount(), 5UL);
+        list.add(2000, AllocationTracker());
+        EXPECT_EQ(list.size(), 2001U);
+        EXPECT_EQ(AllocationTracker::getCount(), 7UL);
+
+        LinkedList<AllocationTracker> copy(list);
+        EXPECT_EQ(copy.size(), 2001U);
+        EXPECT_EQ(AllocationTracker::getCount(), 14UL);
+    }
+    EXPECT_EQ(AllocationTracker::getCount(), 0UL);
+}
+
+TEST_F(LinkedListTest, LazyGapMatchesEagerFill)
+{
+    LinkedList<int> lazy;
+    LinkedList<int> eager;
+    lazy.add(3, 1);
+    lazy.add(8, 2);
+    for (int value : { 0, 0, 0, 1, 0, 0, 0, 0, 2 }) {
+        eager.add(value);
+    }
+    EXPECT_TRUE(lazy == eager);
+
+    lazy.set(5, 7);
+    eager.set(5, 7);
+    lazy.add(1, 9);
+    eager.add(1, 9);
+    lazy.remove(3);
+    eager.remove(3);
+    EXPECT_TRUE(lazy == eager);
+    std::ostringstream lazyOut;
+    std::ostringstream eagerOut;
+    writeListViaGet(lazyOut, lazy);
+    writeListViaGet(eagerOut, eager);
+    EXPECT_EQ(lazyOut.str(), eagerOut.str());
+
+    // Writing through mutable iterators materializes as it goes
+    LinkedList<int> sparse;
+    sparse.add(LEN - 1, 0);
+    std::copy(DATA, DATA + LEN, sparse.begin());
+    std::ostringstream os;
+    os << sparse;
+    EXPECT_EQ(os.str(), "0 1 2 3 4 5 6 7 8 9 ");
+    auto iter = sparse.end();
+    --iter;
+    EXPECT_EQ(*iter, 9);
+
+    LinkedList<int> reversed;
+    reversed.add(LEN - 1, 9);
+    auto back = reversed.end();
+    for (int i = static_cast<int>(LEN) - 1; i >= 0; --i) {
+        --back;
+        *back = DATA[i];
+    }
+    EXPECT_TRUE(back == reversed.begin());
+    std::ostringstream os2;
+    os2 << reversed;
+    EXPECT_EQ(os2.str(), "0 1 2 3 4 5 6 7 8 9 ");
+
+    // Content mismatches are detected, not only size mismatches
+    lazy.set(0, 42);
+    EXPECT_FALSE(lazy == eager);
+}
+
+TEST_F(LinkedListTest, Splice)
+{
+    LinkedList<int> list;
+    LinkedList<int> other;
+    for (size_t i = 0; i < 4; ++i) {
+        list.add(DATA[i]);
+    }
+    for (size_t i = 4; i < 7; ++i) {
+        other.add(DATA[i]);
+    }
+    list.splice(list.end(), other);
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_TRUE(other.begin() == other.end());
+    EXPECT_EQ(list.size(), 7U);
+
+    // Splicing a run of default values keeps it compressed
+    other.add(2, 9);
+    auto position = list.begin();
+    ++position;
+    list.splice(position, other);
+    std::ostringstream os;
+    os << list;
+    EXPECT_EQ(os.str(), "0 0 0 9 1 2 3 4 5 6 ");
+    list.splice(list.begin(), other);
+    EXPECT_EQ(list.size(), 10U);
+    other.add(1);
+    EXPECT_EQ(other.get(0), 1);
+}
+
+TEST_F(LinkedListTest, EraseAndSpliceOne)
+{
+    LinkedList<int> list;
+    LinkedList<int> other;
+    for (size_t i = 0; i < 4; ++i) {
+        list.add(DATA[i]);
+    }
+    other.add(2, 9);
+
+    // Iterators to a moved element follow it into the other list
+    auto moved = list.begin();
+    ++moved;
+    other.splice(other.begin(), list, moved);
+    EXPECT_EQ(*moved, 1);
+    other.splice(other.end(), list, list.begin());
+    list.splice(list.end(), list, list.begin());
+    std::ostringstream os;
+    os << list << "| " << other;
+    EXPECT_EQ(os.str(), "3 2 | 1 0 0 9 0 ");
+    EXPECT_EQ(list.size(), 2U);
+    EXPECT_EQ(other.size(), 5U);
+
+    // An element of a run of default values is moved out on its own
+    auto run = other.begin();
+    ++run;
+    list.splice(list.begin(), other, run);
+    EXPECT_EQ(list.get(0), 0);
+    EXPECT_EQ(other.size(), 4U);
+
+    // Erasing returns the next element, including inside a run
+    other.add(1, 0);
+    other.add(7, 0);
+    auto next = other.erase(other.begin());
+    EXPECT_EQ(*next, 0);
+    next = other.erase(next);
+    EXPECT_EQ(other.size(), 6U);
+    while (next != other.end()) {
+        next = other.erase(next);
+    }
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(list.get(2), 2);
+}
+
+TEST_F(LinkedListTest, RotateAndMove)
+{
+    {
+        LinkedList<AllocationTracker> trackers;
+        for (int i = 0; i < 5; ++i) {
+            trackers.add(AllocationTracker());
+        }
+        uint32_t count = AllocationTracker::getCount();
+        trackers.rotate(2);
+        trackers.rotate(4);
+        trackers.moveToBack(trackers.begin());
+        trackers.moveToFront(--trackers.end());
+        EXPECT_EQ(count, AllocationTracker::getCount());
+        EXPECT_EQ(trackers.size(), 5U);
+    }
+
+    LinkedList<int> list;
+    list.rotate(3);
+    EXPECT_TRUE(list.isEmpty());
+    for (size_t i = 0; i < LEN; ++i) {
+        list.add(DATA[i]);
+    }
+    list.setIndexed(true);
+    EXPECT_EQ(list.get(0), 0);
+    list.rotate(3);
+    list.rotate(LEN);
+    EXPECT_EQ(list.get(0), 3);
+    list.rotate(LEN - 1); // walks from the back
+    std::ostringstream os;
+    os << list;
+    EXPECT_EQ(os.str(), "2 3 4 5 6 7 8 9 0 1 ");
+    // A stale index is not rebuilt just to find the new first element
+    list.dropIndex();
+    list.rotate(2);
+    EXPECT_EQ(list.indexMemory(), 0U);
+    list.rotate(LEN - 2);
+    EXPECT_EQ(list.get(0), 2);
+
+    // Iterators follow the moved element
+    auto two = list.begin();
+    list.moveToBack(two);
+    auto eight = list.find(8);
+    list.moveToFront(eight);
+    list.moveToFront(list.begin());
+    EXPECT_EQ(*two, 2);
+    EXPECT_EQ(*eight, 8);
+    EXPECT_EQ(list.get(LEN - 1), 2);
+    EXPECT_EQ(list.get(0), 8);
+
+    // The new first element may lie inside a run of default values
+    LinkedList<int> gaps;
+    gaps.add(1);
+    gaps.add(5, 2);
+    gaps.rotate(3);
+    std::ostringstream os2;
+    os2 << gaps;
+    EXPECT_EQ(os2.str(), "0 0 2 1 0 0 ");
+    gaps.rotate(4);
+    std::ostringstream os3;
+    os3 << gaps;
+    EXPECT_EQ(os3.str(), "0 0 0 0 2 1 ");
+}
+
+TEST_F(LinkedListTest, AssignmentReusesNodes)
+{
+    LinkedList<int> source;
+    for (size_t i = 0; i < LEN; ++i) {
+        source.add(DATA[i]);
+    }
+    source.add(LEN + 3, 42);
+
+    // Growing, shrinking and equal sizes all end up equal to the source
+    LinkedList<int> shorter;
+    shorter.add(7);
+    shorter = source;
+    EXPECT_TRUE(shorter == source);
+    EXPECT_EQ(shorter.size(), LEN + 4);
+
+    LinkedList<int> longer;
+    for (size_t i = 0; i < 2 * LEN; ++i) {
+        longer.add(-1);
+    }
+    longer = source;
+    EXPECT_TRUE(longer == source);
+    longer.set(LEN + 1, 5);
+    EXPECT_EQ(source.get(LEN + 1), 0);
+    EXPECT_EQ(longer.get(LEN + 2), 0);
+
+    LinkedList<int> empty;
+    longer = empty;
+    EXPECT_TRUE(longer.isEmpty());
+    EXPECT_TRUE(longer.begin() == longer.end());
+    longer.add(3);
+    EXPECT_EQ(longer.get(0), 3);
+}
+
+TEST_F(LinkedListTest, SelfOrganizingFind)
+{
+    LinkedList<int> list;
+    for (size_t i = 0; i < LEN; ++i) {
+        list.add(DATA[i]);
+    }
+    const LinkedList<int>& view = list;
+    EXPECT_EQ(*view.find(4), 4);
+    EXPECT_TRUE(view.find(42) == view.end());
+    EXPECT_EQ(*view.findIf([](int item) { return item > 6; }), 7);
+
+    // Static searches leave the order alone; a miss never reorganizes
+    int& five = *list.find(5);
+    EXPECT_TRUE(list.find(42, SearchPolicy::MoveToFront) == list.end());
+    std::ostringstream os;
+    os << list;
+    EXPECT_EQ(os.str(), "0 1 2 3 4 5 6 7 8 9 ");
+
+    EXPECT_EQ(*list.find(5, SearchPolicy::MoveToFront), 5);
+    EXPECT_EQ(*list.find(9, SearchPolicy::Transpose), 9);
+    EXPECT_EQ(*list.findIf([](int item) { return item == 5; }, SearchPolicy::Transpose), 5);
+    EXPECT_EQ(*list.find(1, SearchPolicy::Transpose), 1);
+    os.str("");
+    os << list;
+    EXPECT_EQ(os.str(), "5 1 0 2 3 4 6 7 9 8 ");
+    EXPECT_EQ(&five, &list.get(0));
+    EXPECT_EQ(list.size(), LEN);
+
+    // A run of default values is found but stays in place
+    LinkedList<int> gaps;
+    gaps.add(1);
+    gaps.add(4, 2);
+    EXPECT_EQ(*gaps.find(0, SearchPolicy::MoveToFront), 0);
+    EXPECT_EQ(gaps.get(0), 1);
+    auto two = gaps.find(2, SearchPolicy::MoveToFront);
+    EXPECT_TRUE(two == gaps.begin());
+    os.str("");
+    os << gaps;
+    EXPECT_EQ(os.str(), "2 1 0 0 0 ");
+}
+
+TEST_F(LinkedListTest, LazyIndex)
+{
+    LinkedList<int> list;
+    for (size_t i = 0; i < LEN; ++i) {
+        list.add(DATA[i]);
+    }
+    EXPECT_EQ(list.get(3), 3);
+    EXPECT_EQ(list.indexMemory(), 0U);
+
+    // The index is built by the first indexed read and patched by appends
+    list.setIndexed(true);
+    EXPECT_EQ(list.indexMemory(), 0U);
+    const LinkedList<int>& view = list;
+    EXPECT_EQ(view.get(7), 7);
+    EXPECT_GE(list.indexMemory(), LEN * sizeof(void*));
+    list.add(10);
+    list.set(10, 11);
+    EXPECT_EQ(list.get(10), 11);
+
+    // Other structural changes discard it
+    list.add(0, -1);
+    list.remove(4);
+    EXPECT_EQ(list.get(0), -1);
+    EXPECT_EQ(list.get(4), 4);
+    EXPECT_EQ(list.get(10), 11);
+    EXPECT_THROW(list.get(11), std::out_of_range);
+
+    // No index while a run of default values exists
+    list.dropIndex();
+    EXPECT_EQ(list.indexMemory(), 0U);
+    list.add(14, 5);
+    EXPECT_EQ(view.get(12), 0);
+    EXPECT_EQ(view.get(14), 5);
+    EXPECT_EQ(list.indexMemory(), 0U);
+    list.set(12, 2);
+    list.set(13, 3);
+    list.set(11, 1);
+    EXPECT_EQ(list.get(14), 5);
+    EXPECT_GT(list.indexMemory(), 0U);
+
+    std::ostringstream os;
+    os << list;
+    EXPECT_EQ(os.str(), "-1 0 1 2 4 5 6 7 8 9 11 1 2 3 5 ");
+    LinkedList<int> copy(list);
+    EXPECT_EQ(copy.indexMemory(), 0U);
+    EXPECT_TRUE(copy == list);
+    list.setIndexed(false);
+    EXPECT_EQ(list.indexMemory(), 0U);
+    EXPECT_EQ(list.get(14), 5);
+}
+}
@@ -0,0 +1,158 @@
+// linkedListTextTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "LinkedListText.h"
+#include <cstdint>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+namespace {
+
+// An element type that is not a number, written as "x,y".
+struct Point {
+    int mX;
+    int mY;
+
+    bool operator==(const Point& rhs) const
+    {
+        return mX == rhs.mX && mY == rhs.mY;
+    }
+
+    bool operator!=(const Point& rhs) const
+    {
+        return !(*this == rhs);
+    }
+};
+}
+
+template <> struct TextCodec<Point> {
+    static char* format(char* first, char* last, const Point& value)
+    {
+        char* comma = TextCodec<int>::format(first, last, value.mX);
+        if (comma == nullptr || comma == last) {
+            return nullptr;
+        }
+        *comma = ',';
+        return TextCodec<int>::format(comma + 1, last, value.mY);
+    }
+
+    static const char* parse(const char* first, const char* last, Point& value)
+    {
+        const char* comma = TextCodec<int>::parse(first, last, value.mX);
+        if (comma == nullptr || comma == last || *comma != ',') {
+            return nullptr;
+        }
+        return TextCodec<int>::parse(comma + 1, last, value.mY);
+    }
+};
+
+namespace {
+
+// The fixture for testing toText and fromText.
+class LinkedListTextTest : public ::testing::Test {
+protected:
+    LinkedListTextTest()
+        : mPath("/tmp/linkedListTextTest." + std::to_string(getpid()))
+    {
+    }
+
+    ~LinkedListTextTest() override
+    {
+        unlink(mPath.c_str());
+    }
+
+    std::string mPath;
+};
+
+TEST_F(LinkedListTextTest, RoundTripsNumbers)
+{
+    LinkedList<int64_t> integers;
+    integers.add(-5);
+    integers.add(std::numeric_limits<int64_t>::min());
+    integers.add(std::numeric_limits<int64_t>::max());
+    integers.add(5, 7); // a run of default values in between
+    EXPECT_EQ("-5 -9223372036854775808 9223372036854775807 0 0 7 ", toText(integers, ' '));
+
+    LinkedList<int64_t> parsed;
+    parsed.add(1);
+    fromText(parsed, std::string_view("\t 2\n3  \r\n"));
+    fromText(parsed, toText(integers));
+    EXPECT_EQ(9U, parsed.size());
+    EXPECT_EQ(3, parsed.get(2));
+    EXPECT_EQ(std::numeric_limits<int64_t>::min(), parsed.get(4));
+
+    // Floating point values are written in the shortest form that reads back
+    LinkedList<double> reals;
+    reals.add(0.1);
+    reals.add(-1.0 / 3.0);
+    reals.add(1e300);
+    LinkedList<double> back;
+    fromText(back, toText(reals));
+    EXPECT_TRUE(back == reals);
+    EXPECT_EQ("0.1\n", toText(reals).substr(0, 4));
+}
+
+TEST_F(LinkedListTextTest, FilesAreReadAndWrittenInChunks)
+{
+    LinkedList<uint32_t> list;
+    for (uint32_t i = 0; i < 100000; ++i) {
+        list.add(i * 2654435761U);
+    }
+    int fd = open(mPath.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0600);
+    ASSERT_GE(fd, 0);
+    toText(list, fd);
+    ASSERT_EQ(0, lseek(fd, 0, SEEK_SET));
+    LinkedList<uint32_t> read;
+    fromText(read, fd);
+    close(fd);
+    EXPECT_GT(toText(list).size(), 2 * kTextChunk);
+    EXPECT_TRUE(read == list);
+
+    EXPECT_THROW(toText(list, -1), std::system_error);
+    EXPECT_THROW(fromText(read, -1), std::system_error);
+}
+
+TEST_F(LinkedListTextTest, RejectsMalformedText)
+{
+    LinkedList<int32_t> list;
+    list.add(1);
+    try {
+        fromText(list, std::string_view("2 3 x 5"));
+        FAIL() << "parsed a letter";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_STREQ("4", e.what());
+    }
+    EXPECT_THROW(fromText(list, std::string_view("99999999999")), std::invalid_argument);
+    EXPECT_THROW(fromText(list, std::string_view("12-3")), std::invalid_argument);
+    EXPECT_EQ(1U, list.size());
+
+    // An element longer than a chunk cannot be carried over
+    int fd = open(mPath.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0600);
+    ASSERT_GE(fd, 0);
+    std::string digits(kTextChunk + 1, '1');
+    ASSERT_EQ(static_cast<ssize_t>(digits.size()), write(fd, digits.data(), digits.size()));
+    ASSERT_EQ(0, lseek(fd, 0, SEEK_SET));
+    EXPECT_THROW(fromText(list, fd), std::invalid_argument);
+    close(fd);
+    EXPECT_EQ(1U, list.size());
+}
+
+TEST_F(LinkedListTextTest, CustomCodec)
+{
+    LinkedList<Point> points;
+    points.add(Point { 1, -2 });
+    points.add(Point { 30, 4 });
+    EXPECT_EQ("1,-2 30,4 ", toText(points, ' '));
+    LinkedList<Point> parsed;
+    fromText(parsed, toText(points));
+    EXPECT_TRUE(parsed == points);
+    EXPECT_THROW(fromText(parsed, std::string_view("1;2")), std::invalid_argument);
+}
+}
@@ -0,0 +1,172 @@
+// linkedListTraceTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "LinkedList.h"
+#include "LinkedListEditBatch.h"
+#include "LinkedListText.h"
+#include "LinkedListTrace.h"
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+namespace {
+
+// The fixture for testing LinkedListTraceRecorder and LinkedListTraceReader.
+class LinkedListTraceTest : public ::testing::Test {
+protected:
+    LinkedListTraceTest()
+        : mPath("/tmp/linkedListTraceTest." + std::to_string(getpid()))
+    {
+    }
+
+    ~LinkedListTraceTest() override
+    {
+        std::remove(mPath.c_str());
+    }
+
+    std::string mPath;
+};
+
+TEST_F(LinkedListTraceTest, RecordsOperations)
+{
+    LinkedListTraceRecorder recorder(mPath);
+    LinkedList<int> list;
+    list.add(1);
+    list.setRecorder(&recorder);
+    list.add(2);
+    list.add(2, 3);
+    list.add(0, 4);
+    list.add(6, 5); // past the end
+    EXPECT_EQ(4, list.get(0));
+    list.set(1, 7);
+    list.remove(2);
+    EXPECT_TRUE(list.find(3) != list.end());
+    int sum = 0;
+    for (int value : list) {
+        sum += value;
+    }
+    // Traversals made by the library itself are not recorded
+    EXPECT_TRUE(list == list);
+    EXPECT_EQ("4\n7\n3\n0\n0\n5\n", toText(list));
+    EXPECT_THROW(list.get(100), std::out_of_range);
+    list.clear();
+    list.setRecorder(nullptr);
+    list.add(8);
+    LinkedList<int> copy(list); // the recorder is not copied
+    copy.add(9);
+    EXPECT_EQ(11u, recorder.recorded());
+    recorder.flush();
+
+    const TraceEvent expected[] = {
+        { 0, 1, 1, 0, TraceOp::Add },
+        { 0, 2, 2, 0, TraceOp::Add },
+        { 0, 0, 3, 0, TraceOp::Insert },
+        { 0, 6, 4, 0, TraceOp::Insert },
+        { 0, 0, 7, 0, TraceOp::Get },
+        { 0, 1, 7, 0, TraceOp::Set },
+        { 0, 2, 7, 0, TraceOp::Remove },
+        { 0, 2, 6, 0, TraceOp::Find },
+        { 0, 0, 6, 0, TraceOp::Iterate },
+        { 0, 100, 6, 0, TraceOp::Get },
+        { 0, 0, 6, 0, TraceOp::Clear },
+    };
+    LinkedListTraceReader reader(mPath);
+    TraceEvent event {};
+    uint64_t time = 0;
+    for (const TraceEvent& want : expected) {
+        ASSERT_TRUE(reader.next(event));
+        EXPECT_EQ(want.mOp, event.mOp);
+        EXPECT_EQ(want.mIndex, event.mIndex);
+        EXPECT_EQ(want.mSize, event.mSize);
+        EXPECT_GE(event.mTime, time);
+        time = event.mTime;
+    }
+    EXPECT_FALSE(reader.next(event));
+}
+
+TEST_F(LinkedListTraceTest, RecordsStructuralChanges)
+{
+    LinkedListTraceRecorder recorder(mPath);
+    LinkedList<int> list;
+    LinkedList<int> other;
+    for (int i = 0; i < 5; ++i) {
+        list.add(i);
+        other.add(10 + i);
+    }
+    list.setRecorder(&recorder);
+    other.setRecorder(&recorder);
+    LinkedList<int>::iterator second(list.find(1));
+    list.erase(second); // 0 2 3 4
+    list.splice(list.find(3), other, other.find(12)); // 0 2 12 3 4
+    list.moveToFront(list.find(4)); // 4 0 2 12 3
+    list.moveToBack(list.find(0)); // 4 2 12 3 0
+    list.rotate(7); // 12 3 0 4 2
+    LinkedListEditBatch<int> batch(list);
+    batch.remove(0);
+    batch.add(3, 20);
+    list.apply(batch); // 3 0 4 20 2
+    list.splice(list.end(), other); // 3 0 4 20 2 10 11 13 14
+    EXPECT_EQ("3\n0\n4\n20\n2\n10\n11\n13\n14\n", toText(list));
+    list.setRecorder(nullptr);
+    other.setRecorder(nullptr);
+    recorder.flush();
+
+    // The finds are recorded too, but only the structural changes are
+    // checked here
+    const TraceEvent expected[] = {
+        { 0, 1, 5, 0, TraceOp::Erase },
+        { 0, 2, 4, 1, TraceOp::SpliceIn },
+        { 0, 2, 5, 1, TraceOp::SpliceOut },
+        { 0, 4, 5, 0, TraceOp::Move },
+        { 0, 1, 5, 5, TraceOp::Move },
+        { 0, 2, 5, 0, TraceOp::Rotate },
+        { 0, 5, 5, 2, TraceOp::Apply },
+        { 0, 5, 5, 4, TraceOp::SpliceIn },
+        { 0, 0, 4, 4, TraceOp::SpliceOut },
+    };
+    LinkedListTraceReader reader(mPath);
+    TraceEvent event {};
+    for (const TraceEvent& want : expected) {
+        do {
+            ASSERT_TRUE(reader.next(event));
+        } while (event.mOp == TraceOp::Find);
+        EXPECT_EQ(want.mOp, event.mOp);
+        EXPECT_EQ(want.mIndex, event.mIndex);
+        EXPECT_EQ(want.mSize, event.mSize);
+        EXPECT_EQ(want.mCount, event.mCount);
+    }
+    EXPECT_FALSE(reader.next(event));
+}
+
+TEST_F(LinkedListTraceTest, RejectsBadTraces)
+{
+    EXPECT_THROW(LinkedListTraceRecorder("/nonexistent/dir/trace"), std::system_error);
+    EXPECT_THROW(LinkedListTraceReader("/nonexistent/dir/trace"), std::system_error);
+
+    std::FILE* file = std::fopen(mPath.c_str(), "wb");
+    ASSERT_NE(nullptr, file);
+    std::fputs("not a trace", file);
+    std::fclose(file);
+    EXPECT_THROW(LinkedListTraceReader reader(mPath), std::invalid_argument);
+
+    {
+        LinkedListTraceRecorder recorder(mPath);
+        recorder.record(TraceOp::Set, 300, 400);
+    }
+    // Cut the last varint (the size, 400, takes two bytes) short
+    file = std::fopen(mPath.c_str(), "rb");
+    ASSERT_NE(nullptr, file);
+    std::fseek(file, 0, SEEK_END);
+    long bytes = std::ftell(file);
+    std::fclose(file);
+    ASSERT_EQ(0, truncate(mPath.c_str(), bytes - 1));
+    LinkedListTraceReader reader(mPath);
+    TraceEvent event {};
+    EXPECT_THROW(reader.next(event), std::invalid_argument);
+}
+}
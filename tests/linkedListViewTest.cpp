@@ -0,0 +1,160 @@
+// linkedListViewTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "AllocationTracker.h"
+#include "LinkedList.h"
+#include "LinkedListView.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Adds mBy to its argument; copying it throws while failing is set.
+struct Offset {
+    static bool failing;
+
+    explicit Offset(int by)
+        : mBy(by)
+    {
+    }
+
+    Offset(const Offset& other)
+        : mBy(other.mBy)
+    {
+        if (failing) {
+            throw std::runtime_error("copy");
+        }
+    }
+
+    Offset(Offset&& other) noexcept = default;
+
+    int operator()(int value) const
+    {
+        return value + mBy;
+    }
+
+    int mBy;
+};
+
+bool Offset::failing = false;
+
+// The fixture for testing LinkedListView and its adaptors.
+class LinkedListViewTest : public ::testing::Test {
+protected:
+    LinkedListViewTest()
+    {
+        for (int i = 0; i < 10; ++i) {
+            mList.add(i);
+        }
+    }
+
+    LinkedList<int> mList;
+};
+
+TEST_F(LinkedListViewTest, Sublist)
+{
+    auto first = mList.begin();
+    std::advance(first, 2);
+    auto last = first;
+    std::advance(last, 5);
+    LinkedListView<LinkedList<int>::iterator> middle = sublist(first, last);
+    EXPECT_EQ(std::vector<int>({ 2, 3, 4, 5, 6 }), std::vector<int>(middle.begin(), middle.end()));
+    EXPECT_FALSE(middle.isEmpty());
+    EXPECT_TRUE(sublist(first, first).isEmpty());
+
+    // The view refers to the list's elements rather than copies
+    for (int& value : middle) {
+        value *= 10;
+    }
+    EXPECT_EQ(20, mList.get(2));
+    EXPECT_EQ(7, mList.get(7));
+    const LinkedList<int>& constList = mList;
+    auto all = sublist(constList.begin(), constList.end());
+    EXPECT_EQ(10, std::distance(all.begin(), all.end()));
+}
+
+TEST_F(LinkedListViewTest, AdaptorsAreLazy)
+{
+    int calls = 0;
+    auto square = [&calls](int value) {
+        ++calls;
+        return value * value;
+    };
+    auto view = sublist(mList.begin(), mList.end())
+                    .filtered([](int value) { return value % 2 == 1; })
+                    .transformed(square)
+                    .filtered([](int value) { return value > 10; });
+    // Creating the last filter found its first element: 1, 9 and 25
+    EXPECT_EQ(3, calls);
+    EXPECT_EQ(std::vector<int>({ 25, 49, 81 }), std::vector<int>(view.begin(), view.end()));
+    EXPECT_EQ(25, *view.begin());
+
+    auto strings = sublist(mList.begin(), mList.end()).transformed([](int value) {
+        return std::to_string(value);
+    });
+    EXPECT_EQ("0123456789", std::accumulate(strings.begin(), strings.end(), std::string()));
+    auto none = strings.filtered([](const std::string& value) { return value.empty(); });
+    EXPECT_TRUE(none.isEmpty());
+}
+
+TEST_F(LinkedListViewTest, ReferencesPassThrough)
+{
+    // A transform returning a reference gives a bidirectional, writable view
+    auto same = sublist(mList.begin(), mList.end()).transformed([](int& value) -> int& {
+        return value;
+    });
+    using Iterator = decltype(same.begin());
+    EXPECT_TRUE((std::is_same_v<std::bidirectional_iterator_tag,
+        std::iterator_traits<Iterator>::iterator_category>));
+    auto last = same.end();
+    --last;
+    *last = 90;
+    std::fill(same.begin(), last, 1);
+    EXPECT_EQ(9, std::count(mList.begin(), mList.end(), 1));
+    EXPECT_EQ(90, mList.get(9));
+
+    // Adaptor iterators are assignable even though the lambdas are not
+    int threshold = 5;
+    auto big = sublist(mList.begin(), mList.end()).filtered([threshold](int value) {
+        return value > threshold;
+    });
+    auto found = big.begin();
+    found = big.end();
+    EXPECT_TRUE(found == big.end());
+
+    // Viewing copies no elements
+    LinkedList<AllocationTracker> trackers;
+    trackers.add(AllocationTracker());
+    trackers.add(AllocationTracker());
+    uint32_t count = AllocationTracker::getCount();
+    auto tracked = sublist(trackers.begin(), trackers.end())
+                       .filtered([](const AllocationTracker&) { return true; })
+                       .transformed([](AllocationTracker& tracker) -> AllocationTracker& {
+                           tracker.nonConstMethod();
+                           return tracker;
+                       });
+    EXPECT_EQ(2, std::distance(tracked.begin(), tracked.end()));
+    EXPECT_EQ(count, AllocationTracker::getCount());
+}
+
+TEST_F(LinkedListViewTest, FailedIteratorAssignmentKeepsFunction)
+{
+    auto plusOne = sublist(mList.begin(), mList.end()).transformed(Offset(1));
+    auto plusTen = sublist(mList.begin(), mList.end()).transformed(Offset(10));
+    auto iter = plusOne.begin();
+    Offset::failing = true;
+    EXPECT_THROW(iter = plusTen.begin(), std::runtime_error);
+    Offset::failing = false;
+    EXPECT_EQ(1, *iter);
+    iter = plusTen.begin();
+    EXPECT_EQ(11, *++iter);
+}
+}
@@ -0,0 +1,189 @@
+// rcuLinkedListTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "AllocationTracker.h"
+#include "LinkedList.h"
+#include "RcuLinkedList.h"
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Marks itself dead on destruction so that readers can notice a node that was
+// freed too early
+struct Checked {
+    static constexpr uint64_t kAlive = 0x5eed5eed5eed5eedULL;
+
+    Checked(uint64_t value = 0)
+        : mValue(value)
+        , mMagic(kAlive)
+    {
+    }
+
+    ~Checked()
+    {
+        mMagic = 0;
+    }
+
+    uint64_t mValue;
+    uint64_t mMagic;
+};
+
+// The fixture for testing class RcuLinkedList.
+class RcuLinkedListTest : public ::testing::Test {
+};
+
+TEST_F(RcuLinkedListTest, MatchesLinkedList)
+{
+    unsigned seed = 3;
+    auto next = [&seed]() {
+        seed = seed * 1103515245U + 12345U;
+        return seed >> 8;
+    };
+    RcuLinkedList<int> rcu;
+    LinkedList<int> reference;
+    for (int step = 0; step < 2000; ++step) {
+        uint32_t size = reference.size();
+        int value = static_cast<int>(next() % 1000);
+        switch (size == 0 ? 0 : next() % 4) {
+        case 0: {
+            uint32_t index = next() % (size + 2);
+            rcu.add(index, value);
+            reference.add(index, value);
+            break;
+        }
+        case 1: {
+            uint32_t index = next() % size;
+            rcu.remove(index);
+            reference.remove(index);
+            break;
+        }
+        case 2:
+            rcu.add(value);
+            reference.add(value);
+            break;
+        default: {
+            uint32_t index = next() % size;
+            rcu.set(index, value);
+            reference.set(index, value);
+            EXPECT_EQ(rcu.get(index), value);
+            break;
+        }
+        }
+        ASSERT_EQ(rcu.size(), reference.size());
+    }
+    RcuLinkedList<int>::ReadGuard guard = rcu.read();
+    EXPECT_TRUE(std::equal(guard.begin(), guard.end(), reference.begin(), reference.end()));
+    EXPECT_THROW(rcu.get(rcu.size()), std::out_of_range);
+    EXPECT_THROW(rcu.remove(rcu.size()), std::out_of_range);
+    EXPECT_THROW(rcu.set(rcu.size(), 0), std::out_of_range);
+}
+
+TEST_F(RcuLinkedListTest, GuardSeesSnapshotOfRemovedNodes)
+{
+    RcuLinkedList<int> list;
+    for (int i = 0; i < 5; ++i) {
+        list.add(i);
+    }
+    RcuLinkedList<int>::ReadGuard guard = list.read();
+    RcuLinkedList<int>::const_iterator iter = guard.begin();
+    ++iter;
+    // The reader stands on 1 while 1 and 2 are removed and 3 is replaced
+    list.remove(1);
+    list.remove(1);
+    list.set(1, 30);
+    EXPECT_EQ(*iter, 1);
+    ++iter;
+    EXPECT_EQ(*iter, 2);
+    ++iter;
+    EXPECT_EQ(*iter, 3);
+    EXPECT_EQ(list.pending(), 3U);
+
+    const int expected[] = { 0, 30, 4 };
+    RcuLinkedList<int>::ReadGuard later = list.read();
+    EXPECT_TRUE(std::equal(later.begin(), later.end(), expected, expected + 3));
+}
+
+TEST_F(RcuLinkedListTest, ReclaimsAfterGuardsClose)
+{
+    {
+        RcuLinkedList<AllocationTracker> list;
+        for (int i = 0; i < 10; ++i) {
+            list.add(AllocationTracker());
+        }
+        {
+            RcuLinkedList<AllocationTracker>::ReadGuard guard = list.read();
+            list.remove(0);
+            list.set(0, AllocationTracker());
+            list.clear();
+            EXPECT_EQ(list.pending(), 3U);
+            EXPECT_EQ(AllocationTracker::getCount(), 11U);
+        }
+        list.synchronize();
+        EXPECT_EQ(list.pending(), 0U);
+        EXPECT_EQ(AllocationTracker::getCount(), 0U);
+
+        list.add(3, AllocationTracker());
+        EXPECT_EQ(list.size(), 4U);
+        // Nodes retired while a guard is open are freed on destruction
+        RcuLinkedList<AllocationTracker>::ReadGuard guard = list.read();
+        list.remove(2);
+        RcuLinkedList<AllocationTracker>::ReadGuard moved(std::move(guard));
+    }
+    EXPECT_EQ(AllocationTracker::getCount(), 0U);
+}
+
+TEST_F(RcuLinkedListTest, ConcurrentReaders)
+{
+    RcuLinkedList<Checked> list(4);
+    uint64_t counter = 0;
+    for (; counter < 100; ++counter) {
+        list.add(Checked(counter));
+    }
+    std::atomic<bool> done(false);
+    std::atomic<uint64_t> failures(0);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 8; ++i) {
+        readers.emplace_back([&list, &done, &failures]() {
+            while (!done.load()) {
+                RcuLinkedList<Checked>::ReadGuard guard = list.read();
+                uint64_t previous = 0;
+                bool first = true;
+                for (const Checked& item : guard) {
+                    if (item.mMagic != Checked::kAlive || (!first && item.mValue <= previous)) {
+                        failures.fetch_add(1);
+                    }
+                    previous = item.mValue;
+                    first = false;
+                }
+            }
+        });
+    }
+    // Every update keeps the list strictly increasing
+    unsigned seed = 5;
+    for (int step = 0; step < 20000; ++step) {
+        seed = seed * 1103515245U + 12345U;
+        uint32_t index = (seed >> 8) % list.size();
+        if (step % 2 == 0) {
+            list.remove(index);
+            list.add(Checked(counter++));
+        } else {
+            list.set(index, Checked(list.get(index).mValue));
+        }
+    }
+    done.store(true);
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    list.synchronize();
+    EXPECT_EQ(failures.load(), 0U);
+    EXPECT_EQ(list.size(), 100U);
+}
+}
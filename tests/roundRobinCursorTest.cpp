@@ -0,0 +1,80 @@
+// roundRobinCursorTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "RoundRobinCursor.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// The fixture for testing class RoundRobinCursor.
+class RoundRobinCursorTest : public ::testing::Test {
+};
+
+TEST_F(RoundRobinCursorTest, CyclesWithoutStoppingAtTheEnd)
+{
+    LinkedList<int> list;
+    RoundRobinCursor<int> cursor(list);
+    EXPECT_THROW(cursor.next(), std::out_of_range);
+    EXPECT_TRUE(cursor.position() == list.end());
+
+    list.add(1);
+    list.add(2);
+    list.add(3);
+    std::vector<int> order;
+    for (int i = 0; i < 7; ++i) {
+        order.push_back(cursor.next());
+    }
+    EXPECT_EQ(std::vector<int>({ 1, 2, 3, 1, 2, 3, 1 }), order);
+    EXPECT_EQ(1, *cursor.position());
+
+    // Elements added behind the cursor are visited in turn
+    list.add(4);
+    cursor.next() = 20;
+    EXPECT_EQ(3, cursor.next());
+    EXPECT_EQ(4, cursor.next());
+    EXPECT_EQ(1, cursor.next());
+    EXPECT_EQ(20, list.get(1));
+}
+
+TEST_F(RoundRobinCursorTest, EraseAndMove)
+{
+    LinkedList<int> list;
+    for (int i = 1; i <= 4; ++i) {
+        list.add(i);
+    }
+    RoundRobinCursor<int> cursor(list);
+    cursor.erase(); // no current element yet
+    EXPECT_EQ(4U, list.size());
+
+    EXPECT_EQ(1, cursor.next());
+    EXPECT_EQ(2, cursor.next());
+    cursor.erase();
+    EXPECT_TRUE(cursor.position() == list.end());
+    cursor.erase(); // erasing twice removes one element
+    EXPECT_EQ(3U, list.size());
+    EXPECT_EQ(3, cursor.next());
+
+    // Moving the current element to the back keeps the cursor on it
+    list.moveToBack(cursor.position());
+    EXPECT_EQ(1, cursor.next());
+    EXPECT_EQ(4, cursor.next());
+    EXPECT_EQ(3, cursor.next());
+
+    // Erasing the last element wraps around to the first
+    cursor.erase();
+    EXPECT_EQ(1, cursor.next());
+    cursor.erase();
+    EXPECT_EQ(4, cursor.next());
+    cursor.erase();
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_THROW(cursor.next(), std::out_of_range);
+    list.add(5);
+    EXPECT_EQ(5, cursor.next());
+    EXPECT_EQ(5, cursor.next());
+}
+}
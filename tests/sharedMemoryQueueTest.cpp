@@ -0,0 +1,174 @@
+// sharedMemoryQueueTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "SharedMemoryQueue.h"
+#include <csignal>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+struct Record {
+    uint32_t mSequence;
+    double mValue;
+};
+
+// The fixture for testing class SharedMemoryQueue.
+class SharedMemoryQueueTest : public ::testing::Test {
+protected:
+    SharedMemoryQueueTest()
+        : mName("/sharedMemoryQueueTest." + std::to_string(getpid()))
+    {
+        SharedMemoryQueue<Record>::unlink(mName);
+    }
+
+    ~SharedMemoryQueueTest() override
+    {
+        SharedMemoryQueue<Record>::unlink(mName);
+    }
+
+    std::string mName;
+};
+
+TEST_F(SharedMemoryQueueTest, HandlesShareOneQueue)
+{
+    EXPECT_THROW(SharedMemoryQueue<Record>::create(mName, 0), std::invalid_argument);
+    EXPECT_THROW(SharedMemoryQueue<Record>::open(mName), std::system_error);
+    SharedMemoryQueue<Record> producer = SharedMemoryQueue<Record>::create(mName, 4);
+    EXPECT_THROW(SharedMemoryQueue<Record>::create(mName, 4), std::system_error);
+    EXPECT_THROW(SharedMemoryQueue<char>::open(mName), std::invalid_argument);
+
+    // A second mapping of the same object lands at another address.
+    SharedMemoryQueue<Record> consumer = SharedMemoryQueue<Record>::open(mName);
+    EXPECT_EQ(4u, consumer.capacity());
+    Record record {};
+    EXPECT_FALSE(consumer.tryPop(record));
+    for (uint32_t i = 0; i < 4; ++i) {
+        EXPECT_TRUE(producer.tryPush(Record { i, i * 0.5 }));
+    }
+    EXPECT_FALSE(producer.tryPush(Record { 4, 2.0 }));
+    EXPECT_EQ(4u, consumer.size());
+    for (uint32_t round = 0; round < 10; ++round) {
+        record = consumer.pop();
+        EXPECT_EQ(round, record.mSequence);
+        EXPECT_EQ(round * 0.5, record.mValue);
+        producer.push(Record { round + 4, (round + 4) * 0.5 });
+    }
+    EXPECT_EQ(4u, producer.size());
+    EXPECT_EQ(0u, producer.recoveries());
+}
+
+TEST_F(SharedMemoryQueueTest, PassesRecordsBetweenProcesses)
+{
+    const uint32_t count = 20000;
+    SharedMemoryQueue<Record> queue = SharedMemoryQueue<Record>::create(mName, 16);
+    pid_t child = fork();
+    ASSERT_NE(-1, child);
+    if (child == 0) {
+        SharedMemoryQueue<Record> producer = SharedMemoryQueue<Record>::open(mName);
+        for (uint32_t i = 0; i < count; ++i) {
+            producer.push(Record { i, i * 2.0 });
+        }
+        _exit(0);
+    }
+    bool ordered = true;
+    for (uint32_t i = 0; i < count; ++i) {
+        Record record = queue.pop();
+        ordered = ordered && record.mSequence == i && record.mValue == i * 2.0;
+    }
+    EXPECT_TRUE(ordered);
+    int status = 0;
+    ASSERT_EQ(child, waitpid(child, &status, 0));
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    EXPECT_EQ(0u, queue.size());
+}
+
+TEST_F(SharedMemoryQueueTest, SurvivesKilledProcesses)
+{
+    const uint32_t capacity = 8;
+    SharedMemoryQueue<Record> queue = SharedMemoryQueue<Record>::create(mName, capacity);
+    for (int round = 0; round < 20; ++round) {
+        pid_t child = fork();
+        ASSERT_NE(-1, child);
+        if (child == 0) {
+            for (uint32_t i = 0;; ++i) {
+                Record record {};
+                if (!queue.tryPush(Record { i, 0.0 })) {
+                    queue.tryPop(record);
+                }
+                if (i % 3 == 0) {
+                    queue.tryPop(record);
+                }
+            }
+        }
+        usleep(200 + round * 100);
+        kill(child, SIGKILL);
+        int status = 0;
+        ASSERT_EQ(child, waitpid(child, &status, 0));
+
+        // Whether or not the child held the lock, every node is either
+        // queued or free afterwards.
+        uint32_t size = queue.size();
+        EXPECT_LE(size, capacity);
+        Record record {};
+        uint32_t drained = 0;
+        while (queue.tryPop(record)) {
+            ++drained;
+        }
+        EXPECT_EQ(size, drained);
+        for (uint32_t i = 0; i < capacity; ++i) {
+            EXPECT_TRUE(queue.tryPush(Record { i, 1.0 }));
+        }
+        EXPECT_FALSE(queue.tryPush(Record { capacity, 1.0 }));
+        while (queue.tryPop(record)) {
+        }
+    }
+    EXPECT_LE(queue.recoveries(), 20u);
+}
+
+TEST_F(SharedMemoryQueueTest, ForgetsKilledWaiters)
+{
+    SharedMemoryQueue<Record> queue = SharedMemoryQueue<Record>::create(mName, 4);
+    // A popper that dies while asleep stays counted until a push finds
+    // nobody to wake
+    pid_t dead = fork();
+    ASSERT_NE(-1, dead);
+    if (dead == 0) {
+        queue.pop();
+        _exit(0);
+    }
+    usleep(50000);
+    kill(dead, SIGKILL);
+    int status = 0;
+    ASSERT_EQ(dead, waitpid(dead, &status, 0));
+    queue.push(Record { 1, 0.0 });
+    Record record {};
+    ASSERT_TRUE(queue.tryPop(record));
+
+    // A popper that registers after the reset must still be woken
+    pid_t child = fork();
+    ASSERT_NE(-1, child);
+    if (child == 0) {
+        _exit(queue.pop().mSequence == 7 ? 0 : 1);
+    }
+    usleep(50000);
+    queue.push(Record { 7, 0.0 });
+    pid_t done = 0;
+    for (int i = 0; i < 500 && done == 0; ++i) {
+        done = waitpid(child, &status, WNOHANG);
+        usleep(10000);
+    }
+    if (done == 0) {
+        kill(child, SIGKILL);
+        waitpid(child, &status, 0);
+    }
+    ASSERT_EQ(child, done);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    EXPECT_EQ(0u, queue.size());
+}
+}
@@ -0,0 +1,166 @@
+// smallLinkedListTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "SmallLinkedList.h"
+#include "fragile.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+// Sample data
+const int DATA[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+const size_t LEN = 10;
+
+// True if the element lives inside the list object.
+template <typename T, typename List> bool isInline(const T& item, const List& list)
+{
+    const char* address = reinterpret_cast<const char*>(&item);
+    const char* begin = reinterpret_cast<const char*>(&list);
+    return address >= begin && address < begin + sizeof(list);
+}
+
+template <typename T, uint32_t K> std::string toString(const SmallLinkedList<T, K>& list)
+{
+    std::ostringstream os;
+    for (const T& item : list) {
+        os << item << " ";
+    }
+    return os.str();
+}
+
+// The fixture for testing class SmallLinkedList.
+class SmallLinkedListTest : public ::testing::Test {
+};
+
+TEST_F(SmallLinkedListTest, SpillsPastInlineCapacity)
+{
+    SmallLinkedList<int, 4> list;
+    EXPECT_EQ(list.inlineCapacity(), 4U);
+    for (size_t i = 0; i < LEN; ++i) {
+        list.add(DATA[i]);
+    }
+    EXPECT_EQ(toString(list), "0 1 2 3 4 5 6 7 8 9 ");
+    for (uint32_t i = 0; i < LEN; ++i) {
+        EXPECT_EQ(isInline(list.get(i), list), i < 4) << i;
+    }
+
+    // Slots of removed elements are handed out again before the heap
+    list.remove(1);
+    list.add(0, 42);
+    EXPECT_TRUE(isInline(list.get(0), list));
+    EXPECT_EQ(toString(list), "42 0 2 3 4 5 6 7 8 9 ");
+
+    list.clear();
+    list.add(5, 7);
+    EXPECT_EQ(toString(list), "0 0 0 0 0 7 ");
+    EXPECT_TRUE(isInline(list.get(0), list));
+    EXPECT_FALSE(isInline(list.get(5), list));
+}
+
+TEST_F(SmallLinkedListTest, CopiesUseTheirOwnStorage)
+{
+    SmallLinkedList<std::string> original;
+    original.add("a");
+    original.add("b");
+    SmallLinkedList<std::string>* copy = new SmallLinkedList<std::string>(original);
+    EXPECT_TRUE(*copy == original);
+    EXPECT_TRUE(isInline(copy->get(0), *copy));
+
+    SmallLinkedList<std::string> assigned;
+    for (uint32_t i = 0; i < 12; ++i) {
+        assigned.add(std::to_string(i));
+    }
+    assigned = *copy;
+    delete copy;
+    EXPECT_EQ(toString(assigned), "a b ");
+    assigned.clear();
+    assigned = original;
+    EXPECT_TRUE(isInline(assigned.get(1), assigned));
+}
+
+TEST_F(SmallLinkedListTest, MovesAndSwapsKeepNodesInTheirArena)
+{
+    // The LinkedList base, whose moves and swap exchange nodes, is out of reach
+    static_assert(
+        !std::is_convertible_v<SmallLinkedList<int>&, LinkedList<int, SmallBufferAllocator<int>>&>);
+    static_assert(!std::is_constructible_v<LinkedList<int, SmallBufferAllocator<int>>,
+        SmallLinkedList<int>&&>);
+
+    SmallLinkedList<std::string>* source = new SmallLinkedList<std::string>;
+    source->add("a");
+    source->add("b");
+    SmallLinkedList<std::string> moved(std::move(*source));
+    SmallLinkedList<std::string> assigned;
+    assigned.add("c");
+    assigned = std::move(*source);
+    delete source;
+    EXPECT_EQ(toString(moved), "a b ");
+    EXPECT_EQ(toString(assigned), "a b ");
+    EXPECT_TRUE(isInline(moved.get(1), moved));
+    EXPECT_TRUE(isInline(assigned.get(0), assigned));
+
+    SmallLinkedList<std::string> other;
+    other.add("d");
+    std::swap(moved, other);
+    EXPECT_EQ(toString(moved), "d ");
+    EXPECT_EQ(toString(other), "a b ");
+    EXPECT_TRUE(isInline(moved.get(0), moved));
+    EXPECT_TRUE(isInline(other.get(1), other));
+    EXPECT_TRUE(other == assigned);
+}
+
+TEST_F(SmallLinkedListTest, SwapAndIterators)
+{
+    SmallLinkedList<int> small;
+    SmallLinkedList<int> large;
+    small.add(1);
+    for (size_t i = 0; i < LEN; ++i) {
+        large.add(DATA[i]);
+    }
+    small.swap(large);
+    EXPECT_EQ(toString(small), "0 1 2 3 4 5 6 7 8 9 ");
+    EXPECT_EQ(toString(large), "1 ");
+    for (int& item : small) {
+        item *= 3;
+    }
+    auto iter = small.end();
+    --iter;
+    EXPECT_EQ(*iter, 27);
+    iter--;
+    EXPECT_EQ(*iter, 24);
+    EXPECT_EQ(small.get(2), 6);
+}
+
+TEST_F(SmallLinkedListTest, FailedCopiesLeaveListUnchanged)
+{
+    SmallLinkedList<Fragile, 2> list;
+    list.add(Fragile(1));
+    list.add(Fragile(2));
+    SmallLinkedList<Fragile, 2> other(list);
+    other.add(Fragile(3));
+
+    Fragile::budget = 1;
+    EXPECT_THROW(list = other, std::runtime_error);
+    Fragile::budget = -1;
+    EXPECT_EQ(list.size(), 2U);
+    EXPECT_EQ(list.get(1).mValue, 2);
+
+    Fragile::budget = 0;
+    EXPECT_THROW(list.add(4, Fragile(5)), std::runtime_error);
+    Fragile::budget = -1;
+    EXPECT_EQ(list.size(), 2U);
+
+    // The inline slots were returned and are used again
+    list.remove(0);
+    list.add(Fragile(6));
+    EXPECT_TRUE(isInline(list.get(1), list));
+}
+}
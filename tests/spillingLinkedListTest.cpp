@@ -0,0 +1,102 @@
+// spillingLinkedListTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "SpillingLinkedList.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+namespace {
+
+const uint32_t SEGMENT = 16;
+
+// Budget for the given number of resident segments
+size_t budget(uint32_t segments)
+{
+    return segments * (SEGMENT + 1) * sizeof(LinkedListNode<int64_t>);
+}
+
+// The fixture for testing class SpillingLinkedList.
+class SpillingLinkedListTest : public ::testing::Test {
+};
+
+TEST_F(SpillingLinkedListTest, BudgetMustHoldTwoSegments)
+{
+    EXPECT_THROW(SpillingLinkedList<int64_t>(budget(2) - 1, SEGMENT), std::invalid_argument);
+    EXPECT_THROW(SpillingLinkedList<int64_t>(budget(2), 0), std::invalid_argument);
+    SpillingLinkedList<int64_t> list(budget(2), SEGMENT);
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_TRUE(list.begin() == list.end());
+    EXPECT_THROW(list.get(0), std::out_of_range);
+}
+
+TEST_F(SpillingLinkedListTest, StaysWithinBudget)
+{
+    SpillingLinkedList<int64_t> list(budget(3), SEGMENT);
+    const int64_t count = 10 * SEGMENT + 5;
+    for (int64_t i = 0; i < count; ++i) {
+        list.add(i * 3);
+        EXPECT_LE(list.residentBytes(), budget(3));
+    }
+    EXPECT_EQ(list.size(), static_cast<uint32_t>(count));
+    SpillStats stats = list.stats();
+    EXPECT_EQ(stats.mSegmentsWritten, 8U);
+    EXPECT_EQ(stats.mBytesWritten, 8 * SEGMENT * sizeof(int64_t));
+
+    // Indexed access pages segments back in
+    EXPECT_EQ(list.get(5), 15);
+    EXPECT_EQ(list.get(count - 1), (count - 1) * 3);
+    list.set(20, -1);
+    EXPECT_EQ(list.get(3 * SEGMENT), 3 * SEGMENT * 3);
+    EXPECT_EQ(list.get(6 * SEGMENT), 6 * SEGMENT * 3);
+    EXPECT_EQ(list.get(8 * SEGMENT), 8 * SEGMENT * 3);
+    EXPECT_EQ(list.get(20), -1);
+    EXPECT_LE(list.residentBytes(), budget(3));
+    stats = list.stats();
+    EXPECT_GT(stats.mMisses, 0U);
+    EXPECT_GT(stats.mHits, 0U);
+
+    int64_t expected = 0;
+    for (int64_t item : list) {
+        EXPECT_EQ(item, expected == 20 ? -1 : expected * 3) << expected;
+        ++expected;
+    }
+    EXPECT_EQ(expected, count);
+
+    list.clear();
+    EXPECT_TRUE(list.isEmpty());
+    list.add(7);
+    EXPECT_EQ(list.get(0), 7);
+}
+
+TEST_F(SpillingLinkedListTest, SequentialScansReadAhead)
+{
+    SpillingLinkedList<int64_t> list(budget(6), SEGMENT);
+    for (int64_t i = 0; i < 40 * SEGMENT; ++i) {
+        list.add(i);
+    }
+    SpillStats before = list.stats();
+    int64_t sum = 0;
+    for (auto iter = list.begin(); iter != list.end(); iter++) {
+        sum += *iter;
+    }
+    EXPECT_EQ(sum, 40 * SEGMENT * (40 * SEGMENT - 1) / 2);
+    SpillStats after = list.stats();
+    // The scan evicts the resident tail before reaching it, so every segment
+    // is read once, most of them ahead of the scan
+    EXPECT_EQ(after.mSegmentsRead - before.mSegmentsRead, 40U);
+    EXPECT_LE(after.mMisses - before.mMisses, 10U);
+
+    list.setReadahead(0);
+    before = list.stats();
+    for (uint32_t i = 0; i < list.size(); i += SEGMENT) {
+        EXPECT_EQ(list.get(i), i);
+    }
+    after = list.stats();
+    EXPECT_EQ(after.mMisses - before.mMisses, after.mSegmentsRead - before.mSegmentsRead);
+    // Segments read back unchanged are dropped without being written again
+    EXPECT_EQ(after.mSegmentsWritten, before.mSegmentsWritten);
+}
+}
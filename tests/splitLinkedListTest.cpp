@@ -0,0 +1,155 @@
+// splitLinkedListTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "AllocationTracker.h"
+#include "LinkedList.h"
+#include "SplitLinkedList.h"
+#include "fragile.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+namespace {
+
+// The fixture for testing class SplitLinkedList.
+class SplitLinkedListTest : public ::testing::Test {
+};
+
+TEST_F(SplitLinkedListTest, BasicOperations)
+{
+    SplitLinkedList<int> list;
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_TRUE(list.begin() == list.end());
+    for (int i = 0; i < 5; ++i) {
+        list.add(i);
+    }
+    list.add(0, -1);
+    list.add(3, 30);
+    list.add(9, 90);
+    const int expected[] = { -1, 0, 1, 30, 2, 3, 4, 0, 0, 90 };
+    ASSERT_EQ(list.size(), 10U);
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), expected));
+
+    list.set(7, 70);
+    EXPECT_EQ(list.get(7), 70);
+    list.remove(0);
+    list.remove(8);
+    EXPECT_EQ(list.get(0), 0);
+    EXPECT_EQ(list.get(7), 0);
+    EXPECT_THROW(list.get(8), std::out_of_range);
+    EXPECT_THROW(list.remove(8), std::out_of_range);
+    EXPECT_THROW(list.set(8, 0), std::out_of_range);
+
+    SplitLinkedList<int>::iterator iter = list.end();
+    --iter;
+    EXPECT_EQ(*iter, 0);
+    *iter = 5;
+    EXPECT_EQ(list.get(7), 5);
+
+    list.clear();
+    EXPECT_TRUE(list.isEmpty());
+    list.add(1);
+    EXPECT_EQ(list.get(0), 1);
+}
+
+TEST_F(SplitLinkedListTest, MatchesLinkedList)
+{
+    unsigned seed = 11;
+    auto next = [&seed]() {
+        seed = seed * 1103515245U + 12345U;
+        return seed >> 8;
+    };
+    SplitLinkedList<int> split;
+    LinkedList<int> reference;
+    for (int step = 0; step < 2000; ++step) {
+        uint32_t size = reference.size();
+        int value = static_cast<int>(next() % 1000);
+        switch (size == 0 ? 0 : next() % 3) {
+        case 0: {
+            uint32_t index = next() % (size + 2);
+            split.add(index, value);
+            reference.add(index, value);
+            break;
+        }
+        case 1: {
+            uint32_t index = next() % size;
+            split.remove(index);
+            reference.remove(index);
+            break;
+        }
+        default: {
+            uint32_t index = next() % size;
+            split.set(index, value);
+            reference.set(index, value);
+            break;
+        }
+        }
+        ASSERT_EQ(split.size(), reference.size());
+    }
+    const SplitLinkedList<int>& constSplit = split;
+    EXPECT_TRUE(std::equal(constSplit.begin(), constSplit.end(), reference.begin()));
+}
+
+TEST_F(SplitLinkedListTest, CopyAndEquality)
+{
+    SplitLinkedList<int> list;
+    for (int i = 0; i < 10; ++i) {
+        list.add(i);
+    }
+    list.remove(4);
+    SplitLinkedList<int> copy(list);
+    EXPECT_TRUE(copy == list);
+    copy.add(4, 4);
+    EXPECT_TRUE(copy != list);
+    list = copy;
+    EXPECT_TRUE(copy == list);
+    list = list;
+    EXPECT_EQ(list.size(), 10U);
+}
+
+TEST_F(SplitLinkedListTest, StrongGuarantee)
+{
+    SplitLinkedList<Fragile> list;
+    for (int i = 0; i < 3; ++i) {
+        list.add(Fragile(i));
+    }
+    list.remove(1);
+
+    // Fails while filling the gap, after reusing the free slot
+    Fragile::budget = 3;
+    EXPECT_THROW(list.add(10, Fragile(10)), std::runtime_error);
+    Fragile::budget = -1;
+    ASSERT_EQ(list.size(), 2U);
+    EXPECT_EQ(list.get(0).mValue, 0);
+    EXPECT_EQ(list.get(1).mValue, 2);
+
+    list.add(1, Fragile(1));
+    ASSERT_EQ(list.size(), 3U);
+    for (uint32_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(list.get(i).mValue, static_cast<int>(i));
+    }
+}
+
+TEST_F(SplitLinkedListTest, ReleasesResources)
+{
+    {
+        SplitLinkedList<AllocationTracker> list;
+        for (int i = 0; i < 10; ++i) {
+            list.add(AllocationTracker());
+        }
+        list.remove(3);
+        list.remove(0);
+        EXPECT_EQ(AllocationTracker::getCount(), 8U);
+        list.add(1, AllocationTracker());
+        EXPECT_EQ(AllocationTracker::getCount(), 9U);
+        SplitLinkedList<AllocationTracker> copy(list);
+        EXPECT_EQ(AllocationTracker::getCount(), 18U);
+        copy.clear();
+        EXPECT_EQ(AllocationTracker::getCount(), 9U);
+    }
+    EXPECT_EQ(AllocationTracker::getCount(), 0U);
+}
+}
@@ -0,0 +1,139 @@
+// spscChannelTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "AllocationTracker.h"
+#include "SpscChannel.h"
+#include "fragile.h"
+#include <gtest/gtest.h>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// The fixture for testing class SpscChannel.
+class SpscChannelTest : public ::testing::Test {
+};
+
+TEST_F(SpscChannelTest, FirstInFirstOut)
+{
+    SpscChannel<int> channel;
+    int value = 0;
+    EXPECT_TRUE(channel.isEmpty());
+    EXPECT_FALSE(channel.tryPop(value));
+    for (int i = 0; i < 5; ++i) {
+        channel.push(i);
+    }
+    const int batch[] = { 5, 6, 7 };
+    channel.pushBatch(std::begin(batch), std::end(batch));
+    EXPECT_FALSE(channel.isEmpty());
+    ASSERT_TRUE(channel.tryPop(value));
+    EXPECT_EQ(value, 0);
+
+    std::vector<int> received;
+    EXPECT_EQ(channel.popBatch(std::back_inserter(received), 4), 4U);
+    EXPECT_EQ(received, (std::vector<int> { 1, 2, 3, 4 }));
+    EXPECT_EQ(channel.popBatch(std::back_inserter(received), 10), 3U);
+    EXPECT_EQ(received, (std::vector<int> { 1, 2, 3, 4, 5, 6, 7 }));
+    EXPECT_TRUE(channel.isEmpty());
+    EXPECT_EQ(channel.popBatch(std::back_inserter(received), 10), 0U);
+}
+
+TEST_F(SpscChannelTest, ReusesDrainedNodes)
+{
+    SpscChannel<int> channel;
+    std::vector<int> values(16, 1);
+    std::vector<int> received;
+    channel.pushBatch(values.begin(), values.end());
+    channel.popBatch(std::back_inserter(received), 16);
+    size_t nodes = channel.nodeCount();
+    for (int round = 0; round < 100; ++round) {
+        channel.pushBatch(values.begin(), values.end());
+        received.clear();
+        EXPECT_EQ(channel.popBatch(std::back_inserter(received), 16), 16U);
+    }
+    EXPECT_EQ(channel.nodeCount(), nodes);
+}
+
+TEST_F(SpscChannelTest, FailedBatchSendsNothing)
+{
+    SpscChannel<Fragile> channel;
+    channel.push(Fragile(1));
+    std::vector<Fragile> values;
+    for (int i = 0; i < 5; ++i) {
+        values.push_back(Fragile(i + 2));
+    }
+    Fragile::budget = 3;
+    EXPECT_THROW(channel.pushBatch(values.begin(), values.end()), std::runtime_error);
+    Fragile::budget = 0;
+    EXPECT_THROW(channel.push(Fragile(9)), std::runtime_error);
+    Fragile::budget = -1;
+
+    Fragile value;
+    ASSERT_TRUE(channel.tryPop(value));
+    EXPECT_EQ(value.mValue, 1);
+    EXPECT_TRUE(channel.isEmpty());
+    channel.pushBatch(values.begin(), values.end());
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(channel.tryPop(value));
+        EXPECT_EQ(value.mValue, i + 2);
+    }
+}
+
+TEST_F(SpscChannelTest, ProducerAndConsumerThreads)
+{
+    SpscChannel<uint64_t> channel;
+    const uint64_t count = 200000;
+    std::thread producer([&channel, count]() {
+        std::vector<uint64_t> batch;
+        for (uint64_t i = 0; i < count; ++i) {
+            if (i % 8 == 0) {
+                channel.push(i);
+                continue;
+            }
+            batch.push_back(i);
+            if (batch.size() == 7 || i + 1 == count) {
+                channel.pushBatch(batch.begin(), batch.end());
+                batch.clear();
+            }
+        }
+    });
+    uint64_t expected = 0;
+    bool ordered = true;
+    std::vector<uint64_t> received;
+    while (expected < count) {
+        received.clear();
+        if (channel.popBatch(std::back_inserter(received), 32) == 0) {
+            std::this_thread::yield();
+        }
+        for (uint64_t value : received) {
+            ordered = ordered && value == expected;
+            ++expected;
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(channel.isEmpty());
+}
+
+TEST_F(SpscChannelTest, ReleasesResources)
+{
+    {
+        SpscChannel<AllocationTracker> channel;
+        for (int i = 0; i < 10; ++i) {
+            channel.push(AllocationTracker());
+        }
+        {
+            std::vector<AllocationTracker> received;
+            channel.popBatch(std::back_inserter(received), 2);
+            EXPECT_EQ(AllocationTracker::getCount(), 10U);
+        }
+        EXPECT_EQ(AllocationTracker::getCount(), 8U);
+    }
+    EXPECT_EQ(AllocationTracker::getCount(), 0U);
+}
+}
@@ -0,0 +1,139 @@
+// staticLinkedListTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "StaticLinkedList.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// Sample data
+const int DATA[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+const size_t LEN = 10;
+
+// A table of squares built entirely at compile time
+constexpr StaticLinkedList<int, 16> makeSquares()
+{
+    StaticLinkedList<int, 16> squares;
+    for (int i = 0; i < 12; ++i) {
+        squares.add(i * i);
+    }
+    squares.remove(0);
+    squares.add(0, -1);
+    squares.add(13, 169);
+    return squares;
+}
+
+constexpr StaticLinkedList<int, 16> kSquares = makeSquares();
+static_assert(kSquares.size() == 14, "compile-time size");
+static_assert(kSquares.get(0) == -1, "compile-time insertion");
+static_assert(kSquares.get(1) == 1, "compile-time removal");
+static_assert(kSquares.get(12) == 0, "compile-time gap fill");
+static_assert(kSquares.get(13) == 169, "compile-time append");
+static_assert(*--kSquares.end() == 169, "compile-time iteration");
+static_assert(StaticLinkedList<int, 16>::capacity() == 16, "capacity");
+
+template <typename T, uint32_t N> std::string toString(const StaticLinkedList<T, N>& list)
+{
+    std::ostringstream os;
+    for (const T& item : list) {
+        os << item << " ";
+    }
+    return os.str();
+}
+
+// The fixture for testing class StaticLinkedList.
+class StaticLinkedListTest : public ::testing::Test {
+};
+
+TEST_F(StaticLinkedListTest, AddGetSetRemove)
+{
+    StaticLinkedList<std::string, 8> list;
+    EXPECT_TRUE(list.isEmpty());
+    list.add("b");
+    list.add(0, "a");
+    list.add("d");
+    list.add(2, "c");
+    EXPECT_EQ(toString(list), "a b c d ");
+    list.set(1, "B");
+    EXPECT_EQ(list.get(1), "B");
+    list.get(3) = "D";
+    list.remove(0);
+    list.remove(2);
+    EXPECT_EQ(toString(list), "B c ");
+    EXPECT_THROW(list.get(2), std::out_of_range);
+    EXPECT_THROW(list.remove(2), std::out_of_range);
+    EXPECT_THROW(list.set(5, "x"), std::out_of_range);
+    list.clear();
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_TRUE(list.begin() == list.end());
+    list.add("z");
+    EXPECT_EQ(toString(list), "z ");
+}
+
+TEST_F(StaticLinkedListTest, CapacityIsExplicit)
+{
+    StaticLinkedList<int, LEN> list;
+    for (size_t i = 0; i < LEN; ++i) {
+        EXPECT_FALSE(list.isFull());
+        list.add(DATA[i]);
+    }
+    EXPECT_TRUE(list.isFull());
+    EXPECT_THROW(list.add(10), std::length_error);
+    EXPECT_THROW(list.add(0, 10), std::length_error);
+    EXPECT_EQ(list.size(), LEN);
+
+    // Removed slots are reused
+    list.remove(3);
+    list.remove(0);
+    list.add(0, 42);
+    list.add(43);
+    EXPECT_TRUE(list.isFull());
+    EXPECT_EQ(toString(list), "42 1 2 4 5 6 7 8 9 43 ");
+}
+
+TEST_F(StaticLinkedListTest, GapFill)
+{
+    StaticLinkedList<int, 8> list;
+    list.add(1);
+    EXPECT_THROW(list.add(8, 5), std::length_error);
+    EXPECT_THROW(list.add(UINT32_MAX, 5), std::length_error);
+    EXPECT_EQ(list.size(), 1U);
+    list.remove(0);
+    list.add(3, 7);
+    EXPECT_EQ(toString(list), "0 0 0 7 ");
+    list.add(7, 9);
+    EXPECT_TRUE(list.isFull());
+    EXPECT_EQ(toString(list), "0 0 0 7 0 0 0 9 ");
+}
+
+TEST_F(StaticLinkedListTest, IteratorsAndEquality)
+{
+    StaticLinkedList<int, 16> list;
+    for (size_t i = 0; i < LEN; ++i) {
+        list.add(DATA[i]);
+    }
+    for (int& item : list) {
+        item *= 2;
+    }
+    auto iter = list.end();
+    --iter;
+    EXPECT_EQ(*iter, 18);
+    iter--;
+    EXPECT_EQ(*iter, 16);
+    EXPECT_EQ(list.get(7), 14);
+
+    StaticLinkedList<int, 16> copy(list);
+    EXPECT_TRUE(copy == list);
+    copy.set(0, 1);
+    EXPECT_TRUE(copy != list);
+    EXPECT_EQ(list.get(0), 0);
+    copy = list;
+    EXPECT_TRUE(copy == list);
+}
+}
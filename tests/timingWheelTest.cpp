@@ -0,0 +1,140 @@
+// timingWheelTest.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+#include "TimingWheel.h"
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// The fixture for testing class TimingWheel.
+class TimingWheelTest : public ::testing::Test {
+};
+
+TEST_F(TimingWheelTest, ExpiresAtDeadline)
+{
+    TimingWheel<int> wheel(10);
+    EXPECT_TRUE(wheel.isEmpty());
+    const uint64_t deadlines[]
+        = { 15, 11, 73, 74, 64, 300, 4106, 70010, uint64_t(1) << 40, (uint64_t(1) << 40) + 3 };
+    for (int i = 0; i < 10; ++i) {
+        wheel.schedule(deadlines[i], i);
+    }
+    wheel.schedule(3, 10); // already passed
+    EXPECT_EQ(11U, wheel.size());
+
+    std::vector<std::pair<int, uint64_t>> fired;
+    auto expire = [&fired, &wheel](int& item) { fired.emplace_back(item, wheel.now()); };
+    wheel.advance(74, expire);
+    EXPECT_EQ(74U, wheel.now());
+    std::vector<std::pair<int, uint64_t>> early
+        = { { 1, 11 }, { 10, 11 }, { 0, 15 }, { 4, 64 }, { 2, 73 }, { 3, 74 } };
+    EXPECT_EQ(early, fired);
+    EXPECT_EQ(5U, wheel.size());
+
+    fired.clear();
+    wheel.advance(uint64_t(1) << 41, expire);
+    std::vector<std::pair<int, uint64_t>> late = { { 5, 300 }, { 6, 4106 }, { 7, 70010 },
+        { 8, uint64_t(1) << 40 }, { 9, (uint64_t(1) << 40) + 3 } };
+    EXPECT_EQ(late, fired);
+    EXPECT_TRUE(wheel.isEmpty());
+    EXPECT_EQ(uint64_t(1) << 41, wheel.now());
+
+    // Advancing backwards does nothing
+    wheel.advance(5, expire);
+    EXPECT_EQ(uint64_t(1) << 41, wheel.now());
+}
+
+TEST_F(TimingWheelTest, Cancel)
+{
+    TimingWheel<int> wheel;
+    TimingWheel<int>::Handle near = wheel.schedule(5, 1);
+    TimingWheel<int>::Handle far = wheel.schedule(100000, 2);
+    TimingWheel<int>::Handle first = wheel.schedule(20, 3);
+    TimingWheel<int>::Handle second = wheel.schedule(20, 4);
+    wheel.schedule(20, 5);
+    wheel.cancel(near);
+    wheel.cancel(far);
+    EXPECT_EQ(3U, wheel.size());
+
+    // A callback may cancel itself and timers due at the same tick
+    std::vector<int> fired;
+    wheel.advance(100000, [&](int& item) {
+        fired.push_back(item);
+        if (item == 3) {
+            wheel.cancel(first);
+            wheel.cancel(second);
+            wheel.schedule(0, 6);
+        }
+    });
+    EXPECT_EQ(std::vector<int>({ 3, 5, 6 }), fired);
+    EXPECT_TRUE(wheel.isEmpty());
+}
+
+TEST_F(TimingWheelTest, CallbackMayThrow)
+{
+    TimingWheel<int> wheel;
+    for (int i = 0; i < 3; ++i) {
+        wheel.schedule(7, i);
+    }
+    wheel.schedule(9, 3);
+    int calls = 0;
+    auto expire = [&calls](int&) {
+        if (++calls == 2) {
+            throw std::runtime_error("expire");
+        }
+    };
+    EXPECT_THROW(wheel.advance(100, expire), std::runtime_error);
+    EXPECT_EQ(7U, wheel.now());
+    EXPECT_EQ(2U, wheel.size());
+    wheel.advance(100, expire);
+    EXPECT_EQ(4, calls);
+    EXPECT_TRUE(wheel.isEmpty());
+}
+
+TEST_F(TimingWheelTest, MatchesReference)
+{
+    std::mt19937_64 random(7);
+    TimingWheel<uint32_t> wheel;
+    std::vector<TimingWheel<uint32_t>::Handle> handles;
+    std::map<uint32_t, uint64_t> pending; // id -> deadline
+    uint32_t nextId = 0;
+    for (int round = 0; round < 200; ++round) {
+        for (int i = 0; i < 50; ++i) {
+            // Delays of every magnitude, so that all levels are used
+            uint64_t delay = random() >> (random() % 64);
+            uint64_t deadline = wheel.now() + delay % (uint64_t(1) << 30);
+            pending[nextId] = deadline > wheel.now() ? deadline : wheel.now() + 1;
+            handles.push_back(wheel.schedule(deadline, nextId++));
+        }
+        for (int i = 0; i < 10 && !pending.empty(); ++i) {
+            auto victim = pending.lower_bound(static_cast<uint32_t>(random() % nextId));
+            if (victim != pending.end()) {
+                wheel.cancel(handles[victim->first]);
+                pending.erase(victim);
+            }
+        }
+        ASSERT_EQ(pending.size(), wheel.size());
+        uint64_t to = wheel.now() + (random() % (uint64_t(1) << (random() % 28)));
+        wheel.advance(to, [&](uint32_t& id) {
+            auto timer = pending.find(id);
+            ASSERT_TRUE(timer != pending.end());
+            EXPECT_EQ(timer->second, wheel.now());
+            pending.erase(timer);
+        });
+        for (const auto& timer : pending) {
+            ASSERT_GT(timer.second, to);
+        }
+    }
+    wheel.advance(UINT64_MAX, [&](uint32_t& id) { pending.erase(id); });
+    EXPECT_TRUE(pending.empty());
+    EXPECT_TRUE(wheel.isEmpty());
+}
+}
@@ -0,0 +1,441 @@
+// list_replay.cpp
+// Name: Nishant Jain
+// VUNetid: jainn6
+// Email: nishant.jan@vanderbilt.edu
+// Honor statement: I attest that I understand the honor code for this class and have neither given
+// nor received any unauthorized aid on this assignment
+//
+// Replays a trace written by LinkedListTraceRecorder (see
+// LinkedList::setRecorder) against LinkedList and alternative containers, so
+// that they can be compared on recorded rather than synthetic traffic. For
+// each implementation it reports the throughput over the whole trace, the
+// p50/p99/p99.9 latency of a single operation and the number of heap
+// allocations (counted through the global operator new, which is replaced
+// here).
+//
+// Traces hold no element values; the replay stores a running counter. Find
+// scans to the recorded position (through findIf or std::find_if) and
+// Iterate visits every element. Erase removes at the recorded position,
+// SpliceIn inserts that many new elements and SpliceOut erases that many,
+// Move and Rotate relink (LinkedList) or std::rotate (the others). Apply
+// records only its edit count and the resulting size, so it is replayed as
+// one pass that assigns every element, after growing or shrinking the
+// container at the back to that size. Events whose positions are out of
+// range for the replayed container (which happens when the trace was
+// recorded from several lists) are skipped and counted.
+//
+// usage: list_replay trace [implementation...]
+//        implementations: list indexed vector deque stdlist (default: all)
+#include "../bench/benchUtil.h"
+#include "LinkedList.h"
+#include "LinkedListTrace.h"
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+uint64_t gAllocations = 0;
+
+/**
+ * LinkedList<int64_t>, with or without its index.
+ */
+template <bool Indexed> class ListReplay {
+public:
+    ListReplay()
+        : mList()
+    {
+        mList.setIndexed(Indexed);
+    }
+
+    uint32_t size() const
+    {
+        return mList.size();
+    }
+
+    void add(int64_t value)
+    {
+        mList.add(value);
+    }
+
+    void insert(uint32_t index, int64_t value)
+    {
+        mList.add(index, value);
+    }
+
+    int64_t get(uint32_t index) const
+    {
+        return mList.get(index);
+    }
+
+    void set(uint32_t index, int64_t value)
+    {
+        mList.set(index, value);
+    }
+
+    void remove(uint32_t index)
+    {
+        mList.remove(index);
+    }
+
+    void clear()
+    {
+        mList.clear();
+    }
+
+    void rotate(uint32_t k)
+    {
+        mList.rotate(k);
+    }
+
+    void spliceIn(uint32_t index, uint32_t count, int64_t first)
+    {
+        LinkedList<int64_t> items;
+        for (uint32_t i = 0; i < count; ++i) {
+            items.add(first + i);
+        }
+        mList.splice(at(index), items);
+    }
+
+    void spliceOut(uint32_t index, uint32_t count)
+    {
+        LinkedList<int64_t>::iterator position = at(index);
+        for (uint32_t i = 0; i < count; ++i) {
+            position = mList.erase(position);
+        }
+    }
+
+    void move(uint32_t from, uint32_t to)
+    {
+        mList.splice(at(to), mList, at(from));
+    }
+
+    void apply(uint32_t size, int64_t value)
+    {
+        while (mList.size() > size) {
+            mList.remove(mList.size() - 1);
+        }
+        for (int64_t& item : mList) {
+            item = value;
+        }
+        while (mList.size() < size) {
+            mList.add(value);
+        }
+    }
+
+    int64_t find(uint32_t position) const
+    {
+        uint32_t seen = 0;
+        LinkedListConstIterator<int64_t> found
+            = mList.findIf([&seen, position](const int64_t&) { return seen++ == position; });
+        return found == mList.end() ? 0 : *found;
+    }
+
+    int64_t iterate() const
+    {
+        int64_t sum = 0;
+        for (int64_t value : mList) {
+            sum += value;
+        }
+        return sum;
+    }
+
+private:
+    LinkedList<int64_t>::iterator at(uint32_t index)
+    {
+        return std::next(mList.begin(), index);
+    }
+
+    LinkedList<int64_t> mList;
+};
+
+/**
+ * A standard sequence container of int64_t. Inserting past the end fills
+ * the gap with zeros, like LinkedList::add(index, value).
+ */
+template <typename Container> class SequenceReplay {
+public:
+    uint32_t size() const
+    {
+        return static_cast<uint32_t>(mItems.size());
+    }
+
+    void add(int64_t value)
+    {
+        mItems.push_back(value);
+    }
+
+    void insert(uint32_t index, int64_t value)
+    {
+        if (index > mItems.size()) {
+            mItems.resize(index);
+        }
+        mItems.insert(std::next(mItems.begin(), index), value);
+    }
+
+    int64_t get(uint32_t index) const
+    {
+        return *std::next(mItems.begin(), index);
+    }
+
+    void set(uint32_t index, int64_t value)
+    {
+        *std::next(mItems.begin(), index) = value;
+    }
+
+    void remove(uint32_t index)
+    {
+        mItems.erase(std::next(mItems.begin(), index));
+    }
+
+    void clear()
+    {
+        mItems.clear();
+    }
+
+    void rotate(uint32_t k)
+    {
+        if (!mItems.empty()) {
+            std::rotate(mItems.begin(), std::next(mItems.begin(), k % mItems.size()), mItems.end());
+        }
+    }
+
+    void spliceIn(uint32_t index, uint32_t count, int64_t first)
+    {
+        typename Container::iterator position
+            = mItems.insert(std::next(mItems.begin(), index), count, 0);
+        for (uint32_t i = 0; i < count; ++i) {
+            *position++ = first + i;
+        }
+    }
+
+    void spliceOut(uint32_t index, uint32_t count)
+    {
+        typename Container::iterator first = std::next(mItems.begin(), index);
+        mItems.erase(first, std::next(first, count));
+    }
+
+    void move(uint32_t from, uint32_t to)
+    {
+        typename Container::iterator source = std::next(mItems.begin(), from);
+        typename Container::iterator target = std::next(mItems.begin(), to);
+        if (to > from) {
+            std::rotate(source, std::next(source), target);
+        } else {
+            std::rotate(target, source, std::next(source));
+        }
+    }
+
+    void apply(uint32_t size, int64_t value)
+    {
+        mItems.resize(size);
+        for (int64_t& item : mItems) {
+            item = value;
+        }
+    }
+
+    int64_t find(uint32_t position) const
+    {
+        uint32_t seen = 0;
+        auto found = std::find_if(mItems.begin(), mItems.end(),
+            [&seen, position](const int64_t&) { return seen++ == position; });
+        return found == mItems.end() ? 0 : *found;
+    }
+
+    int64_t iterate() const
+    {
+        int64_t sum = 0;
+        for (int64_t value : mItems) {
+            sum += value;
+        }
+        return sum;
+    }
+
+private:
+    Container mItems;
+};
+
+/**
+ * Returns true iff event can be replayed against a container of the given
+ * size.
+ */
+bool fits(const TraceEvent& event, uint32_t size)
+{
+    switch (event.mOp) {
+    case TraceOp::Get:
+    case TraceOp::Set:
+    case TraceOp::Remove:
+    case TraceOp::Erase:
+        return event.mIndex < size;
+    case TraceOp::SpliceIn:
+        return event.mIndex <= size;
+    case TraceOp::SpliceOut:
+        return event.mIndex <= size && event.mCount <= size - event.mIndex;
+    case TraceOp::Move:
+        return event.mIndex < size && event.mCount <= size;
+    default:
+        return true;
+    }
+}
+
+template <typename Replay> void replay(const char* name, const std::vector<TraceEvent>& events)
+{
+    Replay container;
+    std::vector<double> latencies;
+    latencies.reserve(events.size());
+    uint64_t skipped = 0;
+    int64_t counter = 0;
+    int64_t sink = 0;
+    uint64_t allocations = gAllocations;
+    double totalUs = 0.0;
+    for (const TraceEvent& event : events) {
+        if (!fits(event, container.size())) {
+            ++skipped;
+            continue;
+        }
+        BenchClock::time_point start = BenchClock::now();
+        switch (event.mOp) {
+        case TraceOp::Add:
+            container.add(++counter);
+            break;
+        case TraceOp::Insert:
+            container.insert(event.mIndex, ++counter);
+            break;
+        case TraceOp::Get:
+            sink += container.get(event.mIndex);
+            break;
+        case TraceOp::Set:
+            container.set(event.mIndex, ++counter);
+            break;
+        case TraceOp::Remove:
+            container.remove(event.mIndex);
+            break;
+        case TraceOp::Clear:
+            container.clear();
+            break;
+        case TraceOp::Find:
+            sink += container.find(event.mIndex);
+            break;
+        case TraceOp::Iterate:
+            sink += container.iterate();
+            break;
+        case TraceOp::Erase:
+            container.remove(event.mIndex);
+            break;
+        case TraceOp::SpliceIn:
+            container.spliceIn(event.mIndex, event.mCount, counter + 1);
+            counter += event.mCount;
+            break;
+        case TraceOp::SpliceOut:
+            container.spliceOut(event.mIndex, event.mCount);
+            break;
+        case TraceOp::Move:
+            container.move(event.mIndex, event.mCount);
+            break;
+        case TraceOp::Rotate:
+            container.rotate(event.mIndex);
+            break;
+        case TraceOp::Apply:
+            container.apply(event.mIndex, ++counter);
+            break;
+        }
+        double us = elapsedUs(start);
+        totalUs += us;
+        latencies.push_back(us);
+    }
+    allocations = gAllocations - allocations;
+    keep(sink);
+    double replayed = static_cast<double>(latencies.size());
+    std::printf("  %-8s %12.0f ops/s  %9.3f %9.3f %9.3f us  %10llu allocs  %llu skipped\n", name,
+        totalUs > 0.0 ? replayed * 1e6 / totalUs : 0.0, percentile(latencies, 50),
+        percentile(latencies, 99), percentile(latencies, 99.9),
+        static_cast<unsigned long long>(allocations), static_cast<unsigned long long>(skipped));
+}
+
+bool wanted(int argc, char** argv, const char* name)
+{
+    if (argc <= 2) {
+        return true;
+    }
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+}
+
+void* operator new(size_t bytes)
+{
+    ++gAllocations;
+    if (void* p = std::malloc(bytes == 0 ? 1 : bytes)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::fprintf(stderr,
+            "usage: list_replay trace [implementation...]\n"
+            "       implementations: list indexed vector deque stdlist (default: all)\n");
+        return 2;
+    }
+    std::vector<TraceEvent> events;
+    uint64_t kinds[static_cast<int>(TraceOp::Apply) + 1] = {};
+    try {
+        LinkedListTraceReader reader(argv[1]);
+        TraceEvent event;
+        while (reader.next(event)) {
+            events.push_back(event);
+            ++kinds[static_cast<int>(event.mOp)];
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "list_replay: cannot read trace %s\n", e.what());
+        return 1;
+    }
+
+    static const char* const kNames[] = { "add", "insert", "get", "set", "remove", "clear", "find",
+        "iterate", "erase", "splice-in", "splice-out", "move", "rotate", "apply" };
+    std::printf("%zu events over %.3f s:", events.size(),
+        events.empty() ? 0.0 : static_cast<double>(events.back().mTime) / 1e9);
+    for (int i = 0; i <= static_cast<int>(TraceOp::Apply); ++i) {
+        if (kinds[i] != 0) {
+            std::printf(" %s %llu", kNames[i], static_cast<unsigned long long>(kinds[i]));
+        }
+    }
+    std::printf("\n  %-8s %16s  %9s %9s %9s\n", "", "throughput", "p50", "p99", "p99.9");
+    if (wanted(argc, argv, "list")) {
+        replay<ListReplay<false>>("list", events);
+    }
+    if (wanted(argc, argv, "indexed")) {
+        replay<ListReplay<true>>("indexed", events);
+    }
+    if (wanted(argc, argv, "vector")) {
+        replay<SequenceReplay<std::vector<int64_t>>>("vector", events);
+    }
+    if (wanted(argc, argv, "deque")) {
+        replay<SequenceReplay<std::deque<int64_t>>>("deque", events);
+    }
+    if (wanted(argc, argv, "stdlist")) {
+        replay<SequenceReplay<std::list<int64_t>>>("stdlist", events);
+    }
+    return 0;
+}